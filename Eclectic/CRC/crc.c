@@ -0,0 +1,1132 @@
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // SEEK_DATA And SEEK_HOLE
+#endif
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CRC_X86_64
+#define CRC_CLMUL_TARGET __attribute__((target("pclmul,sse4.1,ssse3")))
+#define CRC_CRC32C_TARGET __attribute__((target("pclmul,sse4.2")))
+#endif
+#define CRC_CRC32C_LONG_SHIFT (0x54A86326) // x^((8 * CRC_CRC32C_LONG_SIZE) - 33) Modulo Polynomial (Reflected)
+#define CRC_CRC32C_LONG_SIZE (8192)
+#define CRC_CRC32C_SHORT_SHIFT (0xB9E02B86) // x^((8 * CRC_CRC32C_SHORT_SIZE) - 33) Modulo Polynomial (Reflected)
+#define CRC_CRC32C_SHORT_SIZE (256)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc_name_table.h"
+#include "Eclectic/Miscellaneous/memory.h"
+#include "Eclectic/Miscellaneous/misc.h"
+#include "Eclectic/Miscellaneous/project.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef CRC_X86_64
+#include <immintrin.h>
+#endif
+#ifdef CRC_FILE_AVAILABLE
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+#ifdef CRC_PTHREAD_AVAILABLE
+#include <pthread.h>
+#endif
+
+/****************************************************************************************************
+ * Constants
+ ****************************************************************************************************/
+
+static const char * const crc_TierName[CRC_TIER_COUNT] = {"automatic", "loop", "lookup-table", "slicing", "clmul", "hardware"};
+
+/****************************************************************************************************
+ * Variables
+ ****************************************************************************************************/
+
+PROJECT_STATIC(uint32_t crc_featureMask);
+PROJECT_STATIC(crc_tableCacheEntry_t crc_tableCache[CRC_TABLE_CACHE_COUNT]);
+PROJECT_STATIC(crc_tier_t crc_tier);
+#ifdef CRC_PTHREAD_AVAILABLE
+static pthread_once_t crc_detectOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t crc_tableCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+#else
+static bool crc_detected = false;
+#endif
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+#ifdef CRC_X86_64
+static CRC_CLMUL_TARGET uint64_t crc_clmulFold(const crc_clmul_t * const Clmul, uint64_t crc, const uint8_t *data, size_t dataLength);
+static void crc_copyStream(uint8_t *destination, const uint8_t *source, size_t length);
+static CRC_CRC32C_TARGET uint32_t crc_crc32cHardware(uint32_t crc, const uint8_t *data, size_t dataLength);
+static CRC_CRC32C_TARGET uint32_t crc_crc32cShift(const uint32_t Crc, const uint32_t Shift);
+#endif
+static void crc_detect(void);
+static void crc_detectOnceCall(void);
+#ifdef CRC_FILE_AVAILABLE
+static size_t crc_fileFill(const int FileDescriptor, uint8_t * const buffer, bool * const last, bool * const failed);
+static bool crc_fileStream(const int FileDescriptor, const crc_fileUpdateCallback_t UpdateCallback, void * const context, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, uint64_t * const processed);
+#ifdef CRC_PTHREAD_AVAILABLE
+static void *crc_fileStreamReader(void *argument);
+#endif
+#endif
+static uint64_t crc_multiplyModulo(const uint64_t A, const uint64_t B, const uint64_t Polynomial);
+static uint32_t crc_nameHash(const char *Name, const uint32_t Seed);
+static void *crc_tableCacheFind(const size_t Width, const uint64_t Polynomial, const bool ReflectIn, const size_t Size, void * const table);
+static void crc_tableCacheLock(void);
+static void crc_tableCacheUnlock(void);
+static uint64_t crc_xPowerModulo(const uint64_t Polynomial, const size_t Exponent);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/*** Carry-Less Multiplication Initialize ***/
+void crc_clmulInit(crc_clmul_t * const clmul, const uint64_t Polynomial, const size_t Width, const bool Reflect)
+{
+    /*** Carry-Less Multiplication Initialize ***/
+    /* Variable */
+    size_t bit;
+    uint64_t g, mu, remainder;
+
+    /* Error Check */
+    if((clmul != NULL) && (Width >= 8) && (Width <= 64))
+    {
+        /* Set Up (Polynomial Scaled To Degree 64 So Every Width Shares One Kernel) */
+        (void)memset(clmul, 0, sizeof(*clmul));
+        clmul->reflect = Reflect;
+        clmul->shift = 64 - Width;
+        g = Polynomial << clmul->shift;
+
+        /* Barrett Constant (Low 64 Bits Of floor(x^128 / G)) */
+        mu = 0x0000000000000000;
+        remainder = g;
+        for(bit = 0; bit < 64; bit++)
+        {
+            if((remainder & 0x8000000000000000) == 0x8000000000000000)
+            {
+                mu |= (uint64_t)1 << (63 - bit);
+                remainder = (remainder << 1) ^ g;
+            }
+            else
+            {
+                remainder <<= 1;
+            }
+        }
+
+        /* Fold Constants (Lane 0 Multiplies The Low Lane, Lane 1 Multiplies The High Lane) */
+        if(Reflect)
+        {
+            /* Reflected Operands Multiply One Degree Short, So Each Exponent Is One Less */
+            clmul->barrett[0] = misc_reflect64(mu);
+            clmul->barrett[1] = misc_reflect64(g);
+            clmul->fold128[0] = misc_reflect64(crc_xPowerModulo(g, 191));
+            clmul->fold128[1] = misc_reflect64(crc_xPowerModulo(g, 127));
+            clmul->fold512[0] = misc_reflect64(crc_xPowerModulo(g, 575));
+            clmul->fold512[1] = misc_reflect64(crc_xPowerModulo(g, 511));
+        }
+        else
+        {
+            clmul->barrett[0] = mu;
+            clmul->barrett[1] = g;
+            clmul->fold128[0] = crc_xPowerModulo(g, 128);
+            clmul->fold128[1] = crc_xPowerModulo(g, 192);
+            clmul->fold512[0] = crc_xPowerModulo(g, 512);
+            clmul->fold512[1] = crc_xPowerModulo(g, 576);
+        }
+    }
+}
+
+/*** Carry-Less Multiplication Supported ***/
+bool crc_clmulSupported(void)
+{
+    /*** Carry-Less Multiplication Supported ***/
+    return ((crc_features() & CRC_FEATURE_CLMUL) == CRC_FEATURE_CLMUL);
+}
+
+/*** Carry-Less Multiplication Update ***/
+uint64_t crc_clmulUpdate(const crc_clmul_t * const Clmul, uint64_t crc, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Carry-Less Multiplication Update ***/
+    /* Error Check */
+    if((Clmul != NULL) && (Data != NULL) && (DataLength >= CRC_CLMUL_BLOCK_SIZE))
+    {
+#ifdef CRC_X86_64
+        /* Fold (Whole Blocks Only, Caller Handles The Tail) */
+        if(crc_clmulSupported())
+            crc = crc_clmulFold(Clmul, crc, Data, DataLength - (DataLength % CRC_CLMUL_BLOCK_SIZE));
+#endif
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Copy ***/
+void crc_copy(uint8_t * const destination, const uint8_t * const Source, const size_t Length, const bool NonTemporal)
+{
+    /*** Copy ***/
+    /* Error Check */
+    if((destination != NULL) && (Source != NULL) && (Length > 0))
+    {
+#ifdef CRC_X86_64
+        /* Copy (Non-Temporal Stores Bypass The Cache For Large Destinations That Will Not Be Read Back Soon) */
+        if(NonTemporal && (Length >= CRC_COPY_NON_TEMPORAL_MINIMUM_LENGTH))
+            crc_copyStream(destination, Source, Length);
+        else
+            memcpy(destination, Source, Length);
+#else
+        /* Copy */
+        (void)NonTemporal;
+        memcpy(destination, Source, Length);
+#endif
+    }
+}
+
+/*** CRC-32C Supported ***/
+bool crc_crc32cSupported(void)
+{
+    /*** CRC-32C Supported ***/
+    return ((crc_features() & CRC_FEATURE_CRC32C) == CRC_FEATURE_CRC32C);
+}
+
+/*** CRC-32C Update ***/
+uint32_t crc_crc32cUpdate(uint32_t crc, const uint8_t *Data, const size_t DataLength)
+{
+    /*** CRC-32C Update ***/
+    /* Error Check */
+    if((Data != NULL) && (DataLength > 0))
+    {
+#ifdef CRC_X86_64
+        /* Hardware */
+        if(crc_crc32cSupported())
+            crc = crc_crc32cHardware(crc, Data, DataLength);
+#endif
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Shift ***/
+uint64_t crc_shift(uint64_t crc, const uint64_t Polynomial, const size_t Width, uint64_t length)
+{
+    /*** Shift ***/
+    /* Variable */
+    uint64_t g, power;
+    size_t shift;
+
+    /* Error Check */
+    if((Width >= 8) && (Width <= 64) && (length > 0))
+    {
+        /* Set Up (Polynomial Scaled To Degree 64 So Every Width Shares One Multiply) */
+        shift = 64 - Width;
+        g = Polynomial << shift;
+        crc <<= shift;
+        power = crc_xPowerModulo(g, 8 + shift); // x^8 (One Zero Byte), Scaled
+
+        /* Square And Multiply (crc * x^(8 * length) Modulo Polynomial, Second Operand Unscaled) */
+        while(length > 0)
+        {
+            if((length & 1) == 1)
+                crc = crc_multiplyModulo(crc, power >> shift, g);
+            length >>= 1;
+            if(length > 0)
+                power = crc_multiplyModulo(power, power >> shift, g);
+        }
+
+        /* Set Up (Back To Width) */
+        crc >>= shift;
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Features ***/
+uint32_t crc_features(void)
+{
+    /*** Features ***/
+    /* Detect (Once, CPUID Is Not Cheap Enough For Every Call) */
+    crc_detectOnceCall();
+
+    /* Exit */
+    return crc_featureMask;
+}
+
+#ifdef CRC_FILE_AVAILABLE
+/*** File Read ***/
+bool crc_fileRead(const int FileDescriptor, const crc_fileUpdateCallback_t UpdateCallback, void * const context, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** File Read ***/
+    /* Variable */
+    size_t blockLength;
+    struct timespec end;
+    struct stat fileStatus;
+    size_t length;
+    uint8_t *mapping;
+    bool mapped;
+    uint64_t processed;
+    struct timespec start;
+    bool success;
+
+    /* Set Up */
+    mapped = false;
+    processed = 0;
+    success = false;
+
+    /* Error Check */
+    if((FileDescriptor >= 0) && (UpdateCallback != NULL) && (fstat(FileDescriptor, &fileStatus) == 0))
+    {
+        (void)clock_gettime(CLOCK_MONOTONIC, &start);
+
+        /* Map (Regular Files Read From The Start, Everything Else Falls Back To Reading) */
+        if(S_ISREG(fileStatus.st_mode) && (fileStatus.st_size > 0) && ((uint64_t)fileStatus.st_size <= SIZE_MAX) && (lseek(FileDescriptor, 0, SEEK_CUR) == 0))
+        {
+            length = (size_t)fileStatus.st_size;
+            mapping = mmap(NULL, length, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+            if(mapping != MAP_FAILED)
+            {
+                /* Hints (Best Effort) */
+                (void)madvise(mapping, length, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+                (void)madvise(mapping, length, MADV_HUGEPAGE);
+#endif
+
+                /* Calculate (Blocks Only Pace The Progress Callback, The Bulk Engine Sees Whole Megabytes) */
+                for(processed = 0; processed < length; processed += blockLength)
+                {
+                    blockLength = ((length - processed) < CRC_FILE_BLOCK_SIZE) ? (length - processed) : CRC_FILE_BLOCK_SIZE;
+                    UpdateCallback(context, mapping + processed, blockLength);
+                    if(ProgressCallback != NULL)
+                        ProgressCallback(processed + blockLength, length, progressArgument);
+                }
+                (void)munmap(mapping, length);
+                mapped = true;
+                success = true;
+            }
+        }
+
+        /* Read (Pipes, Sockets, Character Devices, And Files Reporting No Size) */
+        if(!mapped)
+            success = crc_fileStream(FileDescriptor, UpdateCallback, context, ProgressCallback, progressArgument, &processed);
+
+        /* Statistics */
+        if(statistics != NULL)
+        {
+            (void)clock_gettime(CLOCK_MONOTONIC, &end);
+            statistics->mapped = mapped;
+            statistics->processed = processed;
+            statistics->seconds = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+            statistics->bytesPerSecond = (statistics->seconds > 0.0) ? ((double)processed / statistics->seconds) : 0.0;
+            statistics->skipped = 0;
+        }
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** File Read Sparse ***/
+bool crc_fileReadSparse(const int FileDescriptor, const crc_fileUpdateCallback_t UpdateCallback, const crc_fileZeroCallback_t ZeroCallback, void * const context, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** File Read Sparse ***/
+    /* Variable */
+    size_t blockLength;
+    off_t data;
+    struct timespec end;
+    struct stat fileStatus;
+    off_t hole;
+    off_t length;
+    uint8_t *mapping;
+    off_t position;
+    uint64_t skipped;
+    struct timespec start;
+    bool success;
+
+    /* Set Up */
+    mapping = MAP_FAILED;
+    skipped = 0;
+    success = false;
+
+    /* Error Check */
+    if((FileDescriptor >= 0) && (UpdateCallback != NULL) && (ZeroCallback != NULL) && (fstat(FileDescriptor, &fileStatus) == 0))
+    {
+        /* Map (Holes Are Never Touched, So They Never Fault In) */
+        length = fileStatus.st_size;
+        if(S_ISREG(fileStatus.st_mode) && (length > 0) && ((uint64_t)length <= SIZE_MAX) && (lseek(FileDescriptor, 0, SEEK_CUR) == 0))
+            mapping = mmap(NULL, (size_t)length, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+
+        /* Fall Back (Not A Regular File, Empty, Or Not Mappable, Every Byte Is Read) */
+        if(mapping == MAP_FAILED)
+        {
+            success = crc_fileRead(FileDescriptor, UpdateCallback, context, ProgressCallback, progressArgument, statistics);
+        }
+        else
+        {
+            (void)clock_gettime(CLOCK_MONOTONIC, &start);
+            (void)madvise(mapping, (size_t)length, MADV_SEQUENTIAL);
+            for(position = 0; position < length;)
+            {
+                /* Next Extent (Filesystems Without Hole Reporting Show One Extent Covering The File) */
+                data = position;
+                hole = length;
+#if defined(SEEK_DATA) && defined(SEEK_HOLE)
+                if((data = lseek(FileDescriptor, position, SEEK_DATA)) < 0)
+                    data = (errno == ENXIO) ? length : position; // ENXIO Means Only A Trailing Hole Is Left
+                data = (data > length) ? length : data;
+                if((data < length) && ((hole = lseek(FileDescriptor, data, SEEK_HOLE)) < 0))
+                    hole = length;
+                hole = ((hole > length) || (hole <= data)) ? length : hole;
+#endif
+
+                /* Hole (O(log n) Shift Instead Of Feeding Zeros) */
+                if(data > position)
+                {
+                    ZeroCallback(context, (uint64_t)(data - position));
+                    skipped += (uint64_t)(data - position);
+                    position = data;
+                    if(ProgressCallback != NULL)
+                        ProgressCallback((uint64_t)position, (uint64_t)length, progressArgument);
+                }
+
+                /* Data */
+                for(; position < hole; position += (off_t)blockLength)
+                {
+                    blockLength = ((hole - position) < CRC_FILE_BLOCK_SIZE) ? (size_t)(hole - position) : CRC_FILE_BLOCK_SIZE;
+                    UpdateCallback(context, mapping + position, blockLength);
+                    if(ProgressCallback != NULL)
+                        ProgressCallback((uint64_t)position + blockLength, (uint64_t)length, progressArgument);
+                }
+            }
+            (void)munmap(mapping, (size_t)length);
+            (void)lseek(FileDescriptor, 0, SEEK_SET); // Extent Queries Move The Offset
+            success = true;
+
+            /* Statistics */
+            if(statistics != NULL)
+            {
+                (void)clock_gettime(CLOCK_MONOTONIC, &end);
+                statistics->mapped = true;
+                statistics->processed = (uint64_t)length;
+                statistics->seconds = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+                statistics->bytesPerSecond = (statistics->seconds > 0.0) ? ((double)length / statistics->seconds) : 0.0;
+                statistics->skipped = skipped;
+            }
+        }
+    }
+
+    /* Exit */
+    return success;
+}
+#endif
+
+/*** Lookup ***/
+const crc_name_t *crc_lookup(const char * const Name)
+{
+    /*** Lookup ***/
+    /* Variable */
+    const crc_name_t *entry;
+
+    /* Set Up */
+    entry = NULL;
+
+    /* Error Check */
+    if(Name != NULL)
+    {
+        /* Lookup (Perfect Hash, One String Compare) */
+        entry = &crc_NameTable[crc_nameHash(Name, crc_NameDisplacement[crc_nameHash(Name, 0) % CRC_NAME_BUCKET_COUNT]) % CRC_NAME_TABLE_COUNT];
+        if((entry->Name == NULL) || (strcmp(Name, entry->Name) != 0))
+            entry = NULL;
+    }
+
+    /* Exit */
+    return entry;
+}
+
+/*** Table Acquire ***/
+const void *crc_tableAcquire(const size_t Width, const uint64_t Polynomial, const bool ReflectIn, const size_t Size, const crc_tableGenerateCallback_t GenerateCallback, const void * const Argument)
+{
+    /*** Table Acquire ***/
+    /* Variable */
+    void *generated;
+    void *table;
+
+    /* Set Up */
+    generated = NULL;
+    table = NULL;
+
+    /* Error Check */
+    if((GenerateCallback != NULL) && (Size > 0))
+    {
+        /* Hit */
+        crc_tableCacheLock();
+        table = crc_tableCacheFind(Width, Polynomial, ReflectIn, Size, NULL);
+        crc_tableCacheUnlock();
+
+        /* Miss (Generate Outside The Lock, Another Thread May Win The Race) */
+        if(table == NULL)
+        {
+            if((generated = memory_malloc(Size)) != NULL)
+            {
+                GenerateCallback(generated, Size, Argument);
+                crc_tableCacheLock();
+                table = crc_tableCacheFind(Width, Polynomial, ReflectIn, Size, generated);
+                crc_tableCacheUnlock();
+
+                /* Lost The Race */
+                if(table != generated)
+                    memory_free(&generated);
+            }
+        }
+    }
+
+    /* Exit */
+    return table;
+}
+
+/*** Table Release ***/
+void crc_tableRelease(const void * const Table)
+{
+    /*** Table Release ***/
+    /* Variable */
+    size_t i;
+    void *table;
+
+    /* Set Up */
+    table = NULL;
+
+    /* Error Check */
+    if(Table != NULL)
+    {
+        /* Release (Last Reference Frees, Tables Not Cached Because The Cache Was Full Are Freed Directly) */
+        crc_tableCacheLock();
+        for(i = 0; i < CRC_TABLE_CACHE_COUNT; i++)
+        {
+            if((crc_tableCache[i].referenceCount > 0) && (crc_tableCache[i].table == Table))
+            {
+                if(--crc_tableCache[i].referenceCount == 0)
+                {
+                    table = crc_tableCache[i].table;
+                    memset(&crc_tableCache[i], 0, sizeof(crc_tableCache[i]));
+                }
+                break;
+            }
+        }
+        if(i == CRC_TABLE_CACHE_COUNT)
+            table = (void *)Table;
+        crc_tableCacheUnlock();
+
+        /* Free (Outside The Lock) */
+        if(table != NULL)
+            memory_free(&table);
+    }
+}
+
+/*** Tier From Name ***/
+crc_tier_t crc_tierFromName(const char * const Name)
+{
+    /*** Tier From Name ***/
+    /* Variable */
+    size_t i;
+    crc_tier_t tier;
+
+    /* Set Up */
+    tier = CRC_TIER_AUTOMATIC;
+
+    /* Error Check */
+    if(Name != NULL)
+    {
+        /* Find (Unknown Names Mean Automatic) */
+        for(i = 0; i < CRC_TIER_COUNT; i++)
+        {
+            if(strcmp(Name, crc_TierName[i]) == 0)
+            {
+                tier = (crc_tier_t)i;
+                break;
+            }
+        }
+    }
+
+    /* Exit */
+    return tier;
+}
+
+/*** Tier Get ***/
+crc_tier_t crc_tierGet(void)
+{
+    /*** Tier Get ***/
+    /* Detect (Once, Environment Variable Is The Initial Override) */
+    crc_detectOnceCall();
+
+    /* Exit */
+    return crc_tier;
+}
+
+/*** Tier Set ***/
+void crc_tierSet(const crc_tier_t Tier)
+{
+    /*** Tier Set ***/
+    /* Detect (Once, So The Environment Variable Cannot Overwrite This Later) */
+    crc_detectOnceCall();
+
+    /* Error Check */
+    if(Tier < CRC_TIER_COUNT)
+    {
+        /* Set (Applies To Configurations Initialized From Now On) */
+        crc_tier = Tier;
+    }
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+#ifdef CRC_X86_64
+/*** Carry-Less Multiplication Fold ***/
+static CRC_CLMUL_TARGET uint64_t crc_clmulFold(const crc_clmul_t * const Clmul, uint64_t crc, const uint8_t *data, size_t dataLength)
+{
+    /*** Carry-Less Multiplication Fold ***/
+    /* Variable */
+    __m128i fold128, fold512, product, shuffle, x0, x1, x2, x3;
+    uint64_t high, low, quotient;
+
+    /* Set Up (Non-Reflected Data Is Byte Swapped So The First Byte Is The Most Significant) */
+    fold128 = _mm_loadu_si128((const __m128i *)Clmul->fold128);
+    fold512 = _mm_loadu_si128((const __m128i *)Clmul->fold512);
+    if(Clmul->reflect)
+        shuffle = _mm_set_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    else
+        shuffle = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    /* First Block (Running CRC Lines Up With The First Bytes) */
+    x0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)data), shuffle);
+    if(Clmul->reflect)
+        x0 = _mm_xor_si128(x0, _mm_set_epi64x(0, (long long)crc));
+    else
+        x0 = _mm_xor_si128(x0, _mm_set_epi64x((long long)(crc << Clmul->shift), 0));
+    data += 16;
+    dataLength -= 16;
+
+    /* Fold By 4 (512 Bits Per Iteration) */
+    if(dataLength >= 48)
+    {
+        /* Set Up */
+        x1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)), shuffle);
+        x2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), shuffle);
+        x3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), shuffle);
+        data += 48;
+        dataLength -= 48;
+
+        /* Fold */
+        while(dataLength >= 64)
+        {
+            x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold512, 0x00), _mm_clmulepi64_si128(x0, fold512, 0x11)), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)), shuffle));
+            x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, fold512, 0x00), _mm_clmulepi64_si128(x1, fold512, 0x11)), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), shuffle));
+            x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, fold512, 0x00), _mm_clmulepi64_si128(x2, fold512, 0x11)), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), shuffle));
+            x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, fold512, 0x00), _mm_clmulepi64_si128(x3, fold512, 0x11)), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), shuffle));
+            data += 64;
+            dataLength -= 64;
+        }
+
+        /* Fold 4 Into 1 */
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x00), _mm_clmulepi64_si128(x0, fold128, 0x11)), x1);
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x00), _mm_clmulepi64_si128(x0, fold128, 0x11)), x2);
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x00), _mm_clmulepi64_si128(x0, fold128, 0x11)), x3);
+    }
+
+    /* Fold By 1 (128 Bits Per Iteration) */
+    while(dataLength >= 16)
+    {
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x00), _mm_clmulepi64_si128(x0, fold128, 0x11)), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)data), shuffle));
+        data += 16;
+        dataLength -= 16;
+    }
+
+    /* Reduce 128 Bits To 64 Bits (Multiply By x^64, Then Barrett) */
+    if(Clmul->reflect)
+    {
+        /* Multiply */
+        product = _mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x10), _mm_srli_si128(x0, 8));
+        high = (uint64_t)_mm_cvtsi128_si64(product);
+        low = (uint64_t)_mm_extract_epi64(product, 1);
+
+        /* Barrett (Reflected Products Land One Bit Low, So Shift Them Back Up) */
+        quotient = high ^ ((uint64_t)_mm_cvtsi128_si64(_mm_clmulepi64_si128(_mm_set_epi64x(0, (long long)high), _mm_set_epi64x(0, (long long)Clmul->barrett[0]), 0x00)) << 1);
+        product = _mm_clmulepi64_si128(_mm_set_epi64x(0, (long long)quotient), _mm_set_epi64x(0, (long long)Clmul->barrett[1]), 0x00);
+        crc = low ^ (((uint64_t)_mm_extract_epi64(product, 1) << 1) | ((uint64_t)_mm_cvtsi128_si64(product) >> 63));
+    }
+    else
+    {
+        /* Multiply */
+        product = _mm_clmulepi64_si128(x0, fold128, 0x01);
+        high = (uint64_t)_mm_extract_epi64(product, 1) ^ (uint64_t)_mm_cvtsi128_si64(x0);
+        low = (uint64_t)_mm_cvtsi128_si64(product);
+
+        /* Barrett */
+        quotient = high ^ (uint64_t)_mm_extract_epi64(_mm_clmulepi64_si128(_mm_set_epi64x(0, (long long)high), _mm_set_epi64x(0, (long long)Clmul->barrett[0]), 0x00), 1);
+        product = _mm_clmulepi64_si128(_mm_set_epi64x(0, (long long)quotient), _mm_set_epi64x(0, (long long)Clmul->barrett[1]), 0x00);
+        crc = (low ^ (uint64_t)_mm_cvtsi128_si64(product)) >> Clmul->shift;
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Copy Stream ***/
+static void crc_copyStream(uint8_t *destination, const uint8_t *source, size_t length)
+{
+    /*** Copy Stream ***/
+    /* Variable */
+    size_t head;
+
+    /* Align Destination */
+    head = (16 - ((uintptr_t)destination & 15)) & 15;
+    memcpy(destination, source, head);
+    destination += head;
+    source += head;
+    length -= head;
+
+    /* Copy (64 Bytes Per Iteration) */
+    while(length >= 64)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)(source + 0));
+        __m128i b = _mm_loadu_si128((const __m128i *)(source + 16));
+        __m128i c = _mm_loadu_si128((const __m128i *)(source + 32));
+        __m128i d = _mm_loadu_si128((const __m128i *)(source + 48));
+        _mm_stream_si128((__m128i *)(destination + 0), a);
+        _mm_stream_si128((__m128i *)(destination + 16), b);
+        _mm_stream_si128((__m128i *)(destination + 32), c);
+        _mm_stream_si128((__m128i *)(destination + 48), d);
+        destination += 64;
+        source += 64;
+        length -= 64;
+    }
+    _mm_sfence();
+
+    /* Tail */
+    memcpy(destination, source, length);
+}
+
+/*** CRC-32C Hardware ***/
+static CRC_CRC32C_TARGET uint32_t crc_crc32cHardware(uint32_t crc, const uint8_t *data, size_t dataLength)
+{
+    /*** CRC-32C Hardware ***/
+    /* Variable */
+    uint64_t crc0, crc1, crc2, word0, word1, word2;
+    const uint8_t *end;
+
+    /* Set Up */
+    crc0 = crc;
+
+    /* Align To 8 Bytes */
+    while((dataLength > 0) && (((uintptr_t)data % sizeof(uint64_t)) != 0))
+    {
+        crc0 = _mm_crc32_u8((uint32_t)crc0, *data++);
+        dataLength--;
+    }
+
+    /* Three Way Interleave (Long Blocks, Independent Streams Hide The Instruction Latency) */
+    while(dataLength >= (3 * CRC_CRC32C_LONG_SIZE))
+    {
+        crc1 = 0;
+        crc2 = 0;
+        end = data + CRC_CRC32C_LONG_SIZE;
+        do
+        {
+            (void)memcpy(&word0, data, sizeof(word0));
+            (void)memcpy(&word1, data + CRC_CRC32C_LONG_SIZE, sizeof(word1));
+            (void)memcpy(&word2, data + (2 * CRC_CRC32C_LONG_SIZE), sizeof(word2));
+            crc0 = _mm_crc32_u64(crc0, word0);
+            crc1 = _mm_crc32_u64(crc1, word1);
+            crc2 = _mm_crc32_u64(crc2, word2);
+            data += sizeof(uint64_t);
+        } while(data < end);
+        crc0 = crc_crc32cShift((uint32_t)crc0, CRC_CRC32C_LONG_SHIFT) ^ crc1;
+        crc0 = crc_crc32cShift((uint32_t)crc0, CRC_CRC32C_LONG_SHIFT) ^ crc2;
+        data += 2 * CRC_CRC32C_LONG_SIZE;
+        dataLength -= 3 * CRC_CRC32C_LONG_SIZE;
+    }
+
+    /* Three Way Interleave (Short Blocks) */
+    while(dataLength >= (3 * CRC_CRC32C_SHORT_SIZE))
+    {
+        crc1 = 0;
+        crc2 = 0;
+        end = data + CRC_CRC32C_SHORT_SIZE;
+        do
+        {
+            (void)memcpy(&word0, data, sizeof(word0));
+            (void)memcpy(&word1, data + CRC_CRC32C_SHORT_SIZE, sizeof(word1));
+            (void)memcpy(&word2, data + (2 * CRC_CRC32C_SHORT_SIZE), sizeof(word2));
+            crc0 = _mm_crc32_u64(crc0, word0);
+            crc1 = _mm_crc32_u64(crc1, word1);
+            crc2 = _mm_crc32_u64(crc2, word2);
+            data += sizeof(uint64_t);
+        } while(data < end);
+        crc0 = crc_crc32cShift((uint32_t)crc0, CRC_CRC32C_SHORT_SHIFT) ^ crc1;
+        crc0 = crc_crc32cShift((uint32_t)crc0, CRC_CRC32C_SHORT_SHIFT) ^ crc2;
+        data += 2 * CRC_CRC32C_SHORT_SIZE;
+        dataLength -= 3 * CRC_CRC32C_SHORT_SIZE;
+    }
+
+    /* 8 Bytes At A Time */
+    while(dataLength >= sizeof(uint64_t))
+    {
+        (void)memcpy(&word0, data, sizeof(word0));
+        crc0 = _mm_crc32_u64(crc0, word0);
+        data += sizeof(uint64_t);
+        dataLength -= sizeof(uint64_t);
+    }
+
+    /* Byte At A Time */
+    while(dataLength-- > 0)
+        crc0 = _mm_crc32_u8((uint32_t)crc0, *data++);
+
+    /* Exit */
+    return (uint32_t)crc0;
+}
+
+/*** CRC-32C Shift ***/
+static CRC_CRC32C_TARGET uint32_t crc_crc32cShift(const uint32_t Crc, const uint32_t Shift)
+{
+    /*** CRC-32C Shift ***/
+    /* Variable */
+    uint64_t product;
+
+    /* Multiply (Reflected Product Lands One Degree Short, Reduction Adds x^32) */
+    product = (uint64_t)_mm_cvtsi128_si64(_mm_clmulepi64_si128(_mm_cvtsi32_si128((int)Crc), _mm_cvtsi32_si128((int)Shift), 0x00));
+
+    /* Exit */
+    return (uint32_t)_mm_crc32_u64(0, product);
+}
+#endif
+
+/*** Detect ***/
+static void crc_detect(void)
+{
+    /*** Detect ***/
+    /* Features */
+    crc_featureMask = 0;
+#ifdef CRC_X86_64
+    if(__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("ssse3"))
+        crc_featureMask |= CRC_FEATURE_CLMUL;
+    if(__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.2"))
+        crc_featureMask |= CRC_FEATURE_CRC32C;
+#endif
+
+    /* Tier (Environment Override For Benchmarking And Bisecting) */
+    crc_tier = crc_tierFromName(getenv(CRC_TIER_ENVIRONMENT_VARIABLE));
+}
+
+/*** Detect Once Call ***/
+static void crc_detectOnceCall(void)
+{
+    /*** Detect Once Call ***/
+#ifdef CRC_PTHREAD_AVAILABLE
+    (void)pthread_once(&crc_detectOnce, crc_detect);
+#else
+    if(!crc_detected)
+    {
+        crc_detect();
+        crc_detected = true;
+    }
+#endif
+}
+
+#ifdef CRC_FILE_AVAILABLE
+/*** File Fill ***/
+static size_t crc_fileFill(const int FileDescriptor, uint8_t * const buffer, bool * const last, bool * const failed)
+{
+    /*** File Fill ***/
+    /* Variable */
+    size_t filled;
+    ssize_t length;
+
+    /* Set Up */
+    filled = 0;
+
+    /* Fill (Short Reads From Pipes Are Accumulated Into One Block) */
+    while(filled < CRC_FILE_BLOCK_SIZE)
+    {
+        length = read(FileDescriptor, buffer + filled, CRC_FILE_BLOCK_SIZE - filled);
+        if(length > 0)
+        {
+            filled += (size_t)length;
+        }
+        else if((length < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else
+        {
+            *last = true;
+            *failed = (length < 0);
+            break;
+        }
+    }
+
+    /* Exit */
+    return filled;
+}
+
+/*** File Stream ***/
+static bool crc_fileStream(const int FileDescriptor, const crc_fileUpdateCallback_t UpdateCallback, void * const context, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, uint64_t * const processed)
+{
+    /*** File Stream ***/
+    /* Variable */
+    void *buffer;
+    bool failed;
+    bool last;
+    size_t length;
+#ifdef CRC_PTHREAD_AVAILABLE
+    size_t index;
+    crc_fileStream_t stream;
+    pthread_t thread;
+#endif
+
+    /* Set Up */
+    failed = true;
+    last = false;
+
+    /* Error Check */
+    if((buffer = memory_malloc(2 * CRC_FILE_BLOCK_SIZE)) != NULL)
+    {
+        failed = false;
+#ifdef CRC_PTHREAD_AVAILABLE
+        /* Double Buffer (Reader Thread Fills One Block While The Other Is Checksummed) */
+        memset(&stream, 0, sizeof(stream));
+        stream.buffer[0] = buffer;
+        stream.buffer[1] = (uint8_t *)buffer + CRC_FILE_BLOCK_SIZE;
+        stream.fileDescriptor = FileDescriptor;
+        (void)pthread_mutex_init(&stream.mutex, NULL);
+        (void)pthread_cond_init(&stream.condition, NULL);
+        if(pthread_create(&thread, NULL, crc_fileStreamReader, &stream) == 0)
+        {
+            for(index = 0; !last; index ^= 1)
+            {
+                /* Wait For Block */
+                (void)pthread_mutex_lock(&stream.mutex);
+                while(!stream.full[index])
+                    (void)pthread_cond_wait(&stream.condition, &stream.mutex);
+                length = stream.length[index];
+                last = stream.last[index];
+                (void)pthread_mutex_unlock(&stream.mutex);
+
+                /* Calculate */
+                UpdateCallback(context, stream.buffer[index], length);
+                *processed += length;
+                if(ProgressCallback != NULL)
+                    ProgressCallback(*processed, 0, progressArgument);
+
+                /* Hand Block Back */
+                (void)pthread_mutex_lock(&stream.mutex);
+                stream.full[index] = false;
+                (void)pthread_cond_signal(&stream.condition);
+                (void)pthread_mutex_unlock(&stream.mutex);
+            }
+            (void)pthread_join(thread, NULL);
+            failed = stream.failed;
+        }
+        (void)pthread_cond_destroy(&stream.condition);
+        (void)pthread_mutex_destroy(&stream.mutex);
+#endif
+
+        /* Single Buffer (No Threads) */
+        while(!last)
+        {
+            length = crc_fileFill(FileDescriptor, buffer, &last, &failed);
+            UpdateCallback(context, buffer, length);
+            *processed += length;
+            if(ProgressCallback != NULL)
+                ProgressCallback(*processed, 0, progressArgument);
+        }
+        memory_free(&buffer);
+    }
+
+    /* Exit */
+    return !failed;
+}
+
+#ifdef CRC_PTHREAD_AVAILABLE
+/*** File Stream Reader ***/
+static void *crc_fileStreamReader(void *argument)
+{
+    /*** File Stream Reader ***/
+    /* Variable */
+    bool failed;
+    size_t index;
+    bool last;
+    size_t length;
+    crc_fileStream_t * const Stream = argument;
+
+    /* Set Up */
+    failed = false;
+    last = false;
+
+    /* Read */
+    for(index = 0; !last; index ^= 1)
+    {
+        /* Wait For Empty Block */
+        (void)pthread_mutex_lock(&Stream->mutex);
+        while(Stream->full[index])
+            (void)pthread_cond_wait(&Stream->condition, &Stream->mutex);
+        (void)pthread_mutex_unlock(&Stream->mutex);
+
+        /* Fill (Outside The Lock) */
+        length = crc_fileFill(Stream->fileDescriptor, Stream->buffer[index], &last, &failed);
+
+        /* Hand Block Over */
+        (void)pthread_mutex_lock(&Stream->mutex);
+        Stream->failed = failed;
+        Stream->full[index] = true;
+        Stream->last[index] = last;
+        Stream->length[index] = length;
+        (void)pthread_cond_signal(&Stream->condition);
+        (void)pthread_mutex_unlock(&Stream->mutex);
+    }
+
+    /* Exit */
+    return NULL;
+}
+#endif
+#endif
+
+/*** Multiply Modulo Polynomial ***/
+static uint64_t crc_multiplyModulo(const uint64_t A, const uint64_t B, const uint64_t Polynomial)
+{
+    /*** Multiply Modulo Polynomial ***/
+    /* Variable */
+    size_t bit;
+    uint64_t product;
+
+    /* Set Up */
+    product = 0x0000000000000000;
+
+    /* Multiply (Most Significant Bit Of B First, Reducing As The Product Grows) */
+    for(bit = 64; bit-- > 0;)
+    {
+        if((product & 0x8000000000000000) == 0x8000000000000000)
+            product = (product << 1) ^ Polynomial;
+        else
+            product <<= 1;
+        if(((B >> bit) & 1) == 1)
+            product ^= A;
+    }
+
+    /* Exit */
+    return product;
+}
+
+/*** Name Hash ***/
+static uint32_t crc_nameHash(const char *Name, const uint32_t Seed)
+{
+    /*** Name Hash ***/
+    /* Variable */
+    uint32_t hash;
+
+    /* Hash (32-Bit FNV-1a, Seeded, Same As Project/Script/crc_table.py) */
+    for(hash = 0x811C9DC5 ^ Seed; *Name != '\0'; Name++)
+        hash = (hash ^ (uint8_t)*Name) * 0x01000193;
+
+    /* Exit */
+    return hash;
+}
+
+/*** Table Cache Find ***/
+static void *crc_tableCacheFind(const size_t Width, const uint64_t Polynomial, const bool ReflectIn, const size_t Size, void * const table)
+{
+    /*** Table Cache Find ***/
+    /* Variable */
+    crc_tableCacheEntry_t *entry;
+    size_t i;
+    void *found;
+
+    /* Set Up */
+    entry = NULL;
+    found = table;
+
+    /* Find (A Larger Table Also Serves, Slicing Tables Grow By Appending Slices) */
+    for(i = 0; i < CRC_TABLE_CACHE_COUNT; i++)
+    {
+        if((crc_tableCache[i].referenceCount > 0) && (crc_tableCache[i].width == Width) && (crc_tableCache[i].polynomial == Polynomial) && (crc_tableCache[i].reflectIn == ReflectIn) && (crc_tableCache[i].size >= Size))
+        {
+            crc_tableCache[i].referenceCount++;
+            found = crc_tableCache[i].table;
+            entry = NULL;
+            break;
+        }
+        else if((entry == NULL) && (crc_tableCache[i].referenceCount == 0))
+        {
+            entry = &crc_tableCache[i];
+        }
+    }
+
+    /* Insert (Table Is Used Uncached When The Cache Is Full) */
+    if((table != NULL) && (found == table) && (entry != NULL))
+    {
+        entry->polynomial = Polynomial;
+        entry->referenceCount = 1;
+        entry->reflectIn = ReflectIn;
+        entry->size = Size;
+        entry->table = table;
+        entry->width = Width;
+    }
+
+    /* Exit */
+    return found;
+}
+
+/*** Table Cache Lock ***/
+static void crc_tableCacheLock(void)
+{
+    /*** Table Cache Lock ***/
+#ifdef CRC_PTHREAD_AVAILABLE
+    (void)pthread_mutex_lock(&crc_tableCacheMutex);
+#endif
+}
+
+/*** Table Cache Unlock ***/
+static void crc_tableCacheUnlock(void)
+{
+    /*** Table Cache Unlock ***/
+#ifdef CRC_PTHREAD_AVAILABLE
+    (void)pthread_mutex_unlock(&crc_tableCacheMutex);
+#endif
+}
+
+/*** x^n Modulo Polynomial ***/
+static uint64_t crc_xPowerModulo(const uint64_t Polynomial, const size_t Exponent)
+{
+    /*** x^n Modulo Polynomial ***/
+    /* Variable */
+    size_t i;
+    uint64_t remainder;
+
+    /* Set Up */
+    remainder = 0x0000000000000001;
+
+    /* Multiply By x, Exponent Times */
+    for(i = 0; i < Exponent; i++)
+    {
+        if((remainder & 0x8000000000000000) == 0x8000000000000000)
+            remainder = (remainder << 1) ^ Polynomial;
+        else
+            remainder <<= 1;
+    }
+
+    /* Exit */
+    return remainder;
+}
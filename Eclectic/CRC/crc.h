@@ -0,0 +1,139 @@
+/****************************************************************************************************
+ * Pragmas
+ ****************************************************************************************************/
+
+#pragma once
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#if defined(__GNUC__)
+#define CRC_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define CRC_ALWAYS_INLINE inline
+#endif
+#define CRC_CLMUL_BLOCK_SIZE (16)
+#define CRC_CLMUL_MINIMUM_LENGTH (4 * CRC_CLMUL_BLOCK_SIZE)
+#define CRC_COPY_BLOCK_SIZE (4096) // Copied Then Checksummed While Still In L1
+#define CRC_COPY_NON_TEMPORAL_MINIMUM_LENGTH (256)
+#define CRC_CRC32C_POLYNOMIAL (0x1EDC6F41)
+#define CRC_FEATURE_CLMUL (1 << 0)
+#define CRC_FEATURE_CRC32C (1 << 1)
+#define CRC_FILE_BLOCK_SIZE (1 << 20)
+#if defined(__unix__) || defined(__APPLE__)
+#define CRC_FILE_AVAILABLE
+#define CRC_IOVEC_AVAILABLE
+#define CRC_PTHREAD_AVAILABLE
+#endif
+#define CRC_TABLE_CACHE_COUNT (16)
+#define CRC_TIER_ENVIRONMENT_VARIABLE "ECLECTIC_CRC_TIER"
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#ifdef CRC_IOVEC_AVAILABLE
+#include <sys/uio.h>
+#endif
+#ifdef CRC_PTHREAD_AVAILABLE
+#include <pthread.h>
+#endif
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Enumerations ***/
+typedef enum crc_tier_e
+{
+    CRC_TIER_AUTOMATIC,
+    CRC_TIER_LOOP,
+    CRC_TIER_LOOKUP_TABLE,
+    CRC_TIER_SLICING,
+    CRC_TIER_CLMUL,
+    CRC_TIER_HARDWARE,
+    CRC_TIER_COUNT
+} crc_tier_t;
+
+/*** Callbacks ***/
+typedef void (*crc_fileProgressCallback_t)(const uint64_t Processed, const uint64_t Total, void * const argument); // Total Is 0 When Unknown (Pipes)
+typedef void (*crc_fileUpdateCallback_t)(void * const context, const uint8_t *Data, const size_t DataLength);
+typedef void (*crc_fileZeroCallback_t)(void * const context, const uint64_t Length);
+typedef void (*crc_tableGenerateCallback_t)(void * const table, const size_t Size, const void * const Argument);
+
+/*** Structures ***/
+typedef struct crc_clmul_s
+{
+    uint64_t barrett[2];
+    uint64_t fold128[2];
+    uint64_t fold512[2];
+    bool reflect;
+    size_t shift;
+} crc_clmul_t;
+
+typedef struct crc_fileStatistics_s
+{
+    double bytesPerSecond;
+    bool mapped;
+    uint64_t processed;
+    double seconds;
+    uint64_t skipped; // Hole Bytes Folded In Without Being Read
+} crc_fileStatistics_t;
+
+#ifdef CRC_PTHREAD_AVAILABLE
+typedef struct crc_fileStream_s
+{
+    uint8_t *buffer[2];
+    pthread_cond_t condition;
+    bool failed;
+    int fileDescriptor;
+    bool full[2];
+    bool last[2];
+    size_t length[2];
+    pthread_mutex_t mutex;
+} crc_fileStream_t;
+#endif
+
+typedef struct crc_name_s
+{
+    size_t index;
+    const char *Name;
+    size_t width;
+} crc_name_t;
+
+typedef struct crc_tableCacheEntry_s
+{
+    uint64_t polynomial;
+    size_t referenceCount;
+    bool reflectIn;
+    size_t size;
+    void *table;
+    size_t width;
+} crc_tableCacheEntry_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void crc_clmulInit(crc_clmul_t * const clmul, const uint64_t Polynomial, const size_t Width, const bool Reflect);
+extern bool crc_clmulSupported(void);
+extern uint64_t crc_clmulUpdate(const crc_clmul_t * const Clmul, uint64_t crc, const uint8_t *Data, const size_t DataLength);
+extern void crc_copy(uint8_t * const destination, const uint8_t * const Source, const size_t Length, const bool NonTemporal);
+extern bool crc_crc32cSupported(void);
+extern uint32_t crc_crc32cUpdate(uint32_t crc, const uint8_t *Data, const size_t DataLength);
+extern uint32_t crc_features(void);
+#ifdef CRC_FILE_AVAILABLE
+extern bool crc_fileRead(const int FileDescriptor, const crc_fileUpdateCallback_t UpdateCallback, void * const context, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+extern bool crc_fileReadSparse(const int FileDescriptor, const crc_fileUpdateCallback_t UpdateCallback, const crc_fileZeroCallback_t ZeroCallback, void * const context, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+#endif
+extern const crc_name_t *crc_lookup(const char * const Name);
+extern uint64_t crc_shift(uint64_t crc, const uint64_t Polynomial, const size_t Width, uint64_t length);
+extern const void *crc_tableAcquire(const size_t Width, const uint64_t Polynomial, const bool ReflectIn, const size_t Size, const crc_tableGenerateCallback_t GenerateCallback, const void * const Argument);
+extern void crc_tableRelease(const void * const Table);
+extern crc_tier_t crc_tierFromName(const char * const Name);
+extern crc_tier_t crc_tierGet(void);
+extern void crc_tierSet(const crc_tier_t Tier);
@@ -1,13 +1,30 @@
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CRC16_KERNEL_DEFINITION(IDENTIFIER, INDEX, INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT)                         \
+    uint16_t crc16_##IDENTIFIER##_calculate(const uint8_t *Data, const size_t DataLength)                                  \
+    {                                                                                                                  \
+        return crc16_kernel(crc16_LookupTable[INDEX], INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT, Data, DataLength); \
+    }
+#define CRC16_KERNEL_POINTER(IDENTIFIER, ...) crc16_##IDENTIFIER##_calculate,
+
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
+#include "Eclectic/CRC/crc.h"
 #include "Eclectic/CRC/crc16.h"
+#include "Eclectic/CRC/crc16_table.h"
 #include "Eclectic/Miscellaneous/memory.h"
 #include "Eclectic/Miscellaneous/misc.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#ifdef CRC_FILE_AVAILABLE
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 /****************************************************************************************************
  * Constants
@@ -15,38 +32,52 @@
 
 const crc16_configuration_t crc16_Configuration[] =
     {
-        {{"ARC", "CRC-16", "CRC-16/LHA", "CRC-IBM"}, 4, 0xBB3D, 0x0000, NULL, "CRC-16/ARC", 0x8005, true, true, 0x0000, 0x0000},
-        {{}, 0, 0x4C06, 0xFFFF, NULL, "CRC-16/CDMA2000", 0xC867, false, false, 0x0000, 0x0000},
-        {{}, 0, 0xAEE7, 0xFFFF, NULL, "CRC-16/CMS", 0x8005, false, false, 0x0000, 0x0000},
-        {{}, 0, 0x9ECF, 0x800D, NULL, "CRC-16/DDS-110", 0x8005, false, false, 0x0000, 0x0000},
-        {{"R-CRC-16"}, 1, 0x007E, 0x0000, NULL, "CRC-16/DECT-R", 0x0589, false, false, 0x0589, 0x0001},
-        {{"X-CRC-16"}, 1, 0x007F, 0x0000, NULL, "CRC-16/DECT-X", 0x0589, false, false, 0x0000, 0x0000},
-        {{}, 0, 0xEA82, 0x0000, NULL, "CRC-16/DNP", 0x3D65, true, true, 0x66C5, 0xFFFF},
-        {{}, 0, 0xC2B7, 0x0000, NULL, "CRC-16/EN-13757", 0x3D65, false, false, 0xA366, 0xFFFF},
-        {{"CRC-16/DARC", "CRC-16/EPC", "CRC-16/EPC-C1G2", "CRC-16/I-CODE"}, 4, 0xD64E, 0xFFFF, NULL, "CRC-16/GENIBUS", 0x1021, false, false, 0x1D0F, 0xFFFF},
-        {{}, 0, 0xCE3C, 0x0000, NULL, "CRC-16/GSM", 0x1021, false, false, 0x1D0F, 0xFFFF},
-        {{"CRC-16/AUTOSAR", "CRC-16/CCITT-FALSE"}, 2, 0x29B1, 0xFFFF, NULL, "CRC-16/IBM-3740", 0x1021, false, false, 0x0000, 0x0000},
-        {{"CRC-16/ISO-HDLC", "CRC-16/ISO-IEC-14443-3-B", "CRC-16/X-25", "CRC-B", "X-25"}, 5, 0x906E, 0xFFFF, NULL, "CRC-16/IBM-SDLC", 0x1021, true, true, 0xF0B8, 0xFFFF},
-        {{"CRC-A"}, 1, 0xBF05, 0xC6C6, NULL, "CRC-16/ISO-IEC-14443-3-A", 0x1021, true, true, 0x0000, 0x0000},
-        {{"CRC-16/BLUETOOTH", "CRC-16/CCITT", "CRC-16/CCITT-TRUE", "CRC-16/V-41-LSB", "CRC-CCITT", "KERMIT"}, 6, 0x2189, 0x0000, NULL, "CRC-16/KERMIT", 0x1021, true, true, 0x0000, 0x0000},
-        {{}, 0, 0xBDF4, 0x0000, NULL, "CRC-16/LJ1200", 0x6F63, false, false, 0x0000, 0x0000},
-        {{}, 0, 0x772B, 0xFFFF, NULL, "CRC-16/M17", 0x5935, false, false, 0x0000, 0x0000},
-        {{"CRC-16/MAXIM"}, 1, 0x44C2, 0x0000, NULL, "CRC-16/MAXIM-DOW", 0x8005, true, true, 0xB001, 0xFFFF},
-        {{}, 0, 0x6F91, 0xFFFF, NULL, "CRC-16/MCRF4XX", 0x1021, true, true, 0x0000, 0x0000},
-        {{"MODBUS"}, 1, 0x4B37, 0xFFFF, NULL, "CRC-16/MODBUS", 0x8005, true, true, 0x0000, 0x0000},
-        {{}, 0, 0xA066, 0xFFFF, NULL, "CRC-16/NRSC-5", 0x080B, true, true, 0x0000, 0x0000},
-        {{}, 0, 0x5D38, 0x0000, NULL, "CRC-16/OPENSAFETY-A", 0x5935, false, false, 0x0000, 0x0000},
-        {{}, 0, 0x20FE, 0x0000, NULL, "CRC-16/OPENSAFETY-B", 0x755B, false, false, 0x0000, 0x0000},
-        {{"CRC-16/IEC-61158-2"}, 1, 0xA819, 0xFFFF, NULL, "CRC-16/PROFIBUS", 0x1DCF, false, false, 0xE394, 0xFFFF},
-        {{}, 0, 0x63D0, 0xB2AA, NULL, "CRC-16/RIELLO", 0x1021, true, true, 0x0000, 0x0000},
-        {{"CRC-16/AUG-CCITT"}, 1, 0xE5CC, 0x1D0F, NULL, "CRC-16/SPI-FUJITSU", 0x1021, false, false, 0x0000, 0x0000},
-        {{}, 0, 0xD0DB, 0x0000, NULL, "CRC-16/T10-DIF", 0x8BB7, false, false, 0x0000, 0x0000},
-        {{}, 0, 0x0FB3, 0x0000, NULL, "CRC-16/TELEDISK", 0xA097, false, false, 0x0000, 0x0000},
-        {{}, 0, 0x26B1, 0x89EC, NULL, "CRC-16/TMS37157", 0x1021, true, true, 0x0000, 0x0000},
-        {{"CRC-16/BUYPASS", "CRC-16/VERIFONE"}, 2, 0xFEE8, 0x0000, NULL, "CRC-16/UMTS", 0x8005, false, false, 0x0000, 0x0000},
-        {{}, 0, 0xB4C8, 0xFFFF, NULL, "CRC-16/USB", 0x8005, true, true, 0xB001, 0xFFFF},
-        {{"CRC-16/ACORN", "CRC-16/LTE", "CRC-16/V-41-MSB", "XMODEM", "ZMODEM"}, 5, 0x31C3, 0x0000, NULL, "CRC-16/XMODEM", 0x1021, false, false, 0x0000, 0x0000}};
+        {{"ARC", "CRC-16", "CRC-16/LHA", "CRC-IBM"}, 4, 0xBB3D, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/ARC", 0x8005, true, true, 0x0000, 0x0000},
+        {{}, 0, 0x4C06, {}, CRC16_ENGINE_LOOP, 0xFFFF, NULL, NULL, "CRC-16/CDMA2000", 0xC867, false, false, 0x0000, 0x0000},
+        {{}, 0, 0xAEE7, {}, CRC16_ENGINE_LOOP, 0xFFFF, NULL, NULL, "CRC-16/CMS", 0x8005, false, false, 0x0000, 0x0000},
+        {{}, 0, 0x9ECF, {}, CRC16_ENGINE_LOOP, 0x800D, NULL, NULL, "CRC-16/DDS-110", 0x8005, false, false, 0x0000, 0x0000},
+        {{"R-CRC-16"}, 1, 0x007E, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/DECT-R", 0x0589, false, false, 0x0589, 0x0001},
+        {{"X-CRC-16"}, 1, 0x007F, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/DECT-X", 0x0589, false, false, 0x0000, 0x0000},
+        {{}, 0, 0xEA82, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/DNP", 0x3D65, true, true, 0x66C5, 0xFFFF},
+        {{}, 0, 0xC2B7, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/EN-13757", 0x3D65, false, false, 0xA366, 0xFFFF},
+        {{"CRC-16/DARC", "CRC-16/EPC", "CRC-16/EPC-C1G2", "CRC-16/I-CODE"}, 4, 0xD64E, {}, CRC16_ENGINE_LOOP, 0xFFFF, NULL, NULL, "CRC-16/GENIBUS", 0x1021, false, false, 0x1D0F, 0xFFFF},
+        {{}, 0, 0xCE3C, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/GSM", 0x1021, false, false, 0x1D0F, 0xFFFF},
+        {{"CRC-16/AUTOSAR", "CRC-16/CCITT-FALSE"}, 2, 0x29B1, {}, CRC16_ENGINE_LOOP, 0xFFFF, NULL, NULL, "CRC-16/IBM-3740", 0x1021, false, false, 0x0000, 0x0000},
+        {{"CRC-16/ISO-HDLC", "CRC-16/ISO-IEC-14443-3-B", "CRC-16/X-25", "CRC-B", "X-25"}, 5, 0x906E, {}, CRC16_ENGINE_LOOP, 0xFFFF, NULL, NULL, "CRC-16/IBM-SDLC", 0x1021, true, true, 0xF0B8, 0xFFFF},
+        {{"CRC-A"}, 1, 0xBF05, {}, CRC16_ENGINE_LOOP, 0xC6C6, NULL, NULL, "CRC-16/ISO-IEC-14443-3-A", 0x1021, true, true, 0x0000, 0x0000},
+        {{"CRC-16/BLUETOOTH", "CRC-16/CCITT", "CRC-16/CCITT-TRUE", "CRC-16/V-41-LSB", "CRC-CCITT", "KERMIT"}, 6, 0x2189, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/KERMIT", 0x1021, true, true, 0x0000, 0x0000},
+        {{}, 0, 0xBDF4, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/LJ1200", 0x6F63, false, false, 0x0000, 0x0000},
+        {{}, 0, 0x772B, {}, CRC16_ENGINE_LOOP, 0xFFFF, NULL, NULL, "CRC-16/M17", 0x5935, false, false, 0x0000, 0x0000},
+        {{"CRC-16/MAXIM"}, 1, 0x44C2, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/MAXIM-DOW", 0x8005, true, true, 0xB001, 0xFFFF},
+        {{}, 0, 0x6F91, {}, CRC16_ENGINE_LOOP, 0xFFFF, NULL, NULL, "CRC-16/MCRF4XX", 0x1021, true, true, 0x0000, 0x0000},
+        {{"MODBUS"}, 1, 0x4B37, {}, CRC16_ENGINE_LOOP, 0xFFFF, NULL, NULL, "CRC-16/MODBUS", 0x8005, true, true, 0x0000, 0x0000},
+        {{}, 0, 0xA066, {}, CRC16_ENGINE_LOOP, 0xFFFF, NULL, NULL, "CRC-16/NRSC-5", 0x080B, true, true, 0x0000, 0x0000},
+        {{}, 0, 0x5D38, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/OPENSAFETY-A", 0x5935, false, false, 0x0000, 0x0000},
+        {{}, 0, 0x20FE, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/OPENSAFETY-B", 0x755B, false, false, 0x0000, 0x0000},
+        {{"CRC-16/IEC-61158-2"}, 1, 0xA819, {}, CRC16_ENGINE_LOOP, 0xFFFF, NULL, NULL, "CRC-16/PROFIBUS", 0x1DCF, false, false, 0xE394, 0xFFFF},
+        {{}, 0, 0x63D0, {}, CRC16_ENGINE_LOOP, 0xB2AA, NULL, NULL, "CRC-16/RIELLO", 0x1021, true, true, 0x0000, 0x0000},
+        {{"CRC-16/AUG-CCITT"}, 1, 0xE5CC, {}, CRC16_ENGINE_LOOP, 0x1D0F, NULL, NULL, "CRC-16/SPI-FUJITSU", 0x1021, false, false, 0x0000, 0x0000},
+        {{}, 0, 0xD0DB, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/T10-DIF", 0x8BB7, false, false, 0x0000, 0x0000},
+        {{}, 0, 0x0FB3, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/TELEDISK", 0xA097, false, false, 0x0000, 0x0000},
+        {{}, 0, 0x26B1, {}, CRC16_ENGINE_LOOP, 0x89EC, NULL, NULL, "CRC-16/TMS37157", 0x1021, true, true, 0x0000, 0x0000},
+        {{"CRC-16/BUYPASS", "CRC-16/VERIFONE"}, 2, 0xFEE8, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/UMTS", 0x8005, false, false, 0x0000, 0x0000},
+        {{}, 0, 0xB4C8, {}, CRC16_ENGINE_LOOP, 0xFFFF, NULL, NULL, "CRC-16/USB", 0x8005, true, true, 0xB001, 0xFFFF},
+        {{"CRC-16/ACORN", "CRC-16/LTE", "CRC-16/V-41-MSB", "XMODEM", "ZMODEM"}, 5, 0x31C3, {}, CRC16_ENGINE_LOOP, 0x0000, NULL, NULL, "CRC-16/XMODEM", 0x1021, false, false, 0x0000, 0x0000}};
 const size_t crc16_ConfigurationCount = sizeof(crc16_Configuration) / sizeof(crc16_Configuration[0]);
+static const crc16_kernelCallback_t crc16_Kernel[] = {CRC16_KERNEL_LIST(CRC16_KERNEL_POINTER)};
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static size_t crc16_correctionFind(const crc16_correction_t * const Correction, const uint16_t Syndrome, const size_t BitCount);
+static void crc16_correctionFlip(const crc16_correction_t * const Correction, uint8_t * const buffer, const size_t BitCount, const size_t Distance);
+#ifdef CRC_FILE_AVAILABLE
+static void crc16_fileUpdate(void * const context, const uint8_t *Data, const size_t DataLength);
+#endif
+static CRC_ALWAYS_INLINE uint16_t crc16_kernel(const uint16_t * const LookupTable, const uint16_t Initial, const uint16_t TableInitial, const bool ReflectIn, const uint16_t XorOut, const uint8_t *Data, size_t dataLength);
+static crc16_engine_t crc16_selectEngine(const crc16_configuration_t * const Configuration, const crc16_engine_t Engine);
+static uint16_t crc16_update(const crc16_configuration_t * const Configuration, uint16_t crc, const uint8_t *Data, size_t dataLength);
 
 /****************************************************************************************************
  * Function Definitions (Public)
@@ -57,8 +88,8 @@ uint16_t crc16_calculate(const crc16_configuration_t * const Configuration, cons
 {
     /*** Calculate ***/
     /* Variable */
+    crc16_context_t context;
     uint16_t crc;
-    size_t i;
 
     /* Set Up */
     crc = 0x0000;
@@ -66,12 +97,17 @@ uint16_t crc16_calculate(const crc16_configuration_t * const Configuration, cons
     /* Error Check */
     if((Configuration != NULL) && (Data != NULL))
     {
-        /* Set Up */
-        crc = Configuration->initial;
-
-        /* Calculate */
-        for(i = 0; i < DataLength; i++)
-            crc = crc16_calculatePartial(Configuration, crc, Data[i], (i == 0), (i == (DataLength - 1)));
+        /* Calculate (Specialized Kernel When Installed) */
+        if(Configuration->kernel != NULL)
+        {
+            crc = Configuration->kernel(Data, DataLength);
+        }
+        else
+        {
+            crc16_contextInit(&context, Configuration);
+            crc16_contextUpdate(&context, Data, DataLength);
+            crc = crc16_contextFinal(&context);
+        }
     }
 
     /* Exit */
@@ -97,6 +133,169 @@ void crc16_calculateAndAppend(const crc16_configuration_t * const Configuration,
     }
 }
 
+#ifdef CRC_FILE_AVAILABLE
+/*** Calculate File ***/
+bool crc16_calculateFile(const crc16_configuration_t * const Configuration, const char * const Path, uint16_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** Calculate File ***/
+    /* Variable */
+    int fileDescriptor;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Path != NULL) && (crc != NULL) && ((fileDescriptor = open(Path, O_RDONLY | O_CLOEXEC)) >= 0))
+    {
+        /* Calculate */
+        success = crc16_calculateFileDescriptor(Configuration, fileDescriptor, crc, ProgressCallback, progressArgument, statistics);
+        (void)close(fileDescriptor);
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Calculate File Descriptor ***/
+bool crc16_calculateFileDescriptor(const crc16_configuration_t * const Configuration, const int FileDescriptor, uint16_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** Calculate File Descriptor ***/
+    /* Variable */
+    crc16_context_t context;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (crc != NULL))
+    {
+        /* Calculate (Mapped Where Possible, Streamed Otherwise) */
+        crc16_contextInit(&context, Configuration);
+        success = crc_fileRead(FileDescriptor, crc16_fileUpdate, &context, ProgressCallback, progressArgument, statistics);
+        if(success)
+            *crc = crc16_contextFinal(&context);
+    }
+
+    /* Exit */
+    return success;
+}
+#endif
+
+/*** Calculate List ***/
+uint16_t crc16_calculateList(const crc16_configuration_t * const Configuration, const list_list_t * const List)
+{
+    /*** Calculate List ***/
+    /* Variable */
+    crc16_context_t context;
+    const list_node_t *node;
+    const struct iovec *Segment;
+    uint16_t crc;
+
+    /* Set Up */
+    crc = 0x0000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (List != NULL))
+    {
+        /* Calculate (Node Data Are Segment Descriptors, CRC Carried Across Segments) */
+        crc16_contextInit(&context, Configuration);
+        for(node = List->head; node != NULL; node = node->next)
+        {
+            Segment = node->data;
+            if(Segment != NULL)
+                crc16_contextUpdate(&context, Segment->iov_base, Segment->iov_len);
+        }
+        crc = crc16_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Calculate Many ***/
+void crc16_calculateMany(const crc16_configuration_t * const Configuration, const uint8_t * const Data[], const size_t DataLength[], uint16_t crc[], const size_t Count)
+{
+    /*** Calculate Many ***/
+    /* Variable */
+    crc16_context_t context[CRC16_MANY_LANE_COUNT];
+    const uint8_t *data[CRC16_MANY_LANE_COUNT];
+    uint16_t chain0, chain1, chain2, chain3;
+    size_t i, j, lane, length;
+    const uint16_t *LookupTable;
+
+    /* Set Up */
+    i = 0;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Data != NULL) && (DataLength != NULL) && (crc != NULL))
+    {
+        /* Lookup Table (Lanes Interleaved, One Serial Dependency Chain Per Buffer Instead Of One For The Batch) */
+        if(Configuration->engine == CRC16_ENGINE_LOOKUP_TABLE)
+        {
+            LookupTable = Configuration->lookupTable;
+            for(; (i + CRC16_MANY_LANE_COUNT) <= Count; i += CRC16_MANY_LANE_COUNT)
+            {
+                /* Set Up (Common Length, Buffers Without Data Take The Single Buffer Path) */
+                length = SIZE_MAX;
+                for(lane = 0; lane < CRC16_MANY_LANE_COUNT; lane++)
+                {
+                    if(Data[i + lane] == NULL)
+                        break;
+                    crc16_contextInit(&context[lane], Configuration);
+                    data[lane] = Data[i + lane];
+                    length = (DataLength[i + lane] < length) ? DataLength[i + lane] : length;
+                }
+                if(lane < CRC16_MANY_LANE_COUNT)
+                    break;
+
+                /* Interleave (Four Independent Chains, Kept In Registers) */
+                chain0 = context[0].crc;
+                chain1 = context[1].crc;
+                chain2 = context[2].crc;
+                chain3 = context[3].crc;
+                if(Configuration->reflectIn)
+                {
+                    for(j = 0; j < length; j++)
+                    {
+                        chain0 = (chain0 >> 8) ^ LookupTable[(chain0 ^ data[0][j]) & 0xFF];
+                        chain1 = (chain1 >> 8) ^ LookupTable[(chain1 ^ data[1][j]) & 0xFF];
+                        chain2 = (chain2 >> 8) ^ LookupTable[(chain2 ^ data[2][j]) & 0xFF];
+                        chain3 = (chain3 >> 8) ^ LookupTable[(chain3 ^ data[3][j]) & 0xFF];
+                    }
+                }
+                else
+                {
+                    for(j = 0; j < length; j++)
+                    {
+                        chain0 = (uint16_t)((chain0 << 8) ^ LookupTable[(chain0 >> 8) ^ data[0][j]]);
+                        chain1 = (uint16_t)((chain1 << 8) ^ LookupTable[(chain1 >> 8) ^ data[1][j]]);
+                        chain2 = (uint16_t)((chain2 << 8) ^ LookupTable[(chain2 >> 8) ^ data[2][j]]);
+                        chain3 = (uint16_t)((chain3 << 8) ^ LookupTable[(chain3 >> 8) ^ data[3][j]]);
+                    }
+                }
+                context[0].crc = chain0;
+                context[1].crc = chain1;
+                context[2].crc = chain2;
+                context[3].crc = chain3;
+
+                /* Tail And Final */
+                for(lane = 0; lane < CRC16_MANY_LANE_COUNT; lane++)
+                {
+                    context[lane].length = length;
+                    crc16_contextUpdate(&context[lane], data[lane] + length, DataLength[i + lane] - length);
+                    crc[i + lane] = crc16_contextFinal(&context[lane]);
+                }
+            }
+        }
+
+        /* Remainder (Other Engines Already Break The Dependency Chain Within A Buffer) */
+        for(; i < Count; i++)
+            crc[i] = crc16_calculate(Configuration, Data[i], DataLength[i]);
+    }
+}
+
 /*** Calculate Partial ***/
 uint16_t crc16_calculatePartial(const crc16_configuration_t * const Configuration, uint16_t crc, const uint8_t Data, const bool First, const bool Last)
 {
@@ -161,6 +360,337 @@ uint16_t crc16_calculatePartial(const crc16_configuration_t * const Configuratio
     return crc;
 }
 
+#ifdef CRC_IOVEC_AVAILABLE
+/*** Calculate Vector ***/
+uint16_t crc16_calculateV(const crc16_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount)
+{
+    /*** Calculate Vector ***/
+    /* Variable */
+    crc16_context_t context;
+    uint16_t crc;
+    size_t i;
+
+    /* Set Up */
+    crc = 0x0000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Vector != NULL))
+    {
+        /* Calculate (No Copy, Each Segment Goes Through The Bulk Engine, CRC Carried Across Segments) */
+        crc16_contextInit(&context, Configuration);
+        for(i = 0; i < VectorCount; i++)
+            crc16_contextUpdate(&context, Vector[i].iov_base, Vector[i].iov_len);
+        crc = crc16_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+#endif
+
+/*** Combine ***/
+uint16_t crc16_combine(const crc16_configuration_t * const Configuration, uint16_t crcA, const uint64_t LengthA, uint16_t crcB, const uint64_t LengthB)
+{
+    /*** Combine ***/
+    /* Variable */
+    uint16_t crc;
+
+    /* Set Up */
+    crc = 0x0000;
+
+    /* Error Check */
+    if(Configuration != NULL)
+    {
+        /* Set Up */
+        crc = (LengthA > 0) ? crcA : crcB;
+
+        /* Combine (Empty Input Calculates To Initial, Not A Shiftable Register, So An Empty Side Passes The Other Through) */
+        if((LengthA > 0) && (LengthB > 0))
+        {
+            /* Undo Last */
+            if(Configuration->reflectOut)
+            {
+                crcA = misc_reflect16(crcA);
+                crcB = misc_reflect16(crcB);
+            }
+            crcA ^= Configuration->xorOut;
+            crcB ^= Configuration->xorOut;
+
+            /* Combine (B Already Carries Initial Shifted Over Its Length, So Only A ^ Initial Is Shifted In) */
+            crc = (uint16_t)crc_shift(crcA ^ Configuration->initial, Configuration->polynomial, 16, LengthB) ^ crcB;
+
+            /* Last */
+            crc ^= Configuration->xorOut;
+            if(Configuration->reflectOut)
+                crc = misc_reflect16(crc);
+        }
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Context Final ***/
+uint16_t crc16_contextFinal(const crc16_context_t * const Context)
+{
+    /*** Context Final ***/
+    /* Variable */
+    uint16_t crc;
+
+    /* Set Up */
+    crc = 0x0000;
+
+    /* Error Check */
+    if((Context != NULL) && (Context->Configuration != NULL))
+    {
+        /* Set Up (Nothing Consumed Returns Initial, Same As Calculate) */
+        crc = Context->Configuration->initial;
+
+        /* Last */
+        if(Context->length > 0)
+        {
+            crc = Context->crc ^ Context->Configuration->xorOut;
+            if((Context->Configuration->lookupTable == NULL) && Context->Configuration->reflectOut)
+                crc = misc_reflect16(crc);
+        }
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Context Initialize ***/
+void crc16_contextInit(crc16_context_t * const context, const crc16_configuration_t * const Configuration)
+{
+    /*** Context Initialize ***/
+    /* Error Check */
+    if((context != NULL) && (Configuration != NULL))
+    {
+        /* Initialize */
+        context->Configuration = Configuration;
+        context->crc = Configuration->initial;
+        if((Configuration->lookupTable != NULL) && Configuration->reflectIn)
+            context->crc = misc_reflect16(context->crc);
+        context->length = 0;
+    }
+}
+
+/*** Context Update ***/
+void crc16_contextUpdate(crc16_context_t * const context, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Context Update ***/
+    /* Error Check */
+    if((context != NULL) && (context->Configuration != NULL) && (Data != NULL))
+    {
+        /* Update */
+        context->crc = crc16_update(context->Configuration, context->crc, Data, DataLength);
+        context->length += DataLength;
+    }
+}
+
+/*** Copy And Calculate ***/
+uint16_t crc16_copyAndCalculate(const crc16_configuration_t * const Configuration, uint8_t * const destination, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal)
+{
+    /*** Copy And Calculate ***/
+    /* Variable */
+    size_t blockLength;
+    crc16_context_t context;
+    uint16_t crc;
+    size_t i;
+
+    /* Set Up */
+    crc = 0x0000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (destination != NULL) && (Source != NULL))
+    {
+        /* Copy And Calculate (Each Block Is Checksummed While Still In Cache From The Copy) */
+        crc16_contextInit(&context, Configuration);
+        for(i = 0; i < DataLength; i += blockLength)
+        {
+            blockLength = ((DataLength - i) < CRC_COPY_BLOCK_SIZE) ? (DataLength - i) : CRC_COPY_BLOCK_SIZE;
+            crc_copy(destination + i, Source + i, blockLength, NonTemporal);
+            crc16_contextUpdate(&context, Source + i, blockLength);
+        }
+        crc = crc16_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Copy And Calculate And Append ***/
+void crc16_copyAndCalculateAndAppend(const crc16_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal)
+{
+    /*** Copy And Calculate And Append ***/
+    /* Variable */
+    uint16_t crc;
+
+    /* Set Up */
+    crc = 0x0000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (destination != NULL) && (Source != NULL) && (DestinationLength >= (DataLength + sizeof(crc))))
+    {
+        /* Copy, Calculate, And Append */
+        crc = crc16_copyAndCalculate(Configuration, destination, Source, DataLength, NonTemporal);
+        misc_insert16(destination + DataLength, DestinationLength - DataLength, crc, !Configuration->reflectOut);
+    }
+}
+
+/*** Correct ***/
+bool crc16_correct(const crc16_correction_t * const Correction, uint8_t * const buffer, const size_t BufferLength, size_t * const corrected)
+{
+    /*** Correct ***/
+    /* Variable */
+    size_t bitCount;
+    size_t candidateCount;
+    size_t distance[2];
+    size_t flipped;
+    size_t i;
+    size_t match;
+    bool success;
+    uint16_t syndrome;
+
+    /* Set Up */
+    flipped = 0;
+    success = false;
+
+    /* Error Check */
+    if((Correction != NULL) && (Correction->entry != NULL) && (buffer != NULL) && (BufferLength > sizeof(uint16_t)) && (BufferLength <= Correction->maximumLength))
+    {
+        /* Syndrome (Zero When The Frame Verifies, Otherwise The CRC Of The Error Pattern Alone) */
+        syndrome = crc16_calculate(Correction->Configuration, buffer, BufferLength) ^ Correction->Configuration->xorOut ^ Correction->Configuration->residue;
+        bitCount = 8 * BufferLength;
+        if(syndrome == 0)
+        {
+            success = true;
+        }
+
+        /* Single Bit (One Probe, Refused Without Trying Pairs When Several Bits Share The Syndrome) */
+        else if((match = crc16_correctionFind(Correction, syndrome, bitCount)) > 0)
+        {
+            if(match != CRC16_CORRECTION_AMBIGUOUS)
+            {
+                crc16_correctionFlip(Correction, buffer, bitCount, match - 1);
+                flipped = 1;
+                success = true;
+            }
+        }
+
+        /* Double Bit (One Probe Per Bit, Accepted Only When Exactly One Pair Explains The Syndrome, An Ambiguous Partner Counts As Several) */
+        else if(Correction->syndrome != NULL)
+        {
+            candidateCount = 0;
+            for(i = 0; (i < bitCount) && (candidateCount < 2); i++)
+            {
+                match = crc16_correctionFind(Correction, syndrome ^ Correction->syndrome[i], bitCount);
+                if(match == CRC16_CORRECTION_AMBIGUOUS)
+                {
+                    candidateCount = 2;
+                }
+                else if(match > (i + 1))
+                {
+                    distance[0] = i;
+                    distance[1] = match - 1;
+                    candidateCount++;
+                }
+            }
+            if(candidateCount == 1)
+            {
+                crc16_correctionFlip(Correction, buffer, bitCount, distance[0]);
+                crc16_correctionFlip(Correction, buffer, bitCount, distance[1]);
+                flipped = 2;
+                success = true;
+            }
+        }
+    }
+
+    /* Exit */
+    if(corrected != NULL)
+        *corrected = flipped;
+    return success;
+}
+
+/*** Correction Deinitialize ***/
+void crc16_correctionDeinit(crc16_correction_t * const correction)
+{
+    /*** Correction Deinitialize ***/
+    /* Error Check */
+    if(correction != NULL)
+    {
+        /* Deinitialize */
+        if(correction->entry != NULL)
+            memory_free((void **)&correction->entry);
+        if(correction->syndrome != NULL)
+            memory_free((void **)&correction->syndrome);
+        correction->maximumLength = 0;
+    }
+}
+
+/*** Correction Initialize ***/
+bool crc16_correctionInit(crc16_correction_t * const correction, const crc16_configuration_t * const Configuration, const size_t MaximumLength, const bool DoubleBit)
+{
+    /*** Correction Initialize ***/
+    /* Variable */
+    size_t bitCount;
+    size_t distance;
+    size_t index;
+    uint16_t remainder;
+    size_t size;
+    bool success;
+    uint16_t syndrome;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check (Distances Must Fit In 32 Bits) */
+    if((correction != NULL) && (Configuration != NULL) && (MaximumLength > sizeof(uint16_t)) && (MaximumLength < (UINT32_MAX / 8)))
+    {
+        /* Table (At Most Half Full) */
+        memset(correction, 0, sizeof(*correction));
+        bitCount = 8 * MaximumLength;
+        for(size = 1; size < (2 * bitCount); size <<= 1)
+            ;
+        if((correction->entry = memory_malloc(size * sizeof(crc16_correctionEntry_t))) != NULL)
+        {
+            memset(correction->entry, 0, size * sizeof(crc16_correctionEntry_t));
+            correction->Configuration = Configuration;
+            correction->mask = size - 1;
+            correction->maximumLength = MaximumLength;
+            success = !DoubleBit || ((correction->syndrome = memory_malloc(bitCount * sizeof(uint16_t))) != NULL);
+        }
+
+        /* Syndromes (Bit d From The End Leaves x^(d + 16) Mod P, Each One Shift Of The Last, Linear In The Frame Length) */
+        remainder = Configuration->polynomial;
+        for(distance = 0; success && (distance < bitCount); distance++)
+        {
+            syndrome = Configuration->reflectOut ? misc_reflect16(remainder) : remainder;
+            if(correction->syndrome != NULL)
+                correction->syndrome[distance] = syndrome;
+            for(index = syndrome & correction->mask; (correction->entry[index].distance != 0) && (correction->entry[index].syndrome != syndrome); index = (index + 1) & correction->mask)
+                ;
+            if(correction->entry[index].distance == 0)
+            {
+                correction->entry[index].distance = (uint32_t)(distance + 1);
+                correction->entry[index].syndrome = syndrome;
+            }
+            else if(correction->entry[index].collision == 0)
+            {
+                correction->entry[index].collision = (uint32_t)(distance + 1); // Shorter Frames Still Resolve It
+            }
+            remainder = (remainder & 0x8000) ? ((remainder << 1) ^ Configuration->polynomial) : (remainder << 1);
+        }
+
+        /* Clean Up */
+        if(!success)
+            crc16_correctionDeinit(correction);
+    }
+
+    /* Exit */
+    return success;
+}
+
 /*** Deinitialize ***/
 void crc16_deinit(crc16_configuration_t * const configuration)
 {
@@ -168,20 +698,45 @@ void crc16_deinit(crc16_configuration_t * const configuration)
     /* Error Check */
     if(configuration != NULL)
     {
-        /* Deinitialize */
-        memory_free((void **)&(configuration->lookupTable));
+        /* Deinitialize (Lookup Table Is Read Only, Nothing To Free) */
         memset(configuration, 0, sizeof(*configuration));
     }
 }
 
+/*** Fork ***/
+uint16_t crc16_fork(const crc16_context_t * const Snapshot, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Fork ***/
+    /* Variable */
+    crc16_context_t context;
+    uint16_t crc;
+
+    /* Set Up */
+    crc = 0x0000;
+
+    /* Error Check */
+    if((Snapshot != NULL) && (Snapshot->Configuration != NULL) && ((Data != NULL) || (DataLength == 0)))
+    {
+        /* Resume (The Snapshot Is Only Read, So One Prefix Serves Any Number Of Frames) */
+        context = *Snapshot;
+        if(DataLength > 0)
+            crc16_contextUpdate(&context, Data, DataLength);
+        crc = crc16_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+
 /*** Initialize ***/
-void crc16_init(const char * const Name, crc16_configuration_t * const configuration, const bool CreateLookupTable)
+void crc16_init(const char * const Name, crc16_configuration_t * const configuration, const crc16_engine_t Engine)
 {
     /*** Initialize ***/
     /* Variable */
+    const crc_name_t *algorithm;
+    crc16_engine_t engine;
     bool found;
-    size_t i, j;
-    uint16_t *lookupTable;
+    size_t i;
 
     /* Set Up */
     found = false;
@@ -189,33 +744,12 @@ void crc16_init(const char * const Name, crc16_configuration_t * const configura
     /* Error Check */
     if((Name != NULL) && (configuration != NULL))
     {
-        /* Algorithm */
-        for(i = 0; i < crc16_ConfigurationCount; i++)
+        /* Algorithm (Perfect Hash Over Every Width, Width Must Match) */
+        if(((algorithm = crc_lookup(Name)) != NULL) && (algorithm->width == 16))
         {
-            /* Name */
-            if(strcmp(Name, crc16_Configuration[i].Name) == 0)
-            {
-                /* Found */
-                found = true;
-                break;
-            }
-            else
-            {
-                /* Alias */
-                for(j = 0; j < crc16_Configuration[i].aliasCount; j++)
-                {
-                    if(strcmp(Name, crc16_Configuration[i].Alias[j]) == 0)
-                    {
-                        /* Found */
-                        found = true;
-                        break;
-                    }
-                }
-
-                /* Found */
-                if(found)
-                    break;
-            }
+            /* Found */
+            found = true;
+            i = algorithm->index;
         }
 
         /* Found */
@@ -224,16 +758,29 @@ void crc16_init(const char * const Name, crc16_configuration_t * const configura
             /* Copy */
             (void)memcpy(configuration, &crc16_Configuration[i], sizeof(crc16_Configuration[i]));
 
-            /* Generate Lookup Table */
-            if(CreateLookupTable)
+            /* Engine (Tier Override Wins, Automatic Picks The Fastest This CPU Supports) */
+            engine = crc16_selectEngine(configuration, Engine);
+
+            /* Lookup Table (Generated At Build Time, Shared Read Only) */
+            if((engine == CRC16_ENGINE_LOOKUP_TABLE) || (engine == CRC16_ENGINE_CLMUL))
             {
-                if((lookupTable = memory_malloc(CRC16_LOOKUP_TABLE_MEMORY_SIZE)) != NULL)
+                /* Set */
+                configuration->engine = engine;
+                configuration->lookupTable = crc16_LookupTable[i];
+
+                /* Carry-Less Multiplication (Lookup Table Handles Short Tails And CPUs Without Support) */
+                if(engine == CRC16_ENGINE_CLMUL)
                 {
-                    for(i = 0; i < 256; i++)
-                        lookupTable[i] = crc16_calculatePartial(configuration, 0x0000, (uint8_t)i, true, true) ^ configuration->xorOut;
-                    configuration->lookupTable = lookupTable;
+                    if(crc_clmulSupported())
+                        crc_clmulInit(&configuration->clmul, configuration->polynomial, 16, configuration->reflectIn);
+                    else
+                        configuration->engine = CRC16_ENGINE_LOOKUP_TABLE;
                 }
             }
+
+            /* Kernel (Specialized Lookup Table Calculate) */
+            if(configuration->engine == CRC16_ENGINE_LOOKUP_TABLE)
+                configuration->kernel = crc16_Kernel[i];
         }
         else
         {
@@ -243,6 +790,63 @@ void crc16_init(const char * const Name, crc16_configuration_t * const configura
     }
 }
 
+/*** Patch ***/
+uint16_t crc16_patch(const crc16_configuration_t * const Configuration, const uint16_t OldCrc, const size_t Offset, const uint8_t * const OldData, const uint8_t * const NewData, const size_t DataLength, const size_t TotalLength)
+{
+    /*** Patch ***/
+    /* Variable */
+    uint16_t crc;
+    uint8_t delta[64];
+    uint16_t deltaCrc;
+    size_t i, j, length;
+    bool reflected;
+
+    /* Set Up */
+    crc = OldCrc;
+
+    /* Error Check */
+    if((Configuration != NULL) && (OldData != NULL) && (NewData != NULL) && (Offset <= TotalLength) && (DataLength <= (TotalLength - Offset)))
+    {
+        /* Delta (CRC Is Linear, So Only The XOR Of The Changed Bytes From A Zero Register Matters) */
+        deltaCrc = 0x0000;
+        for(i = 0; i < DataLength; i += length)
+        {
+            length = ((DataLength - i) < sizeof(delta)) ? (DataLength - i) : sizeof(delta);
+            for(j = 0; j < length; j++)
+                delta[j] = OldData[i + j] ^ NewData[i + j];
+            deltaCrc = crc16_update(Configuration, deltaCrc, delta, length);
+        }
+
+        /* Shift Over The Bytes After The Patch (Table Engines Keep A Reflected Register) */
+        reflected = ((Configuration->lookupTable != NULL) && Configuration->reflectIn);
+        if(reflected)
+            deltaCrc = misc_reflect16(deltaCrc);
+        deltaCrc = (uint16_t)crc_shift(deltaCrc, Configuration->polynomial, 16, TotalLength - Offset - DataLength);
+
+        /* Apply (xorOut Cancels Out, Reflection Distributes Over XOR) */
+        if(reflected || ((Configuration->lookupTable == NULL) && Configuration->reflectOut))
+            deltaCrc = misc_reflect16(deltaCrc);
+        crc ^= deltaCrc;
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Snapshot ***/
+void crc16_snapshot(const crc16_configuration_t * const Configuration, const uint8_t *Prefix, const size_t PrefixLength, crc16_context_t * const snapshot)
+{
+    /*** Snapshot ***/
+    /* Error Check */
+    if((Configuration != NULL) && ((Prefix != NULL) || (PrefixLength == 0)) && (snapshot != NULL))
+    {
+        /* Prefix (Register State After The Shared Header, Resumed By Fork Or By Copying Into A Context) */
+        crc16_contextInit(snapshot, Configuration);
+        if(PrefixLength > 0)
+            crc16_contextUpdate(snapshot, Prefix, PrefixLength);
+    }
+}
+
 /*** Verify ***/
 bool crc16_verify(const crc16_configuration_t * const Configuration, const uint8_t *Buffer, const size_t BufferLength)
 {
@@ -264,3 +868,271 @@ bool crc16_verify(const crc16_configuration_t * const Configuration, const uint8
     /* Exit */
     return verified;
 }
+
+/*** Verify List ***/
+bool crc16_verifyList(const crc16_configuration_t * const Configuration, const list_list_t * const List)
+{
+    /*** Verify List ***/
+    /* Variable */
+    uint16_t crc;
+    bool verified;
+
+    /* Set Up */
+    verified = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (List != NULL))
+    {
+        /* Verify */
+        crc = crc16_calculateList(Configuration, List);
+        verified = ((crc ^ Configuration->xorOut) == Configuration->residue);
+    }
+
+    /* Exit */
+    return verified;
+}
+
+/*** Verify Many ***/
+size_t crc16_verifyMany(const crc16_configuration_t * const Configuration, const uint8_t * const Buffer[], const size_t BufferLength[], uint8_t * const verified, const size_t Count)
+{
+    /*** Verify Many ***/
+    /* Variable */
+    uint16_t crc[8 * CRC16_MANY_LANE_COUNT];
+    size_t chunk, i, j, verifiedCount;
+
+    /* Set Up */
+    verifiedCount = 0;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Buffer != NULL) && (BufferLength != NULL) && (verified != NULL))
+    {
+        /* Clear */
+        memset(verified, 0, CRC16_MANY_BITMAP_SIZE(Count));
+
+        /* Verify (Whole Bitmap Bytes Per Chunk) */
+        for(i = 0; i < Count; i += chunk)
+        {
+            chunk = ((Count - i) < (sizeof(crc) / sizeof(crc[0]))) ? (Count - i) : (sizeof(crc) / sizeof(crc[0]));
+            crc16_calculateMany(Configuration, &Buffer[i], &BufferLength[i], crc, chunk);
+            for(j = 0; j < chunk; j++)
+            {
+                if((Buffer[i + j] != NULL) && ((crc[j] ^ Configuration->xorOut) == Configuration->residue))
+                {
+                    verified[(i + j) / 8] |= (uint8_t)(1 << ((i + j) % 8));
+                    verifiedCount++;
+                }
+            }
+        }
+    }
+
+    /* Exit */
+    return verifiedCount;
+}
+
+#ifdef CRC_IOVEC_AVAILABLE
+/*** Verify Vector ***/
+bool crc16_verifyV(const crc16_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount)
+{
+    /*** Verify Vector ***/
+    /* Variable */
+    uint16_t crc;
+    bool verified;
+
+    /* Set Up */
+    verified = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Vector != NULL))
+    {
+        /* Verify */
+        crc = crc16_calculateV(Configuration, Vector, VectorCount);
+        verified = ((crc ^ Configuration->xorOut) == Configuration->residue);
+    }
+
+    /* Exit */
+    return verified;
+}
+#endif
+
+/*** Kernels ***/
+CRC16_KERNEL_LIST(CRC16_KERNEL_DEFINITION)
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/*** Correction Find ***/
+static size_t crc16_correctionFind(const crc16_correction_t * const Correction, const uint16_t Syndrome, const size_t BitCount)
+{
+    /*** Correction Find ***/
+    /* Variable */
+    size_t distance;
+    size_t index;
+
+    /* Find */
+    for(index = Syndrome & Correction->mask; (Correction->entry[index].distance != 0) && (Correction->entry[index].syndrome != Syndrome); index = (index + 1) & Correction->mask)
+        ;
+
+    /* Distance Plus 1, 0 When Absent Or Outside The Frame, Ambiguous When Shared With Another Bit Inside It */
+    distance = Correction->entry[index].distance;
+    if(distance > BitCount)
+        distance = 0;
+    else if((distance != 0) && (Correction->entry[index].collision != 0) && (Correction->entry[index].collision <= BitCount))
+        distance = CRC16_CORRECTION_AMBIGUOUS;
+
+    /* Exit */
+    return distance;
+}
+
+/*** Correction Flip ***/
+static void crc16_correctionFlip(const crc16_correction_t * const Correction, uint8_t * const buffer, const size_t BitCount, const size_t Distance)
+{
+    /*** Correction Flip ***/
+    /* Variable */
+    size_t bit;
+
+    /* Flip (Bits Enter Least Significant First When Reflected In) */
+    bit = BitCount - 1 - Distance;
+    buffer[bit / 8] ^= (uint8_t)(Correction->Configuration->reflectIn ? (1 << (bit % 8)) : (0x80 >> (bit % 8)));
+}
+
+#ifdef CRC_FILE_AVAILABLE
+/*** File Update ***/
+static void crc16_fileUpdate(void * const context, const uint8_t *Data, const size_t DataLength)
+{
+    /*** File Update ***/
+    /* Update */
+    crc16_contextUpdate(context, Data, DataLength);
+}
+#endif
+
+/*** Kernel ***/
+static CRC_ALWAYS_INLINE uint16_t crc16_kernel(const uint16_t * const LookupTable, const uint16_t Initial, const uint16_t TableInitial, const bool ReflectIn, const uint16_t XorOut, const uint8_t *Data, size_t dataLength)
+{
+    /*** Kernel ***/
+    /* Variable */
+    uint16_t crc;
+
+    /* Set Up (Nothing Consumed Returns Initial, Same As Calculate) */
+    crc = 0x0000;
+
+    /* Error Check */
+    if(Data != NULL)
+    {
+        /* Set Up */
+        crc = Initial;
+
+        /* Lookup Table (Every Argument Is A Constant From The Kernel List, Folded At Compile Time) */
+        if(dataLength > 0)
+        {
+            crc = TableInitial;
+            if(ReflectIn)
+            {
+                while(dataLength-- > 0)
+                    crc = (crc >> 8) ^ LookupTable[(crc ^ *Data++) & 0xFF];
+            }
+            else
+            {
+                while(dataLength-- > 0)
+                    crc = (uint16_t)((crc << 8) ^ LookupTable[(crc >> 8) ^ *Data++]);
+            }
+            crc ^= XorOut;
+        }
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Select Engine ***/
+static crc16_engine_t crc16_selectEngine(const crc16_configuration_t * const Configuration, const crc16_engine_t Engine)
+{
+    /*** Select Engine ***/
+    /* Variable */
+    crc16_engine_t engine;
+
+    /* Unused */
+    (void)Configuration;
+
+    /* Tier Override (No Slicing Or Hardware At This Width, Lookup Table Stands In) */
+    switch(crc_tierGet())
+    {
+        case CRC_TIER_LOOP:
+            engine = CRC16_ENGINE_LOOP;
+            break;
+        case CRC_TIER_LOOKUP_TABLE:
+        case CRC_TIER_SLICING:
+        case CRC_TIER_HARDWARE:
+            engine = CRC16_ENGINE_LOOKUP_TABLE;
+            break;
+        case CRC_TIER_CLMUL:
+            engine = CRC16_ENGINE_CLMUL;
+            break;
+        default:
+            engine = Engine;
+            break;
+    }
+
+    /* Automatic (Carry-Less Multiplication, Falls Back To Lookup Table Without Support) */
+    if(engine == CRC16_ENGINE_AUTOMATIC)
+        engine = CRC16_ENGINE_CLMUL;
+
+    /* Exit */
+    return engine;
+}
+
+/*** Update ***/
+static uint16_t crc16_update(const crc16_configuration_t * const Configuration, uint16_t crc, const uint8_t *Data, size_t dataLength)
+{
+    /*** Update ***/
+    /* Variable */
+    size_t bit, length;
+    const uint16_t *LookupTable;
+
+    /* Set Up */
+    LookupTable = Configuration->lookupTable;
+
+    /* Carry-Less Multiplication */
+    if((Configuration->engine == CRC16_ENGINE_CLMUL) && (dataLength >= CRC_CLMUL_MINIMUM_LENGTH))
+    {
+        length = dataLength - (dataLength % CRC_CLMUL_BLOCK_SIZE);
+        crc = (uint16_t)crc_clmulUpdate(&Configuration->clmul, crc, Data, length);
+        Data += length;
+        dataLength -= length;
+    }
+
+    /* Byte At A Time */
+    if(LookupTable == NULL)
+    {
+        /* Loop */
+        while(dataLength-- > 0)
+        {
+            if(Configuration->reflectIn)
+                crc ^= ((uint16_t)misc_reflect8(*Data++) << 8);
+            else
+                crc ^= ((uint16_t)*Data++ << 8);
+            for(bit = 0; bit < 8; bit++)
+            {
+                if((crc & 0x8000) == 0x8000)
+                    crc = (uint16_t)((crc << 1) ^ Configuration->polynomial);
+                else
+                    crc <<= 1;
+            }
+        }
+    }
+    else if(Configuration->reflectIn)
+    {
+        /* Lookup Table (Reflected) */
+        while(dataLength-- > 0)
+            crc = (crc >> 8) ^ LookupTable[(crc ^ *Data++) & 0xFF];
+    }
+    else
+    {
+        /* Lookup Table */
+        while(dataLength-- > 0)
+            crc = (uint16_t)((crc << 8) ^ LookupTable[(crc >> 8) ^ *Data++]);
+    }
+
+    /* Exit */
+    return crc;
+}
@@ -8,14 +8,21 @@
  * Defines
  ****************************************************************************************************/
 
+#define CRC16_CORRECTION_AMBIGUOUS (SIZE_MAX) // Correction Find, Several Bits In The Frame Share The Syndrome
+#define CRC16_KERNEL_PROTOTYPE(IDENTIFIER, INDEX, INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT) extern uint16_t crc16_##IDENTIFIER##_calculate(const uint8_t *Data, const size_t DataLength);
 #define CRC16_LOOKUP_TABLE_COUNT (256)
 #define CRC16_LOOKUP_TABLE_MEMORY_SIZE (CRC16_LOOKUP_TABLE_COUNT * sizeof(uint16_t))
+#define CRC16_MANY_BITMAP_SIZE(COUNT) (((COUNT) + 7) / 8) // Verify Many, Bit (i % 8) Of Byte (i / 8) Per Buffer
+#define CRC16_MANY_LANE_COUNT (4) // Calculate Many Interleaves Exactly Four Chains
 #define CRC16_MAXIMUM_ALIAS_COUNT (6)
 
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc16_kernel.h"
+#include "Eclectic/Data/list.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -24,14 +31,29 @@
  * Type Definitions
  ****************************************************************************************************/
 
+/*** Enumerations ***/
+typedef enum crc16_engine_e
+{
+    CRC16_ENGINE_LOOP,
+    CRC16_ENGINE_LOOKUP_TABLE,
+    CRC16_ENGINE_CLMUL,
+    CRC16_ENGINE_AUTOMATIC
+} crc16_engine_t;
+
+/*** Callbacks ***/
+typedef uint16_t (*crc16_kernelCallback_t)(const uint8_t *Data, const size_t DataLength);
+
 /*** Structures ***/
 typedef struct crc16_configuration_s
 {
     char *Alias[CRC16_MAXIMUM_ALIAS_COUNT];
     size_t aliasCount;
     uint16_t check;
+    crc_clmul_t clmul;
+    crc16_engine_t engine;
     uint16_t initial;
-    uint16_t *lookupTable;
+    crc16_kernelCallback_t kernel;
+    const uint16_t *lookupTable;
     char *Name;
     uint16_t polynomial;
     bool reflectIn;
@@ -40,13 +62,72 @@ typedef struct crc16_configuration_s
     uint16_t xorOut;
 } crc16_configuration_t;
 
+typedef struct crc16_context_s
+{
+    const crc16_configuration_t *Configuration;
+    uint16_t crc;
+    uint64_t length;
+} crc16_context_t;
+
+typedef struct crc16_correctionEntry_s
+{
+    uint32_t collision; // Distance Plus 1 Of The Nearest Other Bit With This Syndrome, 0 When Unique, Frames Of At Least That Many Bits Are Ambiguous
+    uint32_t distance; // Bits From The Last Bit Of The Frame Plus 1, 0 When Empty
+    uint16_t syndrome;
+} crc16_correctionEntry_t;
+
+typedef struct crc16_correction_s
+{
+    const crc16_configuration_t *Configuration;
+    crc16_correctionEntry_t *entry; // Open Addressing, Syndrome Of One Flipped Bit To Its Distance
+    size_t mask;
+    size_t maximumLength;
+    uint16_t *syndrome; // By Distance, Double Bit Correction Only
+} crc16_correction_t;
+
+/****************************************************************************************************
+ * Constants
+ ****************************************************************************************************/
+
+extern const crc16_configuration_t crc16_Configuration[]; // Catalog, One Entry Per Algorithm (Aliases Folded In)
+extern const size_t crc16_ConfigurationCount;
+
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
 extern uint16_t crc16_calculate(const crc16_configuration_t * const Configuration, const uint8_t *Data, const size_t DataLength);
 extern void crc16_calculateAndAppend(const crc16_configuration_t * const Configuration, uint8_t * const buffer, const size_t BufferLength, const size_t DataLength);
+#ifdef CRC_FILE_AVAILABLE
+extern bool crc16_calculateFile(const crc16_configuration_t * const Configuration, const char * const Path, uint16_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+extern bool crc16_calculateFileDescriptor(const crc16_configuration_t * const Configuration, const int FileDescriptor, uint16_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+#endif
+extern uint16_t crc16_calculateList(const crc16_configuration_t * const Configuration, const list_list_t * const List);
+extern void crc16_calculateMany(const crc16_configuration_t * const Configuration, const uint8_t * const Data[], const size_t DataLength[], uint16_t crc[], const size_t Count);
 extern uint16_t crc16_calculatePartial(const crc16_configuration_t * const Configuration, uint16_t crc, const uint8_t Data, const bool First, const bool Last);
+#ifdef CRC_IOVEC_AVAILABLE
+extern uint16_t crc16_calculateV(const crc16_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount);
+#endif
+extern uint16_t crc16_combine(const crc16_configuration_t * const Configuration, uint16_t crcA, const uint64_t LengthA, uint16_t crcB, const uint64_t LengthB);
+extern uint16_t crc16_contextFinal(const crc16_context_t * const Context);
+extern void crc16_contextInit(crc16_context_t * const context, const crc16_configuration_t * const Configuration);
+extern void crc16_contextUpdate(crc16_context_t * const context, const uint8_t *Data, const size_t DataLength);
+extern uint16_t crc16_copyAndCalculate(const crc16_configuration_t * const Configuration, uint8_t * const destination, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal);
+extern void crc16_copyAndCalculateAndAppend(const crc16_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal);
+extern bool crc16_correct(const crc16_correction_t * const Correction, uint8_t * const buffer, const size_t BufferLength, size_t * const corrected);
+extern void crc16_correctionDeinit(crc16_correction_t * const correction);
+extern bool crc16_correctionInit(crc16_correction_t * const correction, const crc16_configuration_t * const Configuration, const size_t MaximumLength, const bool DoubleBit);
 extern void crc16_deinit(crc16_configuration_t * const configuration);
-extern void crc16_init(const char * const Name, crc16_configuration_t * const configuration, const bool CreateLookupTable);
+extern uint16_t crc16_fork(const crc16_context_t * const Snapshot, const uint8_t *Data, const size_t DataLength);
+extern void crc16_init(const char * const Name, crc16_configuration_t * const configuration, const crc16_engine_t Engine);
+extern uint16_t crc16_patch(const crc16_configuration_t * const Configuration, const uint16_t OldCrc, const size_t Offset, const uint8_t * const OldData, const uint8_t * const NewData, const size_t DataLength, const size_t TotalLength);
+extern void crc16_snapshot(const crc16_configuration_t * const Configuration, const uint8_t *Prefix, const size_t PrefixLength, crc16_context_t * const snapshot);
 extern bool crc16_verify(const crc16_configuration_t * const Configuration, const uint8_t *Buffer, const size_t BufferLength);
+extern bool crc16_verifyList(const crc16_configuration_t * const Configuration, const list_list_t * const List);
+extern size_t crc16_verifyMany(const crc16_configuration_t * const Configuration, const uint8_t * const Buffer[], const size_t BufferLength[], uint8_t * const verified, const size_t Count);
+#ifdef CRC_IOVEC_AVAILABLE
+extern bool crc16_verifyV(const crc16_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount);
+#endif
+
+/* Kernels (One Per Catalog Entry, e.g. crc16_modbus_calculate) */
+CRC16_KERNEL_LIST(CRC16_KERNEL_PROTOTYPE)
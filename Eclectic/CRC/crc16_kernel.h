@@ -0,0 +1,42 @@
+/****************************************************************************************************
+ * Pragmas
+ ****************************************************************************************************/
+
+#pragma once
+
+/****************************************************************************************************
+ * Defines (Generated By Project/Script/crc_table.py, Do Not Edit)
+ ****************************************************************************************************/
+
+#define CRC16_KERNEL_LIST(KERNEL) \
+    KERNEL(arc, 0, 0x0000, 0x0000, true, 0x0000) \
+    KERNEL(cdma2000, 1, 0xFFFF, 0xFFFF, false, 0x0000) \
+    KERNEL(cms, 2, 0xFFFF, 0xFFFF, false, 0x0000) \
+    KERNEL(dds_110, 3, 0x800D, 0x800D, false, 0x0000) \
+    KERNEL(dect_r, 4, 0x0000, 0x0000, false, 0x0001) \
+    KERNEL(dect_x, 5, 0x0000, 0x0000, false, 0x0000) \
+    KERNEL(dnp, 6, 0x0000, 0x0000, true, 0xFFFF) \
+    KERNEL(en_13757, 7, 0x0000, 0x0000, false, 0xFFFF) \
+    KERNEL(genibus, 8, 0xFFFF, 0xFFFF, false, 0xFFFF) \
+    KERNEL(gsm, 9, 0x0000, 0x0000, false, 0xFFFF) \
+    KERNEL(ibm_3740, 10, 0xFFFF, 0xFFFF, false, 0x0000) \
+    KERNEL(ibm_sdlc, 11, 0xFFFF, 0xFFFF, true, 0xFFFF) \
+    KERNEL(iso_iec_14443_3_a, 12, 0xC6C6, 0x6363, true, 0x0000) \
+    KERNEL(kermit, 13, 0x0000, 0x0000, true, 0x0000) \
+    KERNEL(lj1200, 14, 0x0000, 0x0000, false, 0x0000) \
+    KERNEL(m17, 15, 0xFFFF, 0xFFFF, false, 0x0000) \
+    KERNEL(maxim_dow, 16, 0x0000, 0x0000, true, 0xFFFF) \
+    KERNEL(mcrf4xx, 17, 0xFFFF, 0xFFFF, true, 0x0000) \
+    KERNEL(modbus, 18, 0xFFFF, 0xFFFF, true, 0x0000) \
+    KERNEL(nrsc_5, 19, 0xFFFF, 0xFFFF, true, 0x0000) \
+    KERNEL(opensafety_a, 20, 0x0000, 0x0000, false, 0x0000) \
+    KERNEL(opensafety_b, 21, 0x0000, 0x0000, false, 0x0000) \
+    KERNEL(profibus, 22, 0xFFFF, 0xFFFF, false, 0xFFFF) \
+    KERNEL(riello, 23, 0xB2AA, 0x554D, true, 0x0000) \
+    KERNEL(spi_fujitsu, 24, 0x1D0F, 0x1D0F, false, 0x0000) \
+    KERNEL(t10_dif, 25, 0x0000, 0x0000, false, 0x0000) \
+    KERNEL(teledisk, 26, 0x0000, 0x0000, false, 0x0000) \
+    KERNEL(tms37157, 27, 0x89EC, 0x3791, true, 0x0000) \
+    KERNEL(umts, 28, 0x0000, 0x0000, false, 0x0000) \
+    KERNEL(usb, 29, 0xFFFF, 0xFFFF, true, 0xFFFF) \
+    KERNEL(xmodem, 30, 0x0000, 0x0000, false, 0x0000)
@@ -1,13 +1,33 @@
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CRC32_KERNEL_DEFINITION(IDENTIFIER, INDEX, INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT)                         \
+    uint32_t crc32_##IDENTIFIER##_calculate(const uint8_t *Data, const size_t DataLength)                                  \
+    {                                                                                                                  \
+        return crc32_kernel(crc32_LookupTable[INDEX], INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT, Data, DataLength); \
+    }
+#define CRC32_KERNEL_POINTER(IDENTIFIER, ...) crc32_##IDENTIFIER##_calculate,
+
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
+#include "Eclectic/CRC/crc.h"
 #include "Eclectic/CRC/crc32.h"
+#include "Eclectic/CRC/crc32_table.h"
 #include "Eclectic/Miscellaneous/memory.h"
 #include "Eclectic/Miscellaneous/misc.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#ifdef CRC_FILE_AVAILABLE
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#ifdef CRC_PTHREAD_AVAILABLE
+#include <pthread.h>
+#endif
 
 /****************************************************************************************************
  * Constants
@@ -15,19 +35,39 @@
 
 const crc32_configuration_t crc32_Configuration[] =
     {
-        {{"CRC-32Q"}, 1, 0x3010BF7F, 0x00000000, NULL, "CRC-32/AIXM", 0x814141AB, false, false, 0x00000000, 0x00000000},
-        {{}, 0, 0x1697D06A, 0xFFFFFFFF, NULL, "CRC-32/AUTOSAR", 0xF4ACFB13, true, true, 0x904CDDBF, 0xFFFFFFFF},
-        {{"CRC-32D"}, 1, 0x87315576, 0xFFFFFFFF, NULL, "CRC-32/BASE91-D", 0xA833982B, true, true, 0x45270551, 0xFFFFFFFF},
-        {{"CRC-32/AAL5", "CRC-32/DECT-B", "B-CRC-32"}, 3, 0xFC891918, 0xFFFFFFFF, NULL, "CRC-32/BZIP2", 0x04C11DB7, false, false, 0xC704DD7B, 0xFFFFFFFF},
-        {{}, 0, 0x6EC2EDC4, 0x00000000, NULL, "CRC-32/CD-ROM-EDC", 0x8001801B, true, true, 0x00000000, 0x00000000},
-        {{"CKSUM", "CRC-32/POSIX"}, 2, 0x765E7680, 0x00000000, NULL, "CRC-32/CKSUM", 0x04C11DB7, false, false, 0xC704DD7B, 0xFFFFFFFF},
-        {{"CRC-32/BASE91-C", "CRC-32/CASTAGNOLI", "CRC-32/INTERLAKEN", "CRC-32C", "CRC-32/NVME"}, 5, 0xE3069283, 0xFFFFFFFF, NULL, "CRC-32/ISCSI", 0x1EDC6F41, true, true, 0xB798B438, 0xFFFFFFFF},
-        {{"CRC-32", "CRC-32/ADCCP", "CRC-32/V-42", "CRC-32/XZ", "PKZIP"}, 5, 0xCBF43926, 0xFFFFFFFF, NULL, "CRC-32/ISO-HDLC", 0x04C11DB7, true, true, 0xDEBB20E3, 0xFFFFFFFF},
-        {{"JAMCRC"}, 1, 0x340BC6D9, 0xFFFFFFFF, NULL, "CRC-32/JAMCRC", 0x04C11DB7, true, true, 0x00000000, 0x00000000},
-        {{}, 0, 0xD2C22F51, 0xFFFFFFFF, NULL, "CRC-32/MEF", 0x741B8CD7, true, true, 0x00000000, 0x00000000},
-        {{}, 0, 0x0376E6E7, 0xFFFFFFFF, NULL, "CRC-32/MPEG-2", 0x04C11DB7, false, false, 0x00000000, 0x00000000},
-        {{"XFER"}, 1, 0xBD0BE338, 0x00000000, NULL, "CRC-32/XFER", 0x000000AF, false, false, 0x00000000, 0x00000000}};
+        {{"CRC-32Q"}, 1, 0x3010BF7F, {}, CRC32_ENGINE_LOOP, 0x00000000, NULL, NULL, "CRC-32/AIXM", 0x814141AB, false, false, 0x00000000, 0x00000000},
+        {{}, 0, 0x1697D06A, {}, CRC32_ENGINE_LOOP, 0xFFFFFFFF, NULL, NULL, "CRC-32/AUTOSAR", 0xF4ACFB13, true, true, 0x904CDDBF, 0xFFFFFFFF},
+        {{"CRC-32D"}, 1, 0x87315576, {}, CRC32_ENGINE_LOOP, 0xFFFFFFFF, NULL, NULL, "CRC-32/BASE91-D", 0xA833982B, true, true, 0x45270551, 0xFFFFFFFF},
+        {{"CRC-32/AAL5", "CRC-32/DECT-B", "B-CRC-32"}, 3, 0xFC891918, {}, CRC32_ENGINE_LOOP, 0xFFFFFFFF, NULL, NULL, "CRC-32/BZIP2", 0x04C11DB7, false, false, 0xC704DD7B, 0xFFFFFFFF},
+        {{}, 0, 0x6EC2EDC4, {}, CRC32_ENGINE_LOOP, 0x00000000, NULL, NULL, "CRC-32/CD-ROM-EDC", 0x8001801B, true, true, 0x00000000, 0x00000000},
+        {{"CKSUM", "CRC-32/POSIX"}, 2, 0x765E7680, {}, CRC32_ENGINE_LOOP, 0x00000000, NULL, NULL, "CRC-32/CKSUM", 0x04C11DB7, false, false, 0xC704DD7B, 0xFFFFFFFF},
+        {{"CRC-32/BASE91-C", "CRC-32/CASTAGNOLI", "CRC-32/INTERLAKEN", "CRC-32C", "CRC-32/NVME"}, 5, 0xE3069283, {}, CRC32_ENGINE_LOOP, 0xFFFFFFFF, NULL, NULL, "CRC-32/ISCSI", 0x1EDC6F41, true, true, 0xB798B438, 0xFFFFFFFF},
+        {{"CRC-32", "CRC-32/ADCCP", "CRC-32/V-42", "CRC-32/XZ", "PKZIP"}, 5, 0xCBF43926, {}, CRC32_ENGINE_LOOP, 0xFFFFFFFF, NULL, NULL, "CRC-32/ISO-HDLC", 0x04C11DB7, true, true, 0xDEBB20E3, 0xFFFFFFFF},
+        {{"JAMCRC"}, 1, 0x340BC6D9, {}, CRC32_ENGINE_LOOP, 0xFFFFFFFF, NULL, NULL, "CRC-32/JAMCRC", 0x04C11DB7, true, true, 0x00000000, 0x00000000},
+        {{}, 0, 0xD2C22F51, {}, CRC32_ENGINE_LOOP, 0xFFFFFFFF, NULL, NULL, "CRC-32/MEF", 0x741B8CD7, true, true, 0x00000000, 0x00000000},
+        {{}, 0, 0x0376E6E7, {}, CRC32_ENGINE_LOOP, 0xFFFFFFFF, NULL, NULL, "CRC-32/MPEG-2", 0x04C11DB7, false, false, 0x00000000, 0x00000000},
+        {{"XFER"}, 1, 0xBD0BE338, {}, CRC32_ENGINE_LOOP, 0x00000000, NULL, NULL, "CRC-32/XFER", 0x000000AF, false, false, 0x00000000, 0x00000000}};
 const size_t crc32_ConfigurationCount = sizeof(crc32_Configuration) / sizeof(crc32_Configuration[0]);
+static const crc32_kernelCallback_t crc32_Kernel[] = {CRC32_KERNEL_LIST(CRC32_KERNEL_POINTER)};
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+#ifdef CRC_PTHREAD_AVAILABLE
+static void *crc32_calculateWorker(void *worker);
+#endif
+static size_t crc32_correctionFind(const crc32_correction_t * const Correction, const uint32_t Syndrome, const size_t BitCount);
+static void crc32_correctionFlip(const crc32_correction_t * const Correction, uint8_t * const buffer, const size_t BitCount, const size_t Distance);
+#ifdef CRC_FILE_AVAILABLE
+static void crc32_fileUpdate(void * const context, const uint8_t *Data, const size_t DataLength);
+static void crc32_fileZero(void * const context, const uint64_t Length);
+#endif
+static void crc32_generateSlicing(void * const table, const size_t Size, const void * const Argument);
+static CRC_ALWAYS_INLINE uint32_t crc32_kernel(const uint32_t * const LookupTable, const uint32_t Initial, const uint32_t TableInitial, const bool ReflectIn, const uint32_t XorOut, const uint8_t *Data, size_t dataLength);
+static CRC_ALWAYS_INLINE size_t crc32_roll(crc32_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength, const uint32_t Mask, const uint32_t Match, const bool Scan);
+static crc32_engine_t crc32_selectEngine(const crc32_configuration_t * const Configuration, const crc32_engine_t Engine);
+static uint32_t crc32_update(const crc32_configuration_t * const Configuration, uint32_t crc, const uint8_t *Data, size_t dataLength);
 
 /****************************************************************************************************
  * Function Definitions (Public)
@@ -38,8 +78,8 @@ uint32_t crc32_calculate(const crc32_configuration_t * const Configuration, cons
 {
     /*** Calculate ***/
     /* Variable */
+    crc32_context_t context;
     uint32_t crc;
-    size_t i;
 
     /* Set Up */
     crc = 0x00000000;
@@ -47,12 +87,17 @@ uint32_t crc32_calculate(const crc32_configuration_t * const Configuration, cons
     /* Error Check */
     if((Configuration != NULL) && (Data != NULL))
     {
-        /* Set Up */
-        crc = Configuration->initial;
-
-        /* Calculate */
-        for(i = 0; i < DataLength; i++)
-            crc = crc32_calculatePartial(Configuration, crc, Data[i], (i == 0), (i == (DataLength - 1)));
+        /* Calculate (Specialized Kernel When Installed) */
+        if(Configuration->kernel != NULL)
+        {
+            crc = Configuration->kernel(Data, DataLength);
+        }
+        else
+        {
+            crc32_contextInit(&context, Configuration);
+            crc32_contextUpdate(&context, Data, DataLength);
+            crc = crc32_contextFinal(&context);
+        }
     }
 
     /* Exit */
@@ -78,6 +123,273 @@ void crc32_calculateAndAppend(const crc32_configuration_t * const Configuration,
     }
 }
 
+#ifdef CRC_FILE_AVAILABLE
+/*** Calculate File ***/
+bool crc32_calculateFile(const crc32_configuration_t * const Configuration, const char * const Path, uint32_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** Calculate File ***/
+    /* Variable */
+    int fileDescriptor;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Path != NULL) && (crc != NULL) && ((fileDescriptor = open(Path, O_RDONLY | O_CLOEXEC)) >= 0))
+    {
+        /* Calculate */
+        success = crc32_calculateFileDescriptor(Configuration, fileDescriptor, crc, ProgressCallback, progressArgument, statistics);
+        (void)close(fileDescriptor);
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Calculate File Descriptor ***/
+bool crc32_calculateFileDescriptor(const crc32_configuration_t * const Configuration, const int FileDescriptor, uint32_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** Calculate File Descriptor ***/
+    /* Variable */
+    crc32_context_t context;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (crc != NULL))
+    {
+        /* Calculate (Mapped Where Possible, Streamed Otherwise) */
+        crc32_contextInit(&context, Configuration);
+        success = crc_fileRead(FileDescriptor, crc32_fileUpdate, &context, ProgressCallback, progressArgument, statistics);
+        if(success)
+            *crc = crc32_contextFinal(&context);
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Calculate File Sparse ***/
+bool crc32_calculateFileSparse(const crc32_configuration_t * const Configuration, const char * const Path, uint32_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** Calculate File Sparse ***/
+    /* Variable */
+    crc32_context_t context;
+    int fileDescriptor;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Path != NULL) && (crc != NULL) && ((fileDescriptor = open(Path, O_RDONLY | O_CLOEXEC)) >= 0))
+    {
+        /* Calculate (Allocated Extents Through The Bulk Engine, Holes Through A Zero Shift, Same Value As A Full Scan) */
+        crc32_contextInit(&context, Configuration);
+        success = crc_fileReadSparse(fileDescriptor, crc32_fileUpdate, crc32_fileZero, &context, ProgressCallback, progressArgument, statistics);
+        if(success)
+            *crc = crc32_contextFinal(&context);
+        (void)close(fileDescriptor);
+    }
+
+    /* Exit */
+    return success;
+}
+#endif
+
+/*** Calculate List ***/
+uint32_t crc32_calculateList(const crc32_configuration_t * const Configuration, const list_list_t * const List)
+{
+    /*** Calculate List ***/
+    /* Variable */
+    crc32_context_t context;
+    const list_node_t *node;
+    const struct iovec *Segment;
+    uint32_t crc;
+
+    /* Set Up */
+    crc = 0x00000000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (List != NULL))
+    {
+        /* Calculate (Node Data Are Segment Descriptors, CRC Carried Across Segments) */
+        crc32_contextInit(&context, Configuration);
+        for(node = List->head; node != NULL; node = node->next)
+        {
+            Segment = node->data;
+            if(Segment != NULL)
+                crc32_contextUpdate(&context, Segment->iov_base, Segment->iov_len);
+        }
+        crc = crc32_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Calculate Many ***/
+void crc32_calculateMany(const crc32_configuration_t * const Configuration, const uint8_t * const Data[], const size_t DataLength[], uint32_t crc[], const size_t Count)
+{
+    /*** Calculate Many ***/
+    /* Variable */
+    crc32_context_t context[CRC32_MANY_LANE_COUNT];
+    const uint8_t *data[CRC32_MANY_LANE_COUNT];
+    uint32_t chain0, chain1, chain2, chain3;
+    size_t i, j, lane, length;
+    const uint32_t *LookupTable;
+
+    /* Set Up */
+    i = 0;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Data != NULL) && (DataLength != NULL) && (crc != NULL))
+    {
+        /* Lookup Table (Lanes Interleaved, One Serial Dependency Chain Per Buffer Instead Of One For The Batch) */
+        if(Configuration->engine == CRC32_ENGINE_LOOKUP_TABLE)
+        {
+            LookupTable = Configuration->lookupTable;
+            for(; (i + CRC32_MANY_LANE_COUNT) <= Count; i += CRC32_MANY_LANE_COUNT)
+            {
+                /* Set Up (Common Length, Buffers Without Data Take The Single Buffer Path) */
+                length = SIZE_MAX;
+                for(lane = 0; lane < CRC32_MANY_LANE_COUNT; lane++)
+                {
+                    if(Data[i + lane] == NULL)
+                        break;
+                    crc32_contextInit(&context[lane], Configuration);
+                    data[lane] = Data[i + lane];
+                    length = (DataLength[i + lane] < length) ? DataLength[i + lane] : length;
+                }
+                if(lane < CRC32_MANY_LANE_COUNT)
+                    break;
+
+                /* Interleave (Four Independent Chains, Kept In Registers) */
+                chain0 = context[0].crc;
+                chain1 = context[1].crc;
+                chain2 = context[2].crc;
+                chain3 = context[3].crc;
+                if(Configuration->reflectIn)
+                {
+                    for(j = 0; j < length; j++)
+                    {
+                        chain0 = (chain0 >> 8) ^ LookupTable[(chain0 ^ data[0][j]) & 0xFF];
+                        chain1 = (chain1 >> 8) ^ LookupTable[(chain1 ^ data[1][j]) & 0xFF];
+                        chain2 = (chain2 >> 8) ^ LookupTable[(chain2 ^ data[2][j]) & 0xFF];
+                        chain3 = (chain3 >> 8) ^ LookupTable[(chain3 ^ data[3][j]) & 0xFF];
+                    }
+                }
+                else
+                {
+                    for(j = 0; j < length; j++)
+                    {
+                        chain0 = ((chain0 << 8) ^ LookupTable[(chain0 >> 24) ^ data[0][j]]);
+                        chain1 = ((chain1 << 8) ^ LookupTable[(chain1 >> 24) ^ data[1][j]]);
+                        chain2 = ((chain2 << 8) ^ LookupTable[(chain2 >> 24) ^ data[2][j]]);
+                        chain3 = ((chain3 << 8) ^ LookupTable[(chain3 >> 24) ^ data[3][j]]);
+                    }
+                }
+                context[0].crc = chain0;
+                context[1].crc = chain1;
+                context[2].crc = chain2;
+                context[3].crc = chain3;
+
+                /* Tail And Final */
+                for(lane = 0; lane < CRC32_MANY_LANE_COUNT; lane++)
+                {
+                    context[lane].length = length;
+                    crc32_contextUpdate(&context[lane], data[lane] + length, DataLength[i + lane] - length);
+                    crc[i + lane] = crc32_contextFinal(&context[lane]);
+                }
+            }
+        }
+
+        /* Remainder (Other Engines Already Break The Dependency Chain Within A Buffer) */
+        for(; i < Count; i++)
+            crc[i] = crc32_calculate(Configuration, Data[i], DataLength[i]);
+    }
+}
+
+/*** Calculate Parallel ***/
+uint32_t crc32_calculateParallel(const crc32_configuration_t * const Configuration, const uint8_t *Data, const size_t DataLength, size_t threadCount)
+{
+    /*** Calculate Parallel ***/
+    /* Variable */
+    uint32_t crc;
+#ifdef CRC_PTHREAD_AVAILABLE
+    size_t chunkLength, i;
+    bool created[CRC32_PARALLEL_MAXIMUM_THREAD_COUNT];
+    uint64_t length;
+    pthread_t thread[CRC32_PARALLEL_MAXIMUM_THREAD_COUNT];
+    crc32_worker_t worker[CRC32_PARALLEL_MAXIMUM_THREAD_COUNT];
+#endif
+
+    /* Set Up */
+    crc = 0x00000000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Data != NULL))
+    {
+        /* Thread Count (Every Thread Gets At Least The Minimum Length) */
+#ifdef CRC_PTHREAD_AVAILABLE
+        if(threadCount > CRC32_PARALLEL_MAXIMUM_THREAD_COUNT)
+            threadCount = CRC32_PARALLEL_MAXIMUM_THREAD_COUNT;
+        if(threadCount > (DataLength / CRC32_PARALLEL_MINIMUM_LENGTH))
+            threadCount = DataLength / CRC32_PARALLEL_MINIMUM_LENGTH;
+#else
+        threadCount = 1;
+#endif
+
+        /* Calculate */
+        if(threadCount <= 1)
+        {
+            /* Single Threaded */
+            crc = crc32_calculate(Configuration, Data, DataLength);
+        }
+#ifdef CRC_PTHREAD_AVAILABLE
+        else
+        {
+            /* Split (Chunks Rounded To 64 Bytes, Last Chunk Takes The Remainder) */
+            chunkLength = (DataLength / threadCount) & ~(size_t)63;
+            for(i = 0; i < threadCount; i++)
+            {
+                worker[i].Configuration = Configuration;
+                worker[i].crc = 0x00000000;
+                worker[i].Data = Data + (i * chunkLength);
+                worker[i].dataLength = (i == (threadCount - 1)) ? (DataLength - (i * chunkLength)) : chunkLength;
+            }
+
+            /* Calculate (Caller Takes The Last Chunk, And Any Chunk Whose Thread Failed To Start) */
+            for(i = 0; i < (threadCount - 1); i++)
+                created[i] = (pthread_create(&thread[i], NULL, crc32_calculateWorker, &worker[i]) == 0);
+            (void)crc32_calculateWorker(&worker[threadCount - 1]);
+            for(i = 0; i < (threadCount - 1); i++)
+            {
+                if(created[i])
+                    (void)pthread_join(thread[i], NULL);
+                else
+                    (void)crc32_calculateWorker(&worker[i]);
+            }
+
+            /* Combine */
+            crc = worker[0].crc;
+            length = worker[0].dataLength;
+            for(i = 1; i < threadCount; i++)
+            {
+                crc = crc32_combine(Configuration, crc, length, worker[i].crc, worker[i].dataLength);
+                length += worker[i].dataLength;
+            }
+        }
+#endif
+    }
+
+    /* Exit */
+    return crc;
+}
+
 /*** Calculate Partial ***/
 uint32_t crc32_calculatePartial(const crc32_configuration_t * const Configuration, uint32_t crc, const uint8_t Data, const bool First, const bool Last)
 {
@@ -142,107 +454,1157 @@ uint32_t crc32_calculatePartial(const crc32_configuration_t * const Configuratio
     return crc;
 }
 
-/*** Deinitialize ***/
-void crc32_deinit(crc32_configuration_t * const configuration)
+#ifdef CRC_IOVEC_AVAILABLE
+/*** Calculate Vector ***/
+uint32_t crc32_calculateV(const crc32_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount)
 {
-    /*** Deinitialize ***/
+    /*** Calculate Vector ***/
+    /* Variable */
+    crc32_context_t context;
+    uint32_t crc;
+    size_t i;
+
+    /* Set Up */
+    crc = 0x00000000;
+
     /* Error Check */
-    if(configuration != NULL)
+    if((Configuration != NULL) && (Vector != NULL))
     {
-        /* Deinitialize */
-        memory_free((void **)&(configuration->lookupTable));
-        memset(configuration, 0, sizeof(*configuration));
+        /* Calculate (No Copy, Each Segment Goes Through The Bulk Engine, CRC Carried Across Segments) */
+        crc32_contextInit(&context, Configuration);
+        for(i = 0; i < VectorCount; i++)
+            crc32_contextUpdate(&context, Vector[i].iov_base, Vector[i].iov_len);
+        crc = crc32_contextFinal(&context);
     }
+
+    /* Exit */
+    return crc;
 }
+#endif
 
-/*** Initialize ***/
-void crc32_init(const char * const Name, crc32_configuration_t * const configuration, const bool CreateLookupTable)
+/*** Combine ***/
+uint32_t crc32_combine(const crc32_configuration_t * const Configuration, uint32_t crcA, const uint64_t LengthA, uint32_t crcB, const uint64_t LengthB)
 {
-    /*** Initialize ***/
+    /*** Combine ***/
     /* Variable */
-    bool found;
-    size_t i, j;
-    uint32_t *lookupTable;
+    uint32_t crc;
 
     /* Set Up */
-    found = false;
+    crc = 0x00000000;
 
     /* Error Check */
-    if((Name != NULL) && (configuration != NULL))
+    if(Configuration != NULL)
     {
-        /* Algorithm */
-        for(i = 0; i < crc32_ConfigurationCount; i++)
+        /* Set Up */
+        crc = (LengthA > 0) ? crcA : crcB;
+
+        /* Combine (Empty Input Calculates To Initial, Not A Shiftable Register, So An Empty Side Passes The Other Through) */
+        if((LengthA > 0) && (LengthB > 0))
         {
-            /* Name */
-            if(strcmp(Name, crc32_Configuration[i].Name) == 0)
+            /* Undo Last */
+            if(Configuration->reflectOut)
             {
-                /* Found */
-                found = true;
-                break;
+                crcA = misc_reflect32(crcA);
+                crcB = misc_reflect32(crcB);
             }
-            else
-            {
-                /* Alias */
-                for(j = 0; j < crc32_Configuration[i].aliasCount; j++)
-                {
-                    if(strcmp(Name, crc32_Configuration[i].Alias[j]) == 0)
-                    {
-                        /* Found */
-                        found = true;
-                        break;
-                    }
-                }
+            crcA ^= Configuration->xorOut;
+            crcB ^= Configuration->xorOut;
 
-                /* Found */
-                if(found)
-                    break;
-            }
+            /* Combine (B Already Carries Initial Shifted Over Its Length, So Only A ^ Initial Is Shifted In) */
+            crc = (uint32_t)crc_shift(crcA ^ Configuration->initial, Configuration->polynomial, 32, LengthB) ^ crcB;
+
+            /* Last */
+            crc ^= Configuration->xorOut;
+            if(Configuration->reflectOut)
+                crc = misc_reflect32(crc);
         }
+    }
 
-        /* Found */
-        if(found)
-        {
-            /* Copy */
-            (void)memcpy(configuration, &crc32_Configuration[i], sizeof(crc32_Configuration[i]));
+    /* Exit */
+    return crc;
+}
 
-            /* Generate Lookup Table */
-            if(CreateLookupTable)
-            {
-                if((lookupTable = memory_malloc(CRC32_LOOKUP_TABLE_MEMORY_SIZE)) != NULL)
-                {
-                    for(i = 0; i < 256; i++)
-                        lookupTable[i] = crc32_calculatePartial(configuration, 0x00000000, (uint8_t)i, true, true) ^ configuration->xorOut;
-                    configuration->lookupTable = lookupTable;
-                }
-            }
-        }
-        else
+/*** Context Final ***/
+uint32_t crc32_contextFinal(const crc32_context_t * const Context)
+{
+    /*** Context Final ***/
+    /* Variable */
+    uint32_t crc;
+
+    /* Set Up */
+    crc = 0x00000000;
+
+    /* Error Check */
+    if((Context != NULL) && (Context->Configuration != NULL))
+    {
+        /* Set Up (Nothing Consumed Returns Initial, Same As Calculate) */
+        crc = Context->Configuration->initial;
+
+        /* Last */
+        if(Context->length > 0)
         {
-            /* Not Found */
-            memset(configuration, 0, sizeof(*configuration));
+            crc = Context->crc ^ Context->Configuration->xorOut;
+            if((Context->Configuration->lookupTable == NULL) && Context->Configuration->reflectOut)
+                crc = misc_reflect32(crc);
         }
     }
+
+    /* Exit */
+    return crc;
 }
 
-/*** Verify ***/
-bool crc32_verify(const crc32_configuration_t * const Configuration, const uint8_t *Buffer, const size_t BufferLength)
+/*** Context Initialize ***/
+void crc32_contextInit(crc32_context_t * const context, const crc32_configuration_t * const Configuration)
 {
-    /*** Verify ***/
+    /*** Context Initialize ***/
+    /* Error Check */
+    if((context != NULL) && (Configuration != NULL))
+    {
+        /* Initialize */
+        context->Configuration = Configuration;
+        context->crc = Configuration->initial;
+        if((Configuration->lookupTable != NULL) && Configuration->reflectIn)
+            context->crc = misc_reflect32(context->crc);
+        context->length = 0;
+    }
+}
+
+/*** Context Update ***/
+void crc32_contextUpdate(crc32_context_t * const context, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Context Update ***/
+    /* Error Check */
+    if((context != NULL) && (context->Configuration != NULL) && (Data != NULL))
+    {
+        /* Update */
+        context->crc = crc32_update(context->Configuration, context->crc, Data, DataLength);
+        context->length += DataLength;
+    }
+}
+
+/*** Context Zero ***/
+void crc32_contextZero(crc32_context_t * const context, const uint64_t Length)
+{
+    /*** Context Zero ***/
     /* Variable */
     uint32_t crc;
-    bool verified;
+    bool reflected;
+
+    /* Error Check */
+    if((context != NULL) && (context->Configuration != NULL) && (Length > 0))
+    {
+        /* Set Up (Table Engines Keep A Reflected Register, The Shift Works On The Unreflected One) */
+        crc = context->crc;
+        reflected = ((context->Configuration->lookupTable != NULL) && context->Configuration->reflectIn);
+        if(reflected)
+            crc = misc_reflect32(crc);
+
+        /* Shift (Zero Bytes Only Multiply The Register By x^(8 * Length), O(log Length) Multiplications) */
+        crc = (uint32_t)crc_shift(crc, context->Configuration->polynomial, 32, Length);
+        if(reflected)
+            crc = misc_reflect32(crc);
+        context->crc = crc;
+        context->length += Length;
+    }
+}
+
+/*** Copy And Calculate ***/
+uint32_t crc32_copyAndCalculate(const crc32_configuration_t * const Configuration, uint8_t * const destination, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal)
+{
+    /*** Copy And Calculate ***/
+    /* Variable */
+    size_t blockLength;
+    crc32_context_t context;
+    uint32_t crc;
+    size_t i;
 
     /* Set Up */
-    verified = false;
+    crc = 0x00000000;
 
     /* Error Check */
-    if((Configuration != NULL) && (Buffer != NULL))
+    if((Configuration != NULL) && (destination != NULL) && (Source != NULL))
     {
-        /* Verify */
-        crc = crc32_calculate(Configuration, Buffer, BufferLength);
-        verified = ((crc ^ Configuration->xorOut) == Configuration->residue);
+        /* Copy And Calculate (Each Block Is Checksummed While Still In Cache From The Copy) */
+        crc32_contextInit(&context, Configuration);
+        for(i = 0; i < DataLength; i += blockLength)
+        {
+            blockLength = ((DataLength - i) < CRC_COPY_BLOCK_SIZE) ? (DataLength - i) : CRC_COPY_BLOCK_SIZE;
+            crc_copy(destination + i, Source + i, blockLength, NonTemporal);
+            crc32_contextUpdate(&context, Source + i, blockLength);
+        }
+        crc = crc32_contextFinal(&context);
     }
 
     /* Exit */
-    return verified;
+    return crc;
+}
+
+/*** Copy And Calculate And Append ***/
+void crc32_copyAndCalculateAndAppend(const crc32_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal)
+{
+    /*** Copy And Calculate And Append ***/
+    /* Variable */
+    uint32_t crc;
+
+    /* Set Up */
+    crc = 0x00000000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (destination != NULL) && (Source != NULL) && (DestinationLength >= (DataLength + sizeof(crc))))
+    {
+        /* Copy, Calculate, And Append */
+        crc = crc32_copyAndCalculate(Configuration, destination, Source, DataLength, NonTemporal);
+        misc_insert32(destination + DataLength, DestinationLength - DataLength, crc, !Configuration->reflectOut);
+    }
+}
+
+/*** Correct ***/
+bool crc32_correct(const crc32_correction_t * const Correction, uint8_t * const buffer, const size_t BufferLength, size_t * const corrected)
+{
+    /*** Correct ***/
+    /* Variable */
+    size_t bitCount;
+    size_t candidateCount;
+    size_t distance[2];
+    size_t flipped;
+    size_t i;
+    size_t match;
+    bool success;
+    uint32_t syndrome;
+
+    /* Set Up */
+    flipped = 0;
+    success = false;
+
+    /* Error Check */
+    if((Correction != NULL) && (Correction->entry != NULL) && (buffer != NULL) && (BufferLength > sizeof(uint32_t)) && (BufferLength <= Correction->maximumLength))
+    {
+        /* Syndrome (Zero When The Frame Verifies, Otherwise The CRC Of The Error Pattern Alone) */
+        syndrome = crc32_calculate(Correction->Configuration, buffer, BufferLength) ^ Correction->Configuration->xorOut ^ Correction->Configuration->residue;
+        bitCount = 8 * BufferLength;
+        if(syndrome == 0)
+        {
+            success = true;
+        }
+
+        /* Single Bit (One Probe, Refused Without Trying Pairs When Several Bits Share The Syndrome) */
+        else if((match = crc32_correctionFind(Correction, syndrome, bitCount)) > 0)
+        {
+            if(match != CRC32_CORRECTION_AMBIGUOUS)
+            {
+                crc32_correctionFlip(Correction, buffer, bitCount, match - 1);
+                flipped = 1;
+                success = true;
+            }
+        }
+
+        /* Double Bit (One Probe Per Bit, Accepted Only When Exactly One Pair Explains The Syndrome, An Ambiguous Partner Counts As Several) */
+        else if(Correction->syndrome != NULL)
+        {
+            candidateCount = 0;
+            for(i = 0; (i < bitCount) && (candidateCount < 2); i++)
+            {
+                match = crc32_correctionFind(Correction, syndrome ^ Correction->syndrome[i], bitCount);
+                if(match == CRC32_CORRECTION_AMBIGUOUS)
+                {
+                    candidateCount = 2;
+                }
+                else if(match > (i + 1))
+                {
+                    distance[0] = i;
+                    distance[1] = match - 1;
+                    candidateCount++;
+                }
+            }
+            if(candidateCount == 1)
+            {
+                crc32_correctionFlip(Correction, buffer, bitCount, distance[0]);
+                crc32_correctionFlip(Correction, buffer, bitCount, distance[1]);
+                flipped = 2;
+                success = true;
+            }
+        }
+    }
+
+    /* Exit */
+    if(corrected != NULL)
+        *corrected = flipped;
+    return success;
+}
+
+/*** Correction Deinitialize ***/
+void crc32_correctionDeinit(crc32_correction_t * const correction)
+{
+    /*** Correction Deinitialize ***/
+    /* Error Check */
+    if(correction != NULL)
+    {
+        /* Deinitialize */
+        if(correction->entry != NULL)
+            memory_free((void **)&correction->entry);
+        if(correction->syndrome != NULL)
+            memory_free((void **)&correction->syndrome);
+        correction->maximumLength = 0;
+    }
+}
+
+/*** Correction Initialize ***/
+bool crc32_correctionInit(crc32_correction_t * const correction, const crc32_configuration_t * const Configuration, const size_t MaximumLength, const bool DoubleBit)
+{
+    /*** Correction Initialize ***/
+    /* Variable */
+    size_t bitCount;
+    size_t distance;
+    size_t index;
+    uint32_t remainder;
+    size_t size;
+    bool success;
+    uint32_t syndrome;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check (Distances Must Fit In 32 Bits) */
+    if((correction != NULL) && (Configuration != NULL) && (MaximumLength > sizeof(uint32_t)) && (MaximumLength < (UINT32_MAX / 8)))
+    {
+        /* Table (At Most Half Full) */
+        memset(correction, 0, sizeof(*correction));
+        bitCount = 8 * MaximumLength;
+        for(size = 1; size < (2 * bitCount); size <<= 1)
+            ;
+        if((correction->entry = memory_malloc(size * sizeof(crc32_correctionEntry_t))) != NULL)
+        {
+            memset(correction->entry, 0, size * sizeof(crc32_correctionEntry_t));
+            correction->Configuration = Configuration;
+            correction->mask = size - 1;
+            correction->maximumLength = MaximumLength;
+            success = !DoubleBit || ((correction->syndrome = memory_malloc(bitCount * sizeof(uint32_t))) != NULL);
+        }
+
+        /* Syndromes (Bit d From The End Leaves x^(d + 32) Mod P, Each One Shift Of The Last, Linear In The Frame Length) */
+        remainder = Configuration->polynomial;
+        for(distance = 0; success && (distance < bitCount); distance++)
+        {
+            syndrome = Configuration->reflectOut ? misc_reflect32(remainder) : remainder;
+            if(correction->syndrome != NULL)
+                correction->syndrome[distance] = syndrome;
+            for(index = syndrome & correction->mask; (correction->entry[index].distance != 0) && (correction->entry[index].syndrome != syndrome); index = (index + 1) & correction->mask)
+                ;
+            if(correction->entry[index].distance == 0)
+            {
+                correction->entry[index].distance = (uint32_t)(distance + 1);
+                correction->entry[index].syndrome = syndrome;
+            }
+            else if(correction->entry[index].collision == 0)
+            {
+                correction->entry[index].collision = (uint32_t)(distance + 1); // Shorter Frames Still Resolve It
+            }
+            remainder = (remainder & 0x80000000) ? ((remainder << 1) ^ Configuration->polynomial) : (remainder << 1);
+        }
+
+        /* Clean Up */
+        if(!success)
+            crc32_correctionDeinit(correction);
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Deinitialize ***/
+void crc32_deinit(crc32_configuration_t * const configuration)
+{
+    /*** Deinitialize ***/
+    /* Error Check */
+    if(configuration != NULL)
+    {
+        /* Deinitialize (Only Slicing Tables Are Shared From The Cache, Byte At A Time Tables Are Read Only) */
+        if((configuration->engine == CRC32_ENGINE_SLICING_BY_8) || (configuration->engine == CRC32_ENGINE_SLICING_BY_16))
+            crc_tableRelease(configuration->lookupTable);
+        memset(configuration, 0, sizeof(*configuration));
+    }
+}
+
+/*** Fork ***/
+uint32_t crc32_fork(const crc32_context_t * const Snapshot, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Fork ***/
+    /* Variable */
+    crc32_context_t context;
+    uint32_t crc;
+
+    /* Set Up */
+    crc = 0x00000000;
+
+    /* Error Check */
+    if((Snapshot != NULL) && (Snapshot->Configuration != NULL) && ((Data != NULL) || (DataLength == 0)))
+    {
+        /* Resume (The Snapshot Is Only Read, So One Prefix Serves Any Number Of Frames) */
+        context = *Snapshot;
+        if(DataLength > 0)
+            crc32_contextUpdate(&context, Data, DataLength);
+        crc = crc32_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Initialize ***/
+void crc32_init(const char * const Name, crc32_configuration_t * const configuration, const crc32_engine_t Engine)
+{
+    /*** Initialize ***/
+    /* Variable */
+    const crc_name_t *algorithm;
+    crc32_engine_t engine;
+    bool found;
+    size_t i;
+    const uint32_t *lookupTable;
+    size_t lookupTableCount;
+
+    /* Set Up */
+    found = false;
+
+    /* Error Check */
+    if((Name != NULL) && (configuration != NULL))
+    {
+        /* Algorithm (Perfect Hash Over Every Width, Width Must Match) */
+        if(((algorithm = crc_lookup(Name)) != NULL) && (algorithm->width == 32))
+        {
+            /* Found */
+            found = true;
+            i = algorithm->index;
+        }
+
+        /* Found */
+        if(found)
+        {
+            /* Copy */
+            (void)memcpy(configuration, &crc32_Configuration[i], sizeof(crc32_Configuration[i]));
+
+            /* Engine (Tier Override Wins, Automatic Picks The Fastest This CPU Supports) */
+            engine = crc32_selectEngine(configuration, Engine);
+
+            /* Lookup Table (Byte At A Time Tables Are Generated At Build Time, Shared Read Only) */
+            switch(engine)
+            {
+                case CRC32_ENGINE_LOOKUP_TABLE:
+                case CRC32_ENGINE_CLMUL:
+                case CRC32_ENGINE_HARDWARE:
+                    configuration->engine = engine;
+                    configuration->lookupTable = crc32_LookupTable[i];
+                    break;
+                case CRC32_ENGINE_SLICING_BY_8:
+                case CRC32_ENGINE_SLICING_BY_16:
+                    /* Shared (Configurations With The Same Polynomial And Reflection Reuse One Table) */
+                    lookupTableCount = (engine == CRC32_ENGINE_SLICING_BY_8) ? CRC32_SLICING_BY_8_LOOKUP_TABLE_COUNT : CRC32_SLICING_BY_16_LOOKUP_TABLE_COUNT;
+                    configuration->lookupTable = crc32_LookupTable[i];
+                    if((lookupTable = crc_tableAcquire(32, configuration->polynomial, configuration->reflectIn, lookupTableCount * sizeof(uint32_t), crc32_generateSlicing, configuration)) != NULL)
+                    {
+                        configuration->engine = engine;
+                        configuration->lookupTable = lookupTable;
+                    }
+                    else
+                    {
+                        configuration->lookupTable = NULL;
+                    }
+                    break;
+                default:
+                    break;
+            }
+
+            /* Carry-Less Multiplication (Lookup Table Handles Short Tails And CPUs Without Support) */
+            if(engine == CRC32_ENGINE_CLMUL)
+            {
+                if(crc_clmulSupported())
+                    crc_clmulInit(&configuration->clmul, configuration->polynomial, 32, configuration->reflectIn);
+                else
+                    configuration->engine = CRC32_ENGINE_LOOKUP_TABLE;
+            }
+
+            /* Hardware (CRC-32C Picks It Automatically Unless A Tier Is Forced, Lookup Table Kept For Calculate Partial) */
+            if((engine == CRC32_ENGINE_HARDWARE) || ((engine == CRC32_ENGINE_LOOKUP_TABLE) && (crc_tierGet() == CRC_TIER_AUTOMATIC)))
+            {
+                if((configuration->polynomial == CRC_CRC32C_POLYNOMIAL) && configuration->reflectIn && crc_crc32cSupported())
+                    configuration->engine = CRC32_ENGINE_HARDWARE;
+                else
+                    configuration->engine = CRC32_ENGINE_LOOKUP_TABLE;
+            }
+
+            /* Kernel (Specialized Lookup Table Calculate) */
+            if(configuration->engine == CRC32_ENGINE_LOOKUP_TABLE)
+                configuration->kernel = crc32_Kernel[i];
+        }
+        else
+        {
+            /* Not Found */
+            memset(configuration, 0, sizeof(*configuration));
+        }
+    }
+}
+
+/*** Patch ***/
+uint32_t crc32_patch(const crc32_configuration_t * const Configuration, const uint32_t OldCrc, const size_t Offset, const uint8_t * const OldData, const uint8_t * const NewData, const size_t DataLength, const size_t TotalLength)
+{
+    /*** Patch ***/
+    /* Variable */
+    uint32_t crc;
+    uint8_t delta[64];
+    uint32_t deltaCrc;
+    size_t i, j, length;
+    bool reflected;
+
+    /* Set Up */
+    crc = OldCrc;
+
+    /* Error Check */
+    if((Configuration != NULL) && (OldData != NULL) && (NewData != NULL) && (Offset <= TotalLength) && (DataLength <= (TotalLength - Offset)))
+    {
+        /* Delta (CRC Is Linear, So Only The XOR Of The Changed Bytes From A Zero Register Matters) */
+        deltaCrc = 0x00000000;
+        for(i = 0; i < DataLength; i += length)
+        {
+            length = ((DataLength - i) < sizeof(delta)) ? (DataLength - i) : sizeof(delta);
+            for(j = 0; j < length; j++)
+                delta[j] = OldData[i + j] ^ NewData[i + j];
+            deltaCrc = crc32_update(Configuration, deltaCrc, delta, length);
+        }
+
+        /* Shift Over The Bytes After The Patch (Table Engines Keep A Reflected Register) */
+        reflected = ((Configuration->lookupTable != NULL) && Configuration->reflectIn);
+        if(reflected)
+            deltaCrc = misc_reflect32(deltaCrc);
+        deltaCrc = (uint32_t)crc_shift(deltaCrc, Configuration->polynomial, 32, TotalLength - Offset - DataLength);
+
+        /* Apply (xorOut Cancels Out, Reflection Distributes Over XOR) */
+        if(reflected || ((Configuration->lookupTable == NULL) && Configuration->reflectOut))
+            deltaCrc = misc_reflect32(deltaCrc);
+        crc ^= deltaCrc;
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Rolling Deinitialize ***/
+void crc32_rollingDeinit(crc32_rolling_t * const rolling)
+{
+    /*** Rolling Deinitialize ***/
+    /* Error Check */
+    if((rolling != NULL) && (rolling->window != NULL))
+    {
+        /* Deinitialize */
+        memory_free((void **)&rolling->window);
+        rolling->windowLength = 0;
+    }
+}
+
+/*** Rolling Final ***/
+uint32_t crc32_rollingFinal(const crc32_rolling_t * const Rolling)
+{
+    /*** Rolling Final ***/
+    /* Variable */
+    uint32_t crc;
+
+    /* Set Up */
+    crc = 0x00000000;
+
+    /* Error Check */
+    if((Rolling != NULL) && (Rolling->window != NULL))
+    {
+        /* Final (Same As Calculate Over The Last Window Length Bytes, Zeros Before The First Byte) */
+        crc = Rolling->crc;
+        if(Rolling->reflectOut)
+            crc = misc_reflect32(crc);
+        crc ^= Rolling->xorOut;
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Rolling Initialize ***/
+bool crc32_rollingInit(crc32_rolling_t * const rolling, const crc32_configuration_t * const Configuration, const size_t WindowLength)
+{
+    /*** Rolling Initialize ***/
+    /* Variable */
+    size_t bit;
+    uint32_t crc;
+    uint32_t initial[2];
+    size_t i;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((rolling != NULL) && (Configuration != NULL) && (WindowLength > 0))
+    {
+        /* Window (Starts As Zeros So The Update Loop Never Branches On Fill Level) */
+        memset(rolling, 0, sizeof(*rolling));
+        if((rolling->window = memory_malloc(WindowLength)) != NULL)
+        {
+            /* Set Up */
+            memset(rolling->window, 0, WindowLength);
+            rolling->reflect = Configuration->reflectIn;
+            rolling->reflectOut = (Configuration->reflectIn != Configuration->reflectOut);
+            rolling->windowLength = WindowLength;
+            rolling->xorOut = Configuration->xorOut;
+
+            /* Lookup Table (Own Copy, The Configuration May Use The Loop Engine) */
+            for(i = 0; i < CRC32_LOOKUP_TABLE_COUNT; i++)
+            {
+                if(rolling->reflect)
+                {
+                    crc = (uint32_t)i;
+                    for(bit = 0; bit < 8; bit++)
+                        crc = (crc & 1) ? ((crc >> 1) ^ misc_reflect32(Configuration->polynomial)) : (crc >> 1);
+                }
+                else
+                {
+                    crc = (uint32_t)i << 24;
+                    for(bit = 0; bit < 8; bit++)
+                        crc = (crc & 0x80000000) ? ((crc << 1) ^ Configuration->polynomial) : (crc << 1);
+                }
+                rolling->table[i] = crc;
+            }
+
+            /* Initial (Register After Window Length And Window Length + 1 Zero Bytes) */
+            for(i = 0; i < 2; i++)
+            {
+                initial[i] = (uint32_t)crc_shift(Configuration->initial, Configuration->polynomial, 32, WindowLength + i);
+                if(rolling->reflect)
+                    initial[i] = misc_reflect32(initial[i]);
+            }
+            rolling->crc = initial[0];
+
+            /* Out Table (Byte Followed By Window Length Zeros, Plus The Initial Drift From The Extra Byte) */
+            for(i = 0; i < CRC32_LOOKUP_TABLE_COUNT; i++)
+            {
+                crc = rolling->table[i];
+                if(rolling->reflect)
+                    crc = misc_reflect32((uint32_t)crc_shift(misc_reflect32(crc), Configuration->polynomial, 32, WindowLength));
+                else
+                    crc = (uint32_t)crc_shift(crc, Configuration->polynomial, 32, WindowLength);
+                rolling->outTable[i] = crc ^ initial[0] ^ initial[1];
+            }
+            success = true;
+        }
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Rolling Scan ***/
+size_t crc32_rollingScan(crc32_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength, const uint32_t Mask, const uint32_t Match)
+{
+    /*** Rolling Scan ***/
+    /* Variable */
+    size_t scanned;
+
+    /* Set Up */
+    scanned = DataLength;
+
+    /* Error Check */
+    if((rolling != NULL) && (rolling->window != NULL) && (Data != NULL))
+    {
+        /* Scan (Stops After The Byte That Completes A Boundary) */
+        scanned = crc32_roll(rolling, Data, DataLength, Mask, Match, true);
+    }
+
+    /* Exit */
+    return scanned;
+}
+
+/*** Rolling Update ***/
+void crc32_rollingUpdate(crc32_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Rolling Update ***/
+    /* Error Check */
+    if((rolling != NULL) && (rolling->window != NULL) && (Data != NULL))
+    {
+        /* Update */
+        (void)crc32_roll(rolling, Data, DataLength, 0, 0, false);
+    }
+}
+
+/*** Snapshot ***/
+void crc32_snapshot(const crc32_configuration_t * const Configuration, const uint8_t *Prefix, const size_t PrefixLength, crc32_context_t * const snapshot)
+{
+    /*** Snapshot ***/
+    /* Error Check */
+    if((Configuration != NULL) && ((Prefix != NULL) || (PrefixLength == 0)) && (snapshot != NULL))
+    {
+        /* Prefix (Register State After The Shared Header, Resumed By Fork Or By Copying Into A Context) */
+        crc32_contextInit(snapshot, Configuration);
+        if(PrefixLength > 0)
+            crc32_contextUpdate(snapshot, Prefix, PrefixLength);
+    }
+}
+
+/*** Verify ***/
+bool crc32_verify(const crc32_configuration_t * const Configuration, const uint8_t *Buffer, const size_t BufferLength)
+{
+    /*** Verify ***/
+    /* Variable */
+    uint32_t crc;
+    bool verified;
+
+    /* Set Up */
+    verified = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Buffer != NULL))
+    {
+        /* Verify */
+        crc = crc32_calculate(Configuration, Buffer, BufferLength);
+        verified = ((crc ^ Configuration->xorOut) == Configuration->residue);
+    }
+
+    /* Exit */
+    return verified;
+}
+
+/*** Verify List ***/
+bool crc32_verifyList(const crc32_configuration_t * const Configuration, const list_list_t * const List)
+{
+    /*** Verify List ***/
+    /* Variable */
+    uint32_t crc;
+    bool verified;
+
+    /* Set Up */
+    verified = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (List != NULL))
+    {
+        /* Verify */
+        crc = crc32_calculateList(Configuration, List);
+        verified = ((crc ^ Configuration->xorOut) == Configuration->residue);
+    }
+
+    /* Exit */
+    return verified;
+}
+
+/*** Verify Many ***/
+size_t crc32_verifyMany(const crc32_configuration_t * const Configuration, const uint8_t * const Buffer[], const size_t BufferLength[], uint8_t * const verified, const size_t Count)
+{
+    /*** Verify Many ***/
+    /* Variable */
+    uint32_t crc[8 * CRC32_MANY_LANE_COUNT];
+    size_t chunk, i, j, verifiedCount;
+
+    /* Set Up */
+    verifiedCount = 0;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Buffer != NULL) && (BufferLength != NULL) && (verified != NULL))
+    {
+        /* Clear */
+        memset(verified, 0, CRC32_MANY_BITMAP_SIZE(Count));
+
+        /* Verify (Whole Bitmap Bytes Per Chunk) */
+        for(i = 0; i < Count; i += chunk)
+        {
+            chunk = ((Count - i) < (sizeof(crc) / sizeof(crc[0]))) ? (Count - i) : (sizeof(crc) / sizeof(crc[0]));
+            crc32_calculateMany(Configuration, &Buffer[i], &BufferLength[i], crc, chunk);
+            for(j = 0; j < chunk; j++)
+            {
+                if((Buffer[i + j] != NULL) && ((crc[j] ^ Configuration->xorOut) == Configuration->residue))
+                {
+                    verified[(i + j) / 8] |= (uint8_t)(1 << ((i + j) % 8));
+                    verifiedCount++;
+                }
+            }
+        }
+    }
+
+    /* Exit */
+    return verifiedCount;
+}
+
+#ifdef CRC_IOVEC_AVAILABLE
+/*** Verify Vector ***/
+bool crc32_verifyV(const crc32_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount)
+{
+    /*** Verify Vector ***/
+    /* Variable */
+    uint32_t crc;
+    bool verified;
+
+    /* Set Up */
+    verified = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Vector != NULL))
+    {
+        /* Verify */
+        crc = crc32_calculateV(Configuration, Vector, VectorCount);
+        verified = ((crc ^ Configuration->xorOut) == Configuration->residue);
+    }
+
+    /* Exit */
+    return verified;
+}
+#endif
+
+/*** Kernels ***/
+CRC32_KERNEL_LIST(CRC32_KERNEL_DEFINITION)
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+#ifdef CRC_PTHREAD_AVAILABLE
+/*** Calculate Worker ***/
+static void *crc32_calculateWorker(void *worker)
+{
+    /*** Calculate Worker ***/
+    /* Variable */
+    crc32_worker_t *crcWorker;
+
+    /* Set Up */
+    crcWorker = (crc32_worker_t *)worker;
+
+    /* Calculate */
+    crcWorker->crc = crc32_calculate(crcWorker->Configuration, crcWorker->Data, crcWorker->dataLength);
+
+    /* Exit */
+    return NULL;
+}
+#endif
+
+/*** Correction Find ***/
+static size_t crc32_correctionFind(const crc32_correction_t * const Correction, const uint32_t Syndrome, const size_t BitCount)
+{
+    /*** Correction Find ***/
+    /* Variable */
+    size_t distance;
+    size_t index;
+
+    /* Find */
+    for(index = Syndrome & Correction->mask; (Correction->entry[index].distance != 0) && (Correction->entry[index].syndrome != Syndrome); index = (index + 1) & Correction->mask)
+        ;
+
+    /* Distance Plus 1, 0 When Absent Or Outside The Frame, Ambiguous When Shared With Another Bit Inside It */
+    distance = Correction->entry[index].distance;
+    if(distance > BitCount)
+        distance = 0;
+    else if((distance != 0) && (Correction->entry[index].collision != 0) && (Correction->entry[index].collision <= BitCount))
+        distance = CRC32_CORRECTION_AMBIGUOUS;
+
+    /* Exit */
+    return distance;
+}
+
+/*** Correction Flip ***/
+static void crc32_correctionFlip(const crc32_correction_t * const Correction, uint8_t * const buffer, const size_t BitCount, const size_t Distance)
+{
+    /*** Correction Flip ***/
+    /* Variable */
+    size_t bit;
+
+    /* Flip (Bits Enter Least Significant First When Reflected In) */
+    bit = BitCount - 1 - Distance;
+    buffer[bit / 8] ^= (uint8_t)(Correction->Configuration->reflectIn ? (1 << (bit % 8)) : (0x80 >> (bit % 8)));
+}
+
+#ifdef CRC_FILE_AVAILABLE
+/*** File Update ***/
+static void crc32_fileUpdate(void * const context, const uint8_t *Data, const size_t DataLength)
+{
+    /*** File Update ***/
+    /* Update */
+    crc32_contextUpdate(context, Data, DataLength);
+}
+
+/*** File Zero ***/
+static void crc32_fileZero(void * const context, const uint64_t Length)
+{
+    /*** File Zero ***/
+    /* Zero */
+    crc32_contextZero(context, Length);
+}
+#endif
+
+/*** Generate Slicing ***/
+static void crc32_generateSlicing(void * const table, const size_t Size, const void * const Argument)
+{
+    /*** Generate Slicing ***/
+    /* Variable */
+    const crc32_configuration_t * const Configuration = Argument;
+    size_t i;
+    uint32_t * const lookupTable = table;
+    const size_t LookupTableCount = Size / sizeof(uint32_t);
+
+    /* Slice 0 (Byte At A Time) */
+    (void)memcpy(lookupTable, Configuration->lookupTable, CRC32_LOOKUP_TABLE_MEMORY_SIZE);
+
+    /* Slice 1 And Up (Slice N - 1 Advanced By One Zero Byte) */
+    for(i = CRC32_LOOKUP_TABLE_COUNT; i < LookupTableCount; i++)
+    {
+        if(Configuration->reflectIn)
+            lookupTable[i] = (lookupTable[i - CRC32_LOOKUP_TABLE_COUNT] >> 8) ^ lookupTable[lookupTable[i - CRC32_LOOKUP_TABLE_COUNT] & 0xFF];
+        else
+            lookupTable[i] = (lookupTable[i - CRC32_LOOKUP_TABLE_COUNT] << 8) ^ lookupTable[lookupTable[i - CRC32_LOOKUP_TABLE_COUNT] >> 24];
+    }
+}
+
+/*** Kernel ***/
+static CRC_ALWAYS_INLINE uint32_t crc32_kernel(const uint32_t * const LookupTable, const uint32_t Initial, const uint32_t TableInitial, const bool ReflectIn, const uint32_t XorOut, const uint8_t *Data, size_t dataLength)
+{
+    /*** Kernel ***/
+    /* Variable */
+    uint32_t crc;
+
+    /* Set Up (Nothing Consumed Returns Initial, Same As Calculate) */
+    crc = 0x00000000;
+
+    /* Error Check */
+    if(Data != NULL)
+    {
+        /* Set Up */
+        crc = Initial;
+
+        /* Lookup Table (Every Argument Is A Constant From The Kernel List, Folded At Compile Time) */
+        if(dataLength > 0)
+        {
+            crc = TableInitial;
+            if(ReflectIn)
+            {
+                while(dataLength-- > 0)
+                    crc = (crc >> 8) ^ LookupTable[(crc ^ *Data++) & 0xFF];
+            }
+            else
+            {
+                while(dataLength-- > 0)
+                    crc = ((crc << 8) ^ LookupTable[(crc >> 24) ^ *Data++]);
+            }
+            crc ^= XorOut;
+        }
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Roll ***/
+static CRC_ALWAYS_INLINE size_t crc32_roll(crc32_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength, const uint32_t Mask, const uint32_t Match, const bool Scan)
+{
+    /*** Roll ***/
+    /* Variable */
+    uint32_t crc;
+    size_t i;
+    size_t index;
+    uint32_t mask;
+    uint32_t match;
+    uint8_t out;
+    const uint32_t * const OutTable = rolling->outTable;
+    const bool Reflect = rolling->reflect;
+    const uint32_t * const Table = rolling->table;
+    uint8_t * const Window = rolling->window;
+    const size_t WindowLength = rolling->windowLength;
+
+    /* Set Up (Match Moved Into The Register Domain, No Per Byte Reflect Or Xor Out) */
+    crc = rolling->crc;
+    index = rolling->index;
+    mask = rolling->reflectOut ? misc_reflect32(Mask) : Mask;
+    match = (rolling->reflectOut ? misc_reflect32(Match ^ rolling->xorOut) : (Match ^ rolling->xorOut)) & mask;
+
+    /* Roll (Byte Leaving The Window Comes From The Saved Window At First, Straight From Data After That) */
+    for(i = 0; i < DataLength; )
+    {
+        if(i < WindowLength)
+        {
+            out = Window[index];
+            Window[index] = Data[i];
+            if(++index == WindowLength)
+                index = 0;
+        }
+        else
+        {
+            out = Data[i - WindowLength];
+        }
+        if(Reflect)
+            crc = (crc >> 8) ^ Table[(crc ^ Data[i]) & 0xFF] ^ OutTable[out];
+        else
+            crc = (crc << 8) ^ Table[(crc >> 24) ^ Data[i]] ^ OutTable[out];
+        i++;
+        if(Scan && ((crc & mask) == match))
+            break;
+    }
+
+    /* Window (Last Window Length Bytes Consumed, Oldest First) */
+    if(i >= WindowLength)
+    {
+        (void)memcpy(Window, &Data[i - WindowLength], WindowLength);
+        index = 0;
+    }
+    rolling->crc = crc;
+    rolling->index = index;
+
+    /* Exit */
+    return i;
+}
+
+/*** Select Engine ***/
+static crc32_engine_t crc32_selectEngine(const crc32_configuration_t * const Configuration, const crc32_engine_t Engine)
+{
+    /*** Select Engine ***/
+    /* Variable */
+    crc32_engine_t engine;
+
+    /* Tier Override */
+    switch(crc_tierGet())
+    {
+        case CRC_TIER_LOOP:
+            engine = CRC32_ENGINE_LOOP;
+            break;
+        case CRC_TIER_LOOKUP_TABLE:
+            engine = CRC32_ENGINE_LOOKUP_TABLE;
+            break;
+        case CRC_TIER_SLICING:
+            engine = CRC32_ENGINE_SLICING_BY_16;
+            break;
+        case CRC_TIER_CLMUL:
+            engine = CRC32_ENGINE_CLMUL;
+            break;
+        case CRC_TIER_HARDWARE:
+            engine = CRC32_ENGINE_HARDWARE;
+            break;
+        default:
+            engine = Engine;
+            break;
+    }
+
+    /* Automatic (Hardware For CRC-32C, Then Carry-Less Multiplication, Then Slicing) */
+    if(engine == CRC32_ENGINE_AUTOMATIC)
+    {
+        if((Configuration->polynomial == CRC_CRC32C_POLYNOMIAL) && Configuration->reflectIn && crc_crc32cSupported())
+            engine = CRC32_ENGINE_HARDWARE;
+        else if(crc_clmulSupported())
+            engine = CRC32_ENGINE_CLMUL;
+        else
+            engine = CRC32_ENGINE_SLICING_BY_16;
+    }
+
+    /* Exit */
+    return engine;
+}
+
+/*** Update ***/
+static uint32_t crc32_update(const crc32_configuration_t * const Configuration, uint32_t crc, const uint8_t *Data, size_t dataLength)
+{
+    /*** Update ***/
+    /* Variable */
+    size_t bit, length;
+    uint32_t high, low;
+    const uint32_t *LookupTable;
+
+    /* Set Up */
+    LookupTable = Configuration->lookupTable;
+
+    /* Hardware */
+    if(Configuration->engine == CRC32_ENGINE_HARDWARE)
+    {
+        crc = crc_crc32cUpdate(crc, Data, dataLength);
+        dataLength = 0;
+    }
+
+    /* Carry-Less Multiplication */
+    if((Configuration->engine == CRC32_ENGINE_CLMUL) && (dataLength >= CRC_CLMUL_MINIMUM_LENGTH))
+    {
+        length = dataLength - (dataLength % CRC_CLMUL_BLOCK_SIZE);
+        crc = (uint32_t)crc_clmulUpdate(&Configuration->clmul, crc, Data, length);
+        Data += length;
+        dataLength -= length;
+    }
+
+    /* Slicing By 16 */
+    if(Configuration->engine == CRC32_ENGINE_SLICING_BY_16)
+    {
+        while(dataLength >= 16)
+        {
+            if(Configuration->reflectIn)
+            {
+                low = crc ^ ((uint32_t)Data[0] | ((uint32_t)Data[1] << 8) | ((uint32_t)Data[2] << 16) | ((uint32_t)Data[3] << 24));
+                crc = LookupTable[(15 * 256) + (low & 0xFF)] ^ LookupTable[(14 * 256) + ((low >> 8) & 0xFF)] ^ LookupTable[(13 * 256) + ((low >> 16) & 0xFF)] ^ LookupTable[(12 * 256) + (low >> 24)] ^
+                      LookupTable[(11 * 256) + Data[4]] ^ LookupTable[(10 * 256) + Data[5]] ^ LookupTable[(9 * 256) + Data[6]] ^ LookupTable[(8 * 256) + Data[7]] ^
+                      LookupTable[(7 * 256) + Data[8]] ^ LookupTable[(6 * 256) + Data[9]] ^ LookupTable[(5 * 256) + Data[10]] ^ LookupTable[(4 * 256) + Data[11]] ^
+                      LookupTable[(3 * 256) + Data[12]] ^ LookupTable[(2 * 256) + Data[13]] ^ LookupTable[(1 * 256) + Data[14]] ^ LookupTable[Data[15]];
+            }
+            else
+            {
+                high = crc ^ (((uint32_t)Data[0] << 24) | ((uint32_t)Data[1] << 16) | ((uint32_t)Data[2] << 8) | (uint32_t)Data[3]);
+                crc = LookupTable[(15 * 256) + (high >> 24)] ^ LookupTable[(14 * 256) + ((high >> 16) & 0xFF)] ^ LookupTable[(13 * 256) + ((high >> 8) & 0xFF)] ^ LookupTable[(12 * 256) + (high & 0xFF)] ^
+                      LookupTable[(11 * 256) + Data[4]] ^ LookupTable[(10 * 256) + Data[5]] ^ LookupTable[(9 * 256) + Data[6]] ^ LookupTable[(8 * 256) + Data[7]] ^
+                      LookupTable[(7 * 256) + Data[8]] ^ LookupTable[(6 * 256) + Data[9]] ^ LookupTable[(5 * 256) + Data[10]] ^ LookupTable[(4 * 256) + Data[11]] ^
+                      LookupTable[(3 * 256) + Data[12]] ^ LookupTable[(2 * 256) + Data[13]] ^ LookupTable[(1 * 256) + Data[14]] ^ LookupTable[Data[15]];
+            }
+            Data += 16;
+            dataLength -= 16;
+        }
+    }
+
+    /* Slicing By 8 */
+    if((Configuration->engine == CRC32_ENGINE_SLICING_BY_8) || (Configuration->engine == CRC32_ENGINE_SLICING_BY_16))
+    {
+        while(dataLength >= 8)
+        {
+            if(Configuration->reflectIn)
+            {
+                low = crc ^ ((uint32_t)Data[0] | ((uint32_t)Data[1] << 8) | ((uint32_t)Data[2] << 16) | ((uint32_t)Data[3] << 24));
+                high = (uint32_t)Data[4] | ((uint32_t)Data[5] << 8) | ((uint32_t)Data[6] << 16) | ((uint32_t)Data[7] << 24);
+                crc = LookupTable[(7 * 256) + (low & 0xFF)] ^ LookupTable[(6 * 256) + ((low >> 8) & 0xFF)] ^ LookupTable[(5 * 256) + ((low >> 16) & 0xFF)] ^ LookupTable[(4 * 256) + (low >> 24)] ^
+                      LookupTable[(3 * 256) + (high & 0xFF)] ^ LookupTable[(2 * 256) + ((high >> 8) & 0xFF)] ^ LookupTable[(1 * 256) + ((high >> 16) & 0xFF)] ^ LookupTable[high >> 24];
+            }
+            else
+            {
+                high = crc ^ (((uint32_t)Data[0] << 24) | ((uint32_t)Data[1] << 16) | ((uint32_t)Data[2] << 8) | (uint32_t)Data[3]);
+                low = ((uint32_t)Data[4] << 24) | ((uint32_t)Data[5] << 16) | ((uint32_t)Data[6] << 8) | (uint32_t)Data[7];
+                crc = LookupTable[(7 * 256) + (high >> 24)] ^ LookupTable[(6 * 256) + ((high >> 16) & 0xFF)] ^ LookupTable[(5 * 256) + ((high >> 8) & 0xFF)] ^ LookupTable[(4 * 256) + (high & 0xFF)] ^
+                      LookupTable[(3 * 256) + (low >> 24)] ^ LookupTable[(2 * 256) + ((low >> 16) & 0xFF)] ^ LookupTable[(1 * 256) + ((low >> 8) & 0xFF)] ^ LookupTable[low & 0xFF];
+            }
+            Data += 8;
+            dataLength -= 8;
+        }
+    }
+
+    /* Byte At A Time */
+    if(LookupTable == NULL)
+    {
+        /* Loop */
+        while(dataLength-- > 0)
+        {
+            if(Configuration->reflectIn)
+                crc ^= ((uint32_t)misc_reflect8(*Data++) << 24);
+            else
+                crc ^= ((uint32_t)*Data++ << 24);
+            for(bit = 0; bit < 8; bit++)
+            {
+                if((crc & 0x80000000) == 0x80000000)
+                    crc = (crc << 1) ^ Configuration->polynomial;
+                else
+                    crc <<= 1;
+            }
+        }
+    }
+    else if(Configuration->reflectIn)
+    {
+        /* Lookup Table (Reflected) */
+        while(dataLength-- > 0)
+            crc = (crc >> 8) ^ LookupTable[(crc ^ *Data++) & 0xFF];
+    }
+    else
+    {
+        /* Lookup Table */
+        while(dataLength-- > 0)
+            crc = (crc << 8) ^ LookupTable[(crc >> 24) ^ *Data++];
+    }
+
+    /* Exit */
+    return crc;
 }
@@ -8,14 +8,27 @@
  * Defines
  ****************************************************************************************************/
 
+#define CRC32_CORRECTION_AMBIGUOUS (SIZE_MAX) // Correction Find, Several Bits In The Frame Share The Syndrome
+#define CRC32_KERNEL_PROTOTYPE(IDENTIFIER, INDEX, INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT) extern uint32_t crc32_##IDENTIFIER##_calculate(const uint8_t *Data, const size_t DataLength);
 #define CRC32_LOOKUP_TABLE_COUNT (256)
 #define CRC32_LOOKUP_TABLE_MEMORY_SIZE (CRC32_LOOKUP_TABLE_COUNT * sizeof(uint32_t))
+#define CRC32_MANY_BITMAP_SIZE(COUNT) (((COUNT) + 7) / 8) // Verify Many, Bit (i % 8) Of Byte (i / 8) Per Buffer
+#define CRC32_MANY_LANE_COUNT (4) // Calculate Many Interleaves Exactly Four Chains
 #define CRC32_MAXIMUM_ALIAS_COUNT (5)
+#define CRC32_PARALLEL_MAXIMUM_THREAD_COUNT (16)
+#define CRC32_PARALLEL_MINIMUM_LENGTH (1024 * 1024) // Per Thread, Shorter Buffers Stay Single Threaded
+#define CRC32_SLICING_BY_8_LOOKUP_TABLE_COUNT (8 * CRC32_LOOKUP_TABLE_COUNT)
+#define CRC32_SLICING_BY_8_LOOKUP_TABLE_MEMORY_SIZE (CRC32_SLICING_BY_8_LOOKUP_TABLE_COUNT * sizeof(uint32_t))
+#define CRC32_SLICING_BY_16_LOOKUP_TABLE_COUNT (16 * CRC32_LOOKUP_TABLE_COUNT)
+#define CRC32_SLICING_BY_16_LOOKUP_TABLE_MEMORY_SIZE (CRC32_SLICING_BY_16_LOOKUP_TABLE_COUNT * sizeof(uint32_t))
 
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc32_kernel.h"
+#include "Eclectic/Data/list.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -24,14 +37,32 @@
  * Type Definitions
  ****************************************************************************************************/
 
+/*** Enumerations ***/
+typedef enum crc32_engine_e
+{
+    CRC32_ENGINE_LOOP,
+    CRC32_ENGINE_LOOKUP_TABLE,
+    CRC32_ENGINE_SLICING_BY_8,
+    CRC32_ENGINE_SLICING_BY_16,
+    CRC32_ENGINE_CLMUL,
+    CRC32_ENGINE_HARDWARE,
+    CRC32_ENGINE_AUTOMATIC
+} crc32_engine_t;
+
+/*** Callbacks ***/
+typedef uint32_t (*crc32_kernelCallback_t)(const uint8_t *Data, const size_t DataLength);
+
 /*** Structures ***/
 typedef struct crc32_configuration_s
 {
     char *Alias[CRC32_MAXIMUM_ALIAS_COUNT];
     size_t aliasCount;
     uint32_t check;
+    crc_clmul_t clmul;
+    crc32_engine_t engine;
     uint32_t initial;
-    uint32_t *lookupTable;
+    crc32_kernelCallback_t kernel;
+    const uint32_t *lookupTable;
     char *Name;
     uint32_t polynomial;
     bool reflectIn;
@@ -40,13 +71,101 @@ typedef struct crc32_configuration_s
     uint32_t xorOut;
 } crc32_configuration_t;
 
+typedef struct crc32_context_s
+{
+    const crc32_configuration_t *Configuration;
+    uint32_t crc;
+    uint64_t length;
+} crc32_context_t;
+
+typedef struct crc32_correctionEntry_s
+{
+    uint32_t collision; // Distance Plus 1 Of The Nearest Other Bit With This Syndrome, 0 When Unique, Frames Of At Least That Many Bits Are Ambiguous
+    uint32_t distance; // Bits From The Last Bit Of The Frame Plus 1, 0 When Empty
+    uint32_t syndrome;
+} crc32_correctionEntry_t;
+
+typedef struct crc32_correction_s
+{
+    const crc32_configuration_t *Configuration;
+    crc32_correctionEntry_t *entry; // Open Addressing, Syndrome Of One Flipped Bit To Its Distance
+    size_t mask;
+    size_t maximumLength;
+    uint32_t *syndrome; // By Distance, Double Bit Correction Only
+} crc32_correction_t;
+
+typedef struct crc32_rolling_s
+{
+    uint32_t crc; // Register Over The Window, Reflected When Reflect In
+    size_t index; // Oldest Byte In The Window
+    uint32_t outTable[CRC32_LOOKUP_TABLE_COUNT]; // Cancels The Byte Leaving The Window
+    bool reflect;
+    bool reflectOut; // Register Reflected Once More On The Way Out
+    uint32_t table[CRC32_LOOKUP_TABLE_COUNT];
+    uint8_t *window;
+    size_t windowLength;
+    uint32_t xorOut;
+} crc32_rolling_t;
+
+typedef struct crc32_worker_s
+{
+    const crc32_configuration_t *Configuration;
+    uint32_t crc;
+    const uint8_t *Data;
+    size_t dataLength;
+} crc32_worker_t;
+
+/****************************************************************************************************
+ * Constants
+ ****************************************************************************************************/
+
+extern const crc32_configuration_t crc32_Configuration[]; // Catalog, One Entry Per Algorithm (Aliases Folded In)
+extern const size_t crc32_ConfigurationCount;
+
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
 extern uint32_t crc32_calculate(const crc32_configuration_t * const Configuration, const uint8_t *Data, const size_t DataLength);
 extern void crc32_calculateAndAppend(const crc32_configuration_t * const Configuration, uint8_t * const buffer, const size_t BufferLength, const size_t DataLength);
+#ifdef CRC_FILE_AVAILABLE
+extern bool crc32_calculateFile(const crc32_configuration_t * const Configuration, const char * const Path, uint32_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+extern bool crc32_calculateFileDescriptor(const crc32_configuration_t * const Configuration, const int FileDescriptor, uint32_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+extern bool crc32_calculateFileSparse(const crc32_configuration_t * const Configuration, const char * const Path, uint32_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+#endif
+extern uint32_t crc32_calculateList(const crc32_configuration_t * const Configuration, const list_list_t * const List);
+extern void crc32_calculateMany(const crc32_configuration_t * const Configuration, const uint8_t * const Data[], const size_t DataLength[], uint32_t crc[], const size_t Count);
+extern uint32_t crc32_calculateParallel(const crc32_configuration_t * const Configuration, const uint8_t *Data, const size_t DataLength, size_t threadCount);
 extern uint32_t crc32_calculatePartial(const crc32_configuration_t * const Configuration, uint32_t crc, const uint8_t Data, const bool First, const bool Last);
+#ifdef CRC_IOVEC_AVAILABLE
+extern uint32_t crc32_calculateV(const crc32_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount);
+#endif
+extern uint32_t crc32_combine(const crc32_configuration_t * const Configuration, uint32_t crcA, const uint64_t LengthA, uint32_t crcB, const uint64_t LengthB);
+extern uint32_t crc32_contextFinal(const crc32_context_t * const Context);
+extern void crc32_contextInit(crc32_context_t * const context, const crc32_configuration_t * const Configuration);
+extern void crc32_contextUpdate(crc32_context_t * const context, const uint8_t *Data, const size_t DataLength);
+extern void crc32_contextZero(crc32_context_t * const context, const uint64_t Length);
+extern uint32_t crc32_copyAndCalculate(const crc32_configuration_t * const Configuration, uint8_t * const destination, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal);
+extern void crc32_copyAndCalculateAndAppend(const crc32_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal);
+extern bool crc32_correct(const crc32_correction_t * const Correction, uint8_t * const buffer, const size_t BufferLength, size_t * const corrected);
+extern void crc32_correctionDeinit(crc32_correction_t * const correction);
+extern bool crc32_correctionInit(crc32_correction_t * const correction, const crc32_configuration_t * const Configuration, const size_t MaximumLength, const bool DoubleBit);
 extern void crc32_deinit(crc32_configuration_t * const configuration);
-extern void crc32_init(const char * const Name, crc32_configuration_t * const configuration, const bool CreateLookupTable);
+extern uint32_t crc32_fork(const crc32_context_t * const Snapshot, const uint8_t *Data, const size_t DataLength);
+extern void crc32_init(const char * const Name, crc32_configuration_t * const configuration, const crc32_engine_t Engine);
+extern uint32_t crc32_patch(const crc32_configuration_t * const Configuration, const uint32_t OldCrc, const size_t Offset, const uint8_t * const OldData, const uint8_t * const NewData, const size_t DataLength, const size_t TotalLength);
+extern void crc32_rollingDeinit(crc32_rolling_t * const rolling);
+extern uint32_t crc32_rollingFinal(const crc32_rolling_t * const Rolling);
+extern bool crc32_rollingInit(crc32_rolling_t * const rolling, const crc32_configuration_t * const Configuration, const size_t WindowLength);
+extern size_t crc32_rollingScan(crc32_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength, const uint32_t Mask, const uint32_t Match);
+extern void crc32_rollingUpdate(crc32_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength);
+extern void crc32_snapshot(const crc32_configuration_t * const Configuration, const uint8_t *Prefix, const size_t PrefixLength, crc32_context_t * const snapshot);
 extern bool crc32_verify(const crc32_configuration_t * const Configuration, const uint8_t *Buffer, const size_t BufferLength);
+extern bool crc32_verifyList(const crc32_configuration_t * const Configuration, const list_list_t * const List);
+extern size_t crc32_verifyMany(const crc32_configuration_t * const Configuration, const uint8_t * const Buffer[], const size_t BufferLength[], uint8_t * const verified, const size_t Count);
+#ifdef CRC_IOVEC_AVAILABLE
+extern bool crc32_verifyV(const crc32_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount);
+#endif
+
+/* Kernels (One Per Catalog Entry, e.g. crc32_iso_hdlc_calculate) */
+CRC32_KERNEL_LIST(CRC32_KERNEL_PROTOTYPE)
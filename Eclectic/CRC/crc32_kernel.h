@@ -0,0 +1,23 @@
+/****************************************************************************************************
+ * Pragmas
+ ****************************************************************************************************/
+
+#pragma once
+
+/****************************************************************************************************
+ * Defines (Generated By Project/Script/crc_table.py, Do Not Edit)
+ ****************************************************************************************************/
+
+#define CRC32_KERNEL_LIST(KERNEL) \
+    KERNEL(aixm, 0, 0x00000000, 0x00000000, false, 0x00000000) \
+    KERNEL(autosar, 1, 0xFFFFFFFF, 0xFFFFFFFF, true, 0xFFFFFFFF) \
+    KERNEL(base91_d, 2, 0xFFFFFFFF, 0xFFFFFFFF, true, 0xFFFFFFFF) \
+    KERNEL(bzip2, 3, 0xFFFFFFFF, 0xFFFFFFFF, false, 0xFFFFFFFF) \
+    KERNEL(cd_rom_edc, 4, 0x00000000, 0x00000000, true, 0x00000000) \
+    KERNEL(cksum, 5, 0x00000000, 0x00000000, false, 0xFFFFFFFF) \
+    KERNEL(iscsi, 6, 0xFFFFFFFF, 0xFFFFFFFF, true, 0xFFFFFFFF) \
+    KERNEL(iso_hdlc, 7, 0xFFFFFFFF, 0xFFFFFFFF, true, 0xFFFFFFFF) \
+    KERNEL(jamcrc, 8, 0xFFFFFFFF, 0xFFFFFFFF, true, 0x00000000) \
+    KERNEL(mef, 9, 0xFFFFFFFF, 0xFFFFFFFF, true, 0x00000000) \
+    KERNEL(mpeg_2, 10, 0xFFFFFFFF, 0xFFFFFFFF, false, 0x00000000) \
+    KERNEL(xfer, 11, 0x00000000, 0x00000000, false, 0x00000000)
@@ -1,13 +1,33 @@
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CRC64_KERNEL_DEFINITION(IDENTIFIER, INDEX, INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT)                         \
+    uint64_t crc64_##IDENTIFIER##_calculate(const uint8_t *Data, const size_t DataLength)                                  \
+    {                                                                                                                  \
+        return crc64_kernel(crc64_LookupTable[INDEX], INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT, Data, DataLength); \
+    }
+#define CRC64_KERNEL_POINTER(IDENTIFIER, ...) crc64_##IDENTIFIER##_calculate,
+
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
+#include "Eclectic/CRC/crc.h"
 #include "Eclectic/CRC/crc64.h"
+#include "Eclectic/CRC/crc64_table.h"
 #include "Eclectic/Miscellaneous/memory.h"
 #include "Eclectic/Miscellaneous/misc.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#ifdef CRC_FILE_AVAILABLE
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#ifdef CRC_PTHREAD_AVAILABLE
+#include <pthread.h>
+#endif
 
 /****************************************************************************************************
  * Constants
@@ -15,14 +35,31 @@
 
 const crc64_configuration_t crc64_Configuration[] =
     {
-        {{"CRC-64"}, 1, 0x6C40DF5F0B497347, 0x0000000000000000, NULL, "CRC-64/ECMA-182", 0x42F0E1EBA9EA3693, false, false, 0x0000000000000000, 0x0000000000000000},
-        {{}, 0, 0xB90956C775A41001, 0xFFFFFFFFFFFFFFFF, NULL, "CRC-64/GO-ISO", 0x000000000000001B, true, true, 0x5300000000000000, 0xFFFFFFFFFFFFFFFF},
-        {{}, 0, 0x75D4B74F024ECEEA, 0xFFFFFFFFFFFFFFFF, NULL, "CRC-64/MS", 0x259C84CBA6426349, true, true, 0x0000000000000000, 0x0000000000000000},
-        {{}, 0, 0xAE8B14860A799888, 0xFFFFFFFFFFFFFFFF, NULL, "CRC-64/NVME", 0xAD93D23594C93659, true, true, 0xF310303B2B6F6E42, 0xFFFFFFFFFFFFFFFF},
-        {{}, 0, 0xE9C6D914C4B8D9CA, 0x0000000000000000, NULL, "CRC-64/REDIS", 0xAD93D23594C935A9, true, true, 0x0000000000000000, 0x0000000000000000},
-        {{}, 0, 0x62EC59E3F1A4F00A, 0xFFFFFFFFFFFFFFFF, NULL, "CRC-64/WE", 0x42F0E1EBA9EA3693, false, false, 0xFCACBEBD5931A992, 0xFFFFFFFFFFFFFFFF},
-        {{"CRC-64/GO-ECMA"}, 1, 0x995DC9BBDF1939FA, 0xFFFFFFFFFFFFFFFF, NULL, "CRC-64/XZ", 0x42F0E1EBA9EA3693, true, true, 0x49958C9ABD7D353F, 0xFFFFFFFFFFFFFFFF}};
+        {{"CRC-64"}, 1, 0x6C40DF5F0B497347, {}, CRC64_ENGINE_LOOP, 0x0000000000000000, NULL, NULL, "CRC-64/ECMA-182", 0x42F0E1EBA9EA3693, false, false, 0x0000000000000000, 0x0000000000000000},
+        {{}, 0, 0xB90956C775A41001, {}, CRC64_ENGINE_LOOP, 0xFFFFFFFFFFFFFFFF, NULL, NULL, "CRC-64/GO-ISO", 0x000000000000001B, true, true, 0x5300000000000000, 0xFFFFFFFFFFFFFFFF},
+        {{}, 0, 0x75D4B74F024ECEEA, {}, CRC64_ENGINE_LOOP, 0xFFFFFFFFFFFFFFFF, NULL, NULL, "CRC-64/MS", 0x259C84CBA6426349, true, true, 0x0000000000000000, 0x0000000000000000},
+        {{}, 0, 0xAE8B14860A799888, {}, CRC64_ENGINE_LOOP, 0xFFFFFFFFFFFFFFFF, NULL, NULL, "CRC-64/NVME", 0xAD93D23594C93659, true, true, 0xF310303B2B6F6E42, 0xFFFFFFFFFFFFFFFF},
+        {{}, 0, 0xE9C6D914C4B8D9CA, {}, CRC64_ENGINE_LOOP, 0x0000000000000000, NULL, NULL, "CRC-64/REDIS", 0xAD93D23594C935A9, true, true, 0x0000000000000000, 0x0000000000000000},
+        {{}, 0, 0x62EC59E3F1A4F00A, {}, CRC64_ENGINE_LOOP, 0xFFFFFFFFFFFFFFFF, NULL, NULL, "CRC-64/WE", 0x42F0E1EBA9EA3693, false, false, 0xFCACBEBD5931A992, 0xFFFFFFFFFFFFFFFF},
+        {{"CRC-64/GO-ECMA"}, 1, 0x995DC9BBDF1939FA, {}, CRC64_ENGINE_LOOP, 0xFFFFFFFFFFFFFFFF, NULL, NULL, "CRC-64/XZ", 0x42F0E1EBA9EA3693, true, true, 0x49958C9ABD7D353F, 0xFFFFFFFFFFFFFFFF}};
 const size_t crc64_ConfigurationCount = sizeof(crc64_Configuration) / sizeof(crc64_Configuration[0]);
+static const crc64_kernelCallback_t crc64_Kernel[] = {CRC64_KERNEL_LIST(CRC64_KERNEL_POINTER)};
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+#ifdef CRC_PTHREAD_AVAILABLE
+static void *crc64_calculateWorker(void *worker);
+#endif
+#ifdef CRC_FILE_AVAILABLE
+static void crc64_fileUpdate(void * const context, const uint8_t *Data, const size_t DataLength);
+static void crc64_fileZero(void * const context, const uint64_t Length);
+#endif
+static CRC_ALWAYS_INLINE uint64_t crc64_kernel(const uint64_t * const LookupTable, const uint64_t Initial, const uint64_t TableInitial, const bool ReflectIn, const uint64_t XorOut, const uint8_t *Data, size_t dataLength);
+static CRC_ALWAYS_INLINE size_t crc64_roll(crc64_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength, const uint64_t Mask, const uint64_t Match, const bool Scan);
+static crc64_engine_t crc64_selectEngine(const crc64_configuration_t * const Configuration, const crc64_engine_t Engine);
+static uint64_t crc64_update(const crc64_configuration_t * const Configuration, uint64_t crc, const uint8_t *Data, size_t dataLength);
 
 /****************************************************************************************************
  * Function Definitions (Public)
@@ -33,8 +70,8 @@ uint64_t crc64_calculate(const crc64_configuration_t * const Configuration, cons
 {
     /*** Calculate ***/
     /* Variable */
+    crc64_context_t context;
     uint64_t crc;
-    size_t i;
 
     /* Set Up */
     crc = 0x0000000000000000;
@@ -42,12 +79,17 @@ uint64_t crc64_calculate(const crc64_configuration_t * const Configuration, cons
     /* Error Check */
     if((Configuration != NULL) && (Data != NULL))
     {
-        /* Set Up */
-        crc = Configuration->initial;
-
-        /* Calculate */
-        for(i = 0; i < DataLength; i++)
-            crc = crc64_calculatePartial(Configuration, crc, Data[i], (i == 0), (i == (DataLength - 1)));
+        /* Calculate (Specialized Kernel When Installed) */
+        if(Configuration->kernel != NULL)
+        {
+            crc = Configuration->kernel(Data, DataLength);
+        }
+        else
+        {
+            crc64_contextInit(&context, Configuration);
+            crc64_contextUpdate(&context, Data, DataLength);
+            crc = crc64_contextFinal(&context);
+        }
     }
 
     /* Exit */
@@ -73,6 +115,191 @@ void crc64_calculateAndAppend(const crc64_configuration_t * const Configuration,
     }
 }
 
+#ifdef CRC_FILE_AVAILABLE
+/*** Calculate File ***/
+bool crc64_calculateFile(const crc64_configuration_t * const Configuration, const char * const Path, uint64_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** Calculate File ***/
+    /* Variable */
+    int fileDescriptor;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Path != NULL) && (crc != NULL) && ((fileDescriptor = open(Path, O_RDONLY | O_CLOEXEC)) >= 0))
+    {
+        /* Calculate */
+        success = crc64_calculateFileDescriptor(Configuration, fileDescriptor, crc, ProgressCallback, progressArgument, statistics);
+        (void)close(fileDescriptor);
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Calculate File Descriptor ***/
+bool crc64_calculateFileDescriptor(const crc64_configuration_t * const Configuration, const int FileDescriptor, uint64_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** Calculate File Descriptor ***/
+    /* Variable */
+    crc64_context_t context;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (crc != NULL))
+    {
+        /* Calculate (Mapped Where Possible, Streamed Otherwise) */
+        crc64_contextInit(&context, Configuration);
+        success = crc_fileRead(FileDescriptor, crc64_fileUpdate, &context, ProgressCallback, progressArgument, statistics);
+        if(success)
+            *crc = crc64_contextFinal(&context);
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Calculate File Sparse ***/
+bool crc64_calculateFileSparse(const crc64_configuration_t * const Configuration, const char * const Path, uint64_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** Calculate File Sparse ***/
+    /* Variable */
+    crc64_context_t context;
+    int fileDescriptor;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Path != NULL) && (crc != NULL) && ((fileDescriptor = open(Path, O_RDONLY | O_CLOEXEC)) >= 0))
+    {
+        /* Calculate (Allocated Extents Through The Bulk Engine, Holes Through A Zero Shift, Same Value As A Full Scan) */
+        crc64_contextInit(&context, Configuration);
+        success = crc_fileReadSparse(fileDescriptor, crc64_fileUpdate, crc64_fileZero, &context, ProgressCallback, progressArgument, statistics);
+        if(success)
+            *crc = crc64_contextFinal(&context);
+        (void)close(fileDescriptor);
+    }
+
+    /* Exit */
+    return success;
+}
+#endif
+
+/*** Calculate List ***/
+uint64_t crc64_calculateList(const crc64_configuration_t * const Configuration, const list_list_t * const List)
+{
+    /*** Calculate List ***/
+    /* Variable */
+    crc64_context_t context;
+    const list_node_t *node;
+    const struct iovec *Segment;
+    uint64_t crc;
+
+    /* Set Up */
+    crc = 0x0000000000000000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (List != NULL))
+    {
+        /* Calculate (Node Data Are Segment Descriptors, CRC Carried Across Segments) */
+        crc64_contextInit(&context, Configuration);
+        for(node = List->head; node != NULL; node = node->next)
+        {
+            Segment = node->data;
+            if(Segment != NULL)
+                crc64_contextUpdate(&context, Segment->iov_base, Segment->iov_len);
+        }
+        crc = crc64_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Calculate Parallel ***/
+uint64_t crc64_calculateParallel(const crc64_configuration_t * const Configuration, const uint8_t *Data, const size_t DataLength, size_t threadCount)
+{
+    /*** Calculate Parallel ***/
+    /* Variable */
+    uint64_t crc;
+#ifdef CRC_PTHREAD_AVAILABLE
+    size_t chunkLength, i;
+    bool created[CRC64_PARALLEL_MAXIMUM_THREAD_COUNT];
+    uint64_t length;
+    pthread_t thread[CRC64_PARALLEL_MAXIMUM_THREAD_COUNT];
+    crc64_worker_t worker[CRC64_PARALLEL_MAXIMUM_THREAD_COUNT];
+#endif
+
+    /* Set Up */
+    crc = 0x0000000000000000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Data != NULL))
+    {
+        /* Thread Count (Every Thread Gets At Least The Minimum Length) */
+#ifdef CRC_PTHREAD_AVAILABLE
+        if(threadCount > CRC64_PARALLEL_MAXIMUM_THREAD_COUNT)
+            threadCount = CRC64_PARALLEL_MAXIMUM_THREAD_COUNT;
+        if(threadCount > (DataLength / CRC64_PARALLEL_MINIMUM_LENGTH))
+            threadCount = DataLength / CRC64_PARALLEL_MINIMUM_LENGTH;
+#else
+        threadCount = 1;
+#endif
+
+        /* Calculate */
+        if(threadCount <= 1)
+        {
+            /* Single Threaded */
+            crc = crc64_calculate(Configuration, Data, DataLength);
+        }
+#ifdef CRC_PTHREAD_AVAILABLE
+        else
+        {
+            /* Split (Chunks Rounded To 64 Bytes, Last Chunk Takes The Remainder) */
+            chunkLength = (DataLength / threadCount) & ~(size_t)63;
+            for(i = 0; i < threadCount; i++)
+            {
+                worker[i].Configuration = Configuration;
+                worker[i].crc = 0x0000000000000000;
+                worker[i].Data = Data + (i * chunkLength);
+                worker[i].dataLength = (i == (threadCount - 1)) ? (DataLength - (i * chunkLength)) : chunkLength;
+            }
+
+            /* Calculate (Caller Takes The Last Chunk, And Any Chunk Whose Thread Failed To Start) */
+            for(i = 0; i < (threadCount - 1); i++)
+                created[i] = (pthread_create(&thread[i], NULL, crc64_calculateWorker, &worker[i]) == 0);
+            (void)crc64_calculateWorker(&worker[threadCount - 1]);
+            for(i = 0; i < (threadCount - 1); i++)
+            {
+                if(created[i])
+                    (void)pthread_join(thread[i], NULL);
+                else
+                    (void)crc64_calculateWorker(&worker[i]);
+            }
+
+            /* Combine */
+            crc = worker[0].crc;
+            length = worker[0].dataLength;
+            for(i = 1; i < threadCount; i++)
+            {
+                crc = crc64_combine(Configuration, crc, length, worker[i].crc, worker[i].dataLength);
+                length += worker[i].dataLength;
+            }
+        }
+#endif
+    }
+
+    /* Exit */
+    return crc;
+}
+
 /*** Calculate Partial ***/
 uint64_t crc64_calculatePartial(const crc64_configuration_t * const Configuration, uint64_t crc, const uint8_t Data, const bool First, const bool Last)
 {
@@ -137,6 +364,210 @@ uint64_t crc64_calculatePartial(const crc64_configuration_t * const Configuratio
     return crc;
 }
 
+#ifdef CRC_IOVEC_AVAILABLE
+/*** Calculate Vector ***/
+uint64_t crc64_calculateV(const crc64_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount)
+{
+    /*** Calculate Vector ***/
+    /* Variable */
+    crc64_context_t context;
+    uint64_t crc;
+    size_t i;
+
+    /* Set Up */
+    crc = 0x0000000000000000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Vector != NULL))
+    {
+        /* Calculate (No Copy, Each Segment Goes Through The Bulk Engine, CRC Carried Across Segments) */
+        crc64_contextInit(&context, Configuration);
+        for(i = 0; i < VectorCount; i++)
+            crc64_contextUpdate(&context, Vector[i].iov_base, Vector[i].iov_len);
+        crc = crc64_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+#endif
+
+/*** Combine ***/
+uint64_t crc64_combine(const crc64_configuration_t * const Configuration, uint64_t crcA, const uint64_t LengthA, uint64_t crcB, const uint64_t LengthB)
+{
+    /*** Combine ***/
+    /* Variable */
+    uint64_t crc;
+
+    /* Set Up */
+    crc = 0x0000000000000000;
+
+    /* Error Check */
+    if(Configuration != NULL)
+    {
+        /* Set Up */
+        crc = (LengthA > 0) ? crcA : crcB;
+
+        /* Combine (Empty Input Calculates To Initial, Not A Shiftable Register, So An Empty Side Passes The Other Through) */
+        if((LengthA > 0) && (LengthB > 0))
+        {
+            /* Undo Last */
+            if(Configuration->reflectOut)
+            {
+                crcA = misc_reflect64(crcA);
+                crcB = misc_reflect64(crcB);
+            }
+            crcA ^= Configuration->xorOut;
+            crcB ^= Configuration->xorOut;
+
+            /* Combine (B Already Carries Initial Shifted Over Its Length, So Only A ^ Initial Is Shifted In) */
+            crc = (uint64_t)crc_shift(crcA ^ Configuration->initial, Configuration->polynomial, 64, LengthB) ^ crcB;
+
+            /* Last */
+            crc ^= Configuration->xorOut;
+            if(Configuration->reflectOut)
+                crc = misc_reflect64(crc);
+        }
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Context Final ***/
+uint64_t crc64_contextFinal(const crc64_context_t * const Context)
+{
+    /*** Context Final ***/
+    /* Variable */
+    uint64_t crc;
+
+    /* Set Up */
+    crc = 0x0000000000000000;
+
+    /* Error Check */
+    if((Context != NULL) && (Context->Configuration != NULL))
+    {
+        /* Set Up (Nothing Consumed Returns Initial, Same As Calculate) */
+        crc = Context->Configuration->initial;
+
+        /* Last */
+        if(Context->length > 0)
+        {
+            crc = Context->crc ^ Context->Configuration->xorOut;
+            if((Context->Configuration->lookupTable == NULL) && Context->Configuration->reflectOut)
+                crc = misc_reflect64(crc);
+        }
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Context Initialize ***/
+void crc64_contextInit(crc64_context_t * const context, const crc64_configuration_t * const Configuration)
+{
+    /*** Context Initialize ***/
+    /* Error Check */
+    if((context != NULL) && (Configuration != NULL))
+    {
+        /* Initialize */
+        context->Configuration = Configuration;
+        context->crc = Configuration->initial;
+        if((Configuration->lookupTable != NULL) && Configuration->reflectIn)
+            context->crc = misc_reflect64(context->crc);
+        context->length = 0;
+    }
+}
+
+/*** Context Update ***/
+void crc64_contextUpdate(crc64_context_t * const context, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Context Update ***/
+    /* Error Check */
+    if((context != NULL) && (context->Configuration != NULL) && (Data != NULL))
+    {
+        /* Update */
+        context->crc = crc64_update(context->Configuration, context->crc, Data, DataLength);
+        context->length += DataLength;
+    }
+}
+
+/*** Context Zero ***/
+void crc64_contextZero(crc64_context_t * const context, const uint64_t Length)
+{
+    /*** Context Zero ***/
+    /* Variable */
+    uint64_t crc;
+    bool reflected;
+
+    /* Error Check */
+    if((context != NULL) && (context->Configuration != NULL) && (Length > 0))
+    {
+        /* Set Up (Table Engines Keep A Reflected Register, The Shift Works On The Unreflected One) */
+        crc = context->crc;
+        reflected = ((context->Configuration->lookupTable != NULL) && context->Configuration->reflectIn);
+        if(reflected)
+            crc = misc_reflect64(crc);
+
+        /* Shift (Zero Bytes Only Multiply The Register By x^(8 * Length), O(log Length) Multiplications) */
+        crc = (uint64_t)crc_shift(crc, context->Configuration->polynomial, 64, Length);
+        if(reflected)
+            crc = misc_reflect64(crc);
+        context->crc = crc;
+        context->length += Length;
+    }
+}
+
+/*** Copy And Calculate ***/
+uint64_t crc64_copyAndCalculate(const crc64_configuration_t * const Configuration, uint8_t * const destination, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal)
+{
+    /*** Copy And Calculate ***/
+    /* Variable */
+    size_t blockLength;
+    crc64_context_t context;
+    uint64_t crc;
+    size_t i;
+
+    /* Set Up */
+    crc = 0x0000000000000000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (destination != NULL) && (Source != NULL))
+    {
+        /* Copy And Calculate (Each Block Is Checksummed While Still In Cache From The Copy) */
+        crc64_contextInit(&context, Configuration);
+        for(i = 0; i < DataLength; i += blockLength)
+        {
+            blockLength = ((DataLength - i) < CRC_COPY_BLOCK_SIZE) ? (DataLength - i) : CRC_COPY_BLOCK_SIZE;
+            crc_copy(destination + i, Source + i, blockLength, NonTemporal);
+            crc64_contextUpdate(&context, Source + i, blockLength);
+        }
+        crc = crc64_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Copy And Calculate And Append ***/
+void crc64_copyAndCalculateAndAppend(const crc64_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal)
+{
+    /*** Copy And Calculate And Append ***/
+    /* Variable */
+    uint64_t crc;
+
+    /* Set Up */
+    crc = 0x0000000000000000;
+
+    /* Error Check */
+    if((Configuration != NULL) && (destination != NULL) && (Source != NULL) && (DestinationLength >= (DataLength + sizeof(crc))))
+    {
+        /* Copy, Calculate, And Append */
+        crc = crc64_copyAndCalculate(Configuration, destination, Source, DataLength, NonTemporal);
+        misc_insert64(destination + DataLength, DestinationLength - DataLength, crc, !Configuration->reflectOut);
+    }
+}
+
 /*** Deinitialize ***/
 void crc64_deinit(crc64_configuration_t * const configuration)
 {
@@ -144,20 +575,45 @@ void crc64_deinit(crc64_configuration_t * const configuration)
     /* Error Check */
     if(configuration != NULL)
     {
-        /* Deinitialize */
-        memory_free((void **)&(configuration->lookupTable));
+        /* Deinitialize (Lookup Table Is Read Only, Nothing To Free) */
         memset(configuration, 0, sizeof(*configuration));
     }
 }
 
+/*** Fork ***/
+uint64_t crc64_fork(const crc64_context_t * const Snapshot, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Fork ***/
+    /* Variable */
+    crc64_context_t context;
+    uint64_t crc;
+
+    /* Set Up */
+    crc = 0x0000000000000000;
+
+    /* Error Check */
+    if((Snapshot != NULL) && (Snapshot->Configuration != NULL) && ((Data != NULL) || (DataLength == 0)))
+    {
+        /* Resume (The Snapshot Is Only Read, So One Prefix Serves Any Number Of Frames) */
+        context = *Snapshot;
+        if(DataLength > 0)
+            crc64_contextUpdate(&context, Data, DataLength);
+        crc = crc64_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+
 /*** Initialize ***/
-void crc64_init(const char * const Name, crc64_configuration_t * const configuration, const bool CreateLookupTable)
+void crc64_init(const char * const Name, crc64_configuration_t * const configuration, const crc64_engine_t Engine)
 {
     /*** Initialize ***/
     /* Variable */
+    const crc_name_t *algorithm;
+    crc64_engine_t engine;
     bool found;
-    size_t i, j;
-    uint64_t *lookupTable;
+    size_t i;
 
     /* Set Up */
     found = false;
@@ -165,33 +621,12 @@ void crc64_init(const char * const Name, crc64_configuration_t * const configura
     /* Error Check */
     if((Name != NULL) && (configuration != NULL))
     {
-        /* Algorithm */
-        for(i = 0; i < crc64_ConfigurationCount; i++)
+        /* Algorithm (Perfect Hash Over Every Width, Width Must Match) */
+        if(((algorithm = crc_lookup(Name)) != NULL) && (algorithm->width == 64))
         {
-            /* Name */
-            if(strcmp(Name, crc64_Configuration[i].Name) == 0)
-            {
-                /* Found */
-                found = true;
-                break;
-            }
-            else
-            {
-                /* Alias */
-                for(j = 0; j < crc64_Configuration[i].aliasCount; j++)
-                {
-                    if(strcmp(Name, crc64_Configuration[i].Alias[j]) == 0)
-                    {
-                        /* Found */
-                        found = true;
-                        break;
-                    }
-                }
-
-                /* Found */
-                if(found)
-                    break;
-            }
+            /* Found */
+            found = true;
+            i = algorithm->index;
         }
 
         /* Found */
@@ -200,16 +635,29 @@ void crc64_init(const char * const Name, crc64_configuration_t * const configura
             /* Copy */
             (void)memcpy(configuration, &crc64_Configuration[i], sizeof(crc64_Configuration[i]));
 
-            /* Generate Lookup Table */
-            if(CreateLookupTable)
+            /* Engine (Tier Override Wins, Automatic Picks The Fastest This CPU Supports) */
+            engine = crc64_selectEngine(configuration, Engine);
+
+            /* Lookup Table (Generated At Build Time, Shared Read Only) */
+            if((engine == CRC64_ENGINE_LOOKUP_TABLE) || (engine == CRC64_ENGINE_CLMUL))
             {
-                if((lookupTable = memory_malloc(CRC64_LOOKUP_TABLE_MEMORY_SIZE)) != NULL)
+                /* Set */
+                configuration->engine = engine;
+                configuration->lookupTable = crc64_LookupTable[i];
+
+                /* Carry-Less Multiplication (Lookup Table Handles Short Tails And CPUs Without Support) */
+                if(engine == CRC64_ENGINE_CLMUL)
                 {
-                    for(i = 0; i < 256; i++)
-                        lookupTable[i] = crc64_calculatePartial(configuration, 0x0000000000000000, (uint8_t)i, true, true) ^ configuration->xorOut;
-                    configuration->lookupTable = lookupTable;
+                    if(crc_clmulSupported())
+                        crc_clmulInit(&configuration->clmul, configuration->polynomial, 64, configuration->reflectIn);
+                    else
+                        configuration->engine = CRC64_ENGINE_LOOKUP_TABLE;
                 }
             }
+
+            /* Kernel (Specialized Lookup Table Calculate) */
+            if(configuration->engine == CRC64_ENGINE_LOOKUP_TABLE)
+                configuration->kernel = crc64_Kernel[i];
         }
         else
         {
@@ -219,6 +667,206 @@ void crc64_init(const char * const Name, crc64_configuration_t * const configura
     }
 }
 
+/*** Patch ***/
+uint64_t crc64_patch(const crc64_configuration_t * const Configuration, const uint64_t OldCrc, const size_t Offset, const uint8_t * const OldData, const uint8_t * const NewData, const size_t DataLength, const size_t TotalLength)
+{
+    /*** Patch ***/
+    /* Variable */
+    uint64_t crc;
+    uint8_t delta[64];
+    uint64_t deltaCrc;
+    size_t i, j, length;
+    bool reflected;
+
+    /* Set Up */
+    crc = OldCrc;
+
+    /* Error Check */
+    if((Configuration != NULL) && (OldData != NULL) && (NewData != NULL) && (Offset <= TotalLength) && (DataLength <= (TotalLength - Offset)))
+    {
+        /* Delta (CRC Is Linear, So Only The XOR Of The Changed Bytes From A Zero Register Matters) */
+        deltaCrc = 0x0000000000000000;
+        for(i = 0; i < DataLength; i += length)
+        {
+            length = ((DataLength - i) < sizeof(delta)) ? (DataLength - i) : sizeof(delta);
+            for(j = 0; j < length; j++)
+                delta[j] = OldData[i + j] ^ NewData[i + j];
+            deltaCrc = crc64_update(Configuration, deltaCrc, delta, length);
+        }
+
+        /* Shift Over The Bytes After The Patch (Table Engines Keep A Reflected Register) */
+        reflected = ((Configuration->lookupTable != NULL) && Configuration->reflectIn);
+        if(reflected)
+            deltaCrc = misc_reflect64(deltaCrc);
+        deltaCrc = (uint64_t)crc_shift(deltaCrc, Configuration->polynomial, 64, TotalLength - Offset - DataLength);
+
+        /* Apply (xorOut Cancels Out, Reflection Distributes Over XOR) */
+        if(reflected || ((Configuration->lookupTable == NULL) && Configuration->reflectOut))
+            deltaCrc = misc_reflect64(deltaCrc);
+        crc ^= deltaCrc;
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Rolling Deinitialize ***/
+void crc64_rollingDeinit(crc64_rolling_t * const rolling)
+{
+    /*** Rolling Deinitialize ***/
+    /* Error Check */
+    if((rolling != NULL) && (rolling->window != NULL))
+    {
+        /* Deinitialize */
+        memory_free((void **)&rolling->window);
+        rolling->windowLength = 0;
+    }
+}
+
+/*** Rolling Final ***/
+uint64_t crc64_rollingFinal(const crc64_rolling_t * const Rolling)
+{
+    /*** Rolling Final ***/
+    /* Variable */
+    uint64_t crc;
+
+    /* Set Up */
+    crc = 0x0000000000000000;
+
+    /* Error Check */
+    if((Rolling != NULL) && (Rolling->window != NULL))
+    {
+        /* Final (Same As Calculate Over The Last Window Length Bytes, Zeros Before The First Byte) */
+        crc = Rolling->crc;
+        if(Rolling->reflectOut)
+            crc = misc_reflect64(crc);
+        crc ^= Rolling->xorOut;
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Rolling Initialize ***/
+bool crc64_rollingInit(crc64_rolling_t * const rolling, const crc64_configuration_t * const Configuration, const size_t WindowLength)
+{
+    /*** Rolling Initialize ***/
+    /* Variable */
+    size_t bit;
+    uint64_t crc;
+    uint64_t initial[2];
+    size_t i;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((rolling != NULL) && (Configuration != NULL) && (WindowLength > 0))
+    {
+        /* Window (Starts As Zeros So The Update Loop Never Branches On Fill Level) */
+        memset(rolling, 0, sizeof(*rolling));
+        if((rolling->window = memory_malloc(WindowLength)) != NULL)
+        {
+            /* Set Up */
+            memset(rolling->window, 0, WindowLength);
+            rolling->reflect = Configuration->reflectIn;
+            rolling->reflectOut = (Configuration->reflectIn != Configuration->reflectOut);
+            rolling->windowLength = WindowLength;
+            rolling->xorOut = Configuration->xorOut;
+
+            /* Lookup Table (Own Copy, The Configuration May Use The Loop Engine) */
+            for(i = 0; i < CRC64_LOOKUP_TABLE_COUNT; i++)
+            {
+                if(rolling->reflect)
+                {
+                    crc = (uint64_t)i;
+                    for(bit = 0; bit < 8; bit++)
+                        crc = (crc & 1) ? ((crc >> 1) ^ misc_reflect64(Configuration->polynomial)) : (crc >> 1);
+                }
+                else
+                {
+                    crc = (uint64_t)i << 56;
+                    for(bit = 0; bit < 8; bit++)
+                        crc = (crc & 0x8000000000000000) ? ((crc << 1) ^ Configuration->polynomial) : (crc << 1);
+                }
+                rolling->table[i] = crc;
+            }
+
+            /* Initial (Register After Window Length And Window Length + 1 Zero Bytes) */
+            for(i = 0; i < 2; i++)
+            {
+                initial[i] = (uint64_t)crc_shift(Configuration->initial, Configuration->polynomial, 64, WindowLength + i);
+                if(rolling->reflect)
+                    initial[i] = misc_reflect64(initial[i]);
+            }
+            rolling->crc = initial[0];
+
+            /* Out Table (Byte Followed By Window Length Zeros, Plus The Initial Drift From The Extra Byte) */
+            for(i = 0; i < CRC64_LOOKUP_TABLE_COUNT; i++)
+            {
+                crc = rolling->table[i];
+                if(rolling->reflect)
+                    crc = misc_reflect64((uint64_t)crc_shift(misc_reflect64(crc), Configuration->polynomial, 64, WindowLength));
+                else
+                    crc = (uint64_t)crc_shift(crc, Configuration->polynomial, 64, WindowLength);
+                rolling->outTable[i] = crc ^ initial[0] ^ initial[1];
+            }
+            success = true;
+        }
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Rolling Scan ***/
+size_t crc64_rollingScan(crc64_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength, const uint64_t Mask, const uint64_t Match)
+{
+    /*** Rolling Scan ***/
+    /* Variable */
+    size_t scanned;
+
+    /* Set Up */
+    scanned = DataLength;
+
+    /* Error Check */
+    if((rolling != NULL) && (rolling->window != NULL) && (Data != NULL))
+    {
+        /* Scan (Stops After The Byte That Completes A Boundary) */
+        scanned = crc64_roll(rolling, Data, DataLength, Mask, Match, true);
+    }
+
+    /* Exit */
+    return scanned;
+}
+
+/*** Rolling Update ***/
+void crc64_rollingUpdate(crc64_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Rolling Update ***/
+    /* Error Check */
+    if((rolling != NULL) && (rolling->window != NULL) && (Data != NULL))
+    {
+        /* Update */
+        (void)crc64_roll(rolling, Data, DataLength, 0, 0, false);
+    }
+}
+
+/*** Snapshot ***/
+void crc64_snapshot(const crc64_configuration_t * const Configuration, const uint8_t *Prefix, const size_t PrefixLength, crc64_context_t * const snapshot)
+{
+    /*** Snapshot ***/
+    /* Error Check */
+    if((Configuration != NULL) && ((Prefix != NULL) || (PrefixLength == 0)) && (snapshot != NULL))
+    {
+        /* Prefix (Register State After The Shared Header, Resumed By Fork Or By Copying Into A Context) */
+        crc64_contextInit(snapshot, Configuration);
+        if(PrefixLength > 0)
+            crc64_contextUpdate(snapshot, Prefix, PrefixLength);
+    }
+}
+
 /*** Verify ***/
 bool crc64_verify(const crc64_configuration_t * const Configuration, const uint8_t *Buffer, const size_t BufferLength)
 {
@@ -241,3 +889,285 @@ bool crc64_verify(const crc64_configuration_t * const Configuration, const uint8
     /* Exit */
     return verified;
 }
+
+/*** Verify List ***/
+bool crc64_verifyList(const crc64_configuration_t * const Configuration, const list_list_t * const List)
+{
+    /*** Verify List ***/
+    /* Variable */
+    uint64_t crc;
+    bool verified;
+
+    /* Set Up */
+    verified = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (List != NULL))
+    {
+        /* Verify */
+        crc = crc64_calculateList(Configuration, List);
+        verified = ((crc ^ Configuration->xorOut) == Configuration->residue);
+    }
+
+    /* Exit */
+    return verified;
+}
+
+#ifdef CRC_IOVEC_AVAILABLE
+/*** Verify Vector ***/
+bool crc64_verifyV(const crc64_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount)
+{
+    /*** Verify Vector ***/
+    /* Variable */
+    uint64_t crc;
+    bool verified;
+
+    /* Set Up */
+    verified = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Vector != NULL))
+    {
+        /* Verify */
+        crc = crc64_calculateV(Configuration, Vector, VectorCount);
+        verified = ((crc ^ Configuration->xorOut) == Configuration->residue);
+    }
+
+    /* Exit */
+    return verified;
+}
+#endif
+
+/*** Kernels ***/
+CRC64_KERNEL_LIST(CRC64_KERNEL_DEFINITION)
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+#ifdef CRC_PTHREAD_AVAILABLE
+/*** Calculate Worker ***/
+static void *crc64_calculateWorker(void *worker)
+{
+    /*** Calculate Worker ***/
+    /* Variable */
+    crc64_worker_t *crcWorker;
+
+    /* Set Up */
+    crcWorker = (crc64_worker_t *)worker;
+
+    /* Calculate */
+    crcWorker->crc = crc64_calculate(crcWorker->Configuration, crcWorker->Data, crcWorker->dataLength);
+
+    /* Exit */
+    return NULL;
+}
+#endif
+
+#ifdef CRC_FILE_AVAILABLE
+/*** File Update ***/
+static void crc64_fileUpdate(void * const context, const uint8_t *Data, const size_t DataLength)
+{
+    /*** File Update ***/
+    /* Update */
+    crc64_contextUpdate(context, Data, DataLength);
+}
+
+/*** File Zero ***/
+static void crc64_fileZero(void * const context, const uint64_t Length)
+{
+    /*** File Zero ***/
+    /* Zero */
+    crc64_contextZero(context, Length);
+}
+#endif
+
+/*** Kernel ***/
+static CRC_ALWAYS_INLINE uint64_t crc64_kernel(const uint64_t * const LookupTable, const uint64_t Initial, const uint64_t TableInitial, const bool ReflectIn, const uint64_t XorOut, const uint8_t *Data, size_t dataLength)
+{
+    /*** Kernel ***/
+    /* Variable */
+    uint64_t crc;
+
+    /* Set Up (Nothing Consumed Returns Initial, Same As Calculate) */
+    crc = 0x0000000000000000;
+
+    /* Error Check */
+    if(Data != NULL)
+    {
+        /* Set Up */
+        crc = Initial;
+
+        /* Lookup Table (Every Argument Is A Constant From The Kernel List, Folded At Compile Time) */
+        if(dataLength > 0)
+        {
+            crc = TableInitial;
+            if(ReflectIn)
+            {
+                while(dataLength-- > 0)
+                    crc = (crc >> 8) ^ LookupTable[(crc ^ *Data++) & 0xFF];
+            }
+            else
+            {
+                while(dataLength-- > 0)
+                    crc = ((crc << 8) ^ LookupTable[(crc >> 56) ^ *Data++]);
+            }
+            crc ^= XorOut;
+        }
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Roll ***/
+static CRC_ALWAYS_INLINE size_t crc64_roll(crc64_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength, const uint64_t Mask, const uint64_t Match, const bool Scan)
+{
+    /*** Roll ***/
+    /* Variable */
+    uint64_t crc;
+    size_t i;
+    size_t index;
+    uint64_t mask;
+    uint64_t match;
+    uint8_t out;
+    const uint64_t * const OutTable = rolling->outTable;
+    const bool Reflect = rolling->reflect;
+    const uint64_t * const Table = rolling->table;
+    uint8_t * const Window = rolling->window;
+    const size_t WindowLength = rolling->windowLength;
+
+    /* Set Up (Match Moved Into The Register Domain, No Per Byte Reflect Or Xor Out) */
+    crc = rolling->crc;
+    index = rolling->index;
+    mask = rolling->reflectOut ? misc_reflect64(Mask) : Mask;
+    match = (rolling->reflectOut ? misc_reflect64(Match ^ rolling->xorOut) : (Match ^ rolling->xorOut)) & mask;
+
+    /* Roll (Byte Leaving The Window Comes From The Saved Window At First, Straight From Data After That) */
+    for(i = 0; i < DataLength; )
+    {
+        if(i < WindowLength)
+        {
+            out = Window[index];
+            Window[index] = Data[i];
+            if(++index == WindowLength)
+                index = 0;
+        }
+        else
+        {
+            out = Data[i - WindowLength];
+        }
+        if(Reflect)
+            crc = (crc >> 8) ^ Table[(crc ^ Data[i]) & 0xFF] ^ OutTable[out];
+        else
+            crc = (crc << 8) ^ Table[(crc >> 56) ^ Data[i]] ^ OutTable[out];
+        i++;
+        if(Scan && ((crc & mask) == match))
+            break;
+    }
+
+    /* Window (Last Window Length Bytes Consumed, Oldest First) */
+    if(i >= WindowLength)
+    {
+        (void)memcpy(Window, &Data[i - WindowLength], WindowLength);
+        index = 0;
+    }
+    rolling->crc = crc;
+    rolling->index = index;
+
+    /* Exit */
+    return i;
+}
+
+/*** Select Engine ***/
+static crc64_engine_t crc64_selectEngine(const crc64_configuration_t * const Configuration, const crc64_engine_t Engine)
+{
+    /*** Select Engine ***/
+    /* Variable */
+    crc64_engine_t engine;
+
+    /* Unused */
+    (void)Configuration;
+
+    /* Tier Override (No Slicing Or Hardware At This Width, Lookup Table Stands In) */
+    switch(crc_tierGet())
+    {
+        case CRC_TIER_LOOP:
+            engine = CRC64_ENGINE_LOOP;
+            break;
+        case CRC_TIER_LOOKUP_TABLE:
+        case CRC_TIER_SLICING:
+        case CRC_TIER_HARDWARE:
+            engine = CRC64_ENGINE_LOOKUP_TABLE;
+            break;
+        case CRC_TIER_CLMUL:
+            engine = CRC64_ENGINE_CLMUL;
+            break;
+        default:
+            engine = Engine;
+            break;
+    }
+
+    /* Automatic (Carry-Less Multiplication, Falls Back To Lookup Table Without Support) */
+    if(engine == CRC64_ENGINE_AUTOMATIC)
+        engine = CRC64_ENGINE_CLMUL;
+
+    /* Exit */
+    return engine;
+}
+
+/*** Update ***/
+static uint64_t crc64_update(const crc64_configuration_t * const Configuration, uint64_t crc, const uint8_t *Data, size_t dataLength)
+{
+    /*** Update ***/
+    /* Variable */
+    size_t bit, length;
+    const uint64_t *LookupTable;
+
+    /* Set Up */
+    LookupTable = Configuration->lookupTable;
+
+    /* Carry-Less Multiplication */
+    if((Configuration->engine == CRC64_ENGINE_CLMUL) && (dataLength >= CRC_CLMUL_MINIMUM_LENGTH))
+    {
+        length = dataLength - (dataLength % CRC_CLMUL_BLOCK_SIZE);
+        crc = (uint64_t)crc_clmulUpdate(&Configuration->clmul, crc, Data, length);
+        Data += length;
+        dataLength -= length;
+    }
+
+    /* Byte At A Time */
+    if(LookupTable == NULL)
+    {
+        /* Loop */
+        while(dataLength-- > 0)
+        {
+            if(Configuration->reflectIn)
+                crc ^= ((uint64_t)misc_reflect8(*Data++) << 56);
+            else
+                crc ^= ((uint64_t)*Data++ << 56);
+            for(bit = 0; bit < 8; bit++)
+            {
+                if((crc & 0x8000000000000000) == 0x8000000000000000)
+                    crc = ((crc << 1) ^ Configuration->polynomial);
+                else
+                    crc <<= 1;
+            }
+        }
+    }
+    else if(Configuration->reflectIn)
+    {
+        /* Lookup Table (Reflected) */
+        while(dataLength-- > 0)
+            crc = (crc >> 8) ^ LookupTable[(crc ^ *Data++) & 0xFF];
+    }
+    else
+    {
+        /* Lookup Table */
+        while(dataLength-- > 0)
+            crc = ((crc << 8) ^ LookupTable[(crc >> 56) ^ *Data++]);
+    }
+
+    /* Exit */
+    return crc;
+}
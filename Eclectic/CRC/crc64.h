@@ -8,14 +8,20 @@
  * Defines
  ****************************************************************************************************/
 
+#define CRC64_KERNEL_PROTOTYPE(IDENTIFIER, INDEX, INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT) extern uint64_t crc64_##IDENTIFIER##_calculate(const uint8_t *Data, const size_t DataLength);
 #define CRC64_LOOKUP_TABLE_COUNT (256)
 #define CRC64_LOOKUP_TABLE_MEMORY_SIZE (CRC64_LOOKUP_TABLE_COUNT * sizeof(uint64_t))
 #define CRC64_MAXIMUM_ALIAS_COUNT (1)
+#define CRC64_PARALLEL_MAXIMUM_THREAD_COUNT (16)
+#define CRC64_PARALLEL_MINIMUM_LENGTH (1024 * 1024) // Per Thread, Shorter Buffers Stay Single Threaded
 
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc64_kernel.h"
+#include "Eclectic/Data/list.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -24,14 +30,29 @@
  * Type Definitions
  ****************************************************************************************************/
 
+/*** Enumerations ***/
+typedef enum crc64_engine_e
+{
+    CRC64_ENGINE_LOOP,
+    CRC64_ENGINE_LOOKUP_TABLE,
+    CRC64_ENGINE_CLMUL,
+    CRC64_ENGINE_AUTOMATIC
+} crc64_engine_t;
+
+/*** Callbacks ***/
+typedef uint64_t (*crc64_kernelCallback_t)(const uint8_t *Data, const size_t DataLength);
+
 /*** Structures ***/
 typedef struct crc64_configuration_s
 {
     char *Alias[CRC64_MAXIMUM_ALIAS_COUNT];
     size_t aliasCount;
     uint64_t check;
+    crc_clmul_t clmul;
+    crc64_engine_t engine;
     uint64_t initial;
-    uint64_t *lookupTable;
+    crc64_kernelCallback_t kernel;
+    const uint64_t *lookupTable;
     char *Name;
     uint64_t polynomial;
     bool reflectIn;
@@ -40,13 +61,80 @@ typedef struct crc64_configuration_s
     uint64_t xorOut;
 } crc64_configuration_t;
 
+typedef struct crc64_context_s
+{
+    const crc64_configuration_t *Configuration;
+    uint64_t crc;
+    uint64_t length;
+} crc64_context_t;
+
+typedef struct crc64_rolling_s
+{
+    uint64_t crc; // Register Over The Window, Reflected When Reflect In
+    size_t index; // Oldest Byte In The Window
+    uint64_t outTable[CRC64_LOOKUP_TABLE_COUNT]; // Cancels The Byte Leaving The Window
+    bool reflect;
+    bool reflectOut; // Register Reflected Once More On The Way Out
+    uint64_t table[CRC64_LOOKUP_TABLE_COUNT];
+    uint8_t *window;
+    size_t windowLength;
+    uint64_t xorOut;
+} crc64_rolling_t;
+
+typedef struct crc64_worker_s
+{
+    const crc64_configuration_t *Configuration;
+    uint64_t crc;
+    const uint8_t *Data;
+    size_t dataLength;
+} crc64_worker_t;
+
+/****************************************************************************************************
+ * Constants
+ ****************************************************************************************************/
+
+extern const crc64_configuration_t crc64_Configuration[]; // Catalog, One Entry Per Algorithm (Aliases Folded In)
+extern const size_t crc64_ConfigurationCount;
+
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
 extern uint64_t crc64_calculate(const crc64_configuration_t * const Configuration, const uint8_t *Data, const size_t DataLength);
 extern void crc64_calculateAndAppend(const crc64_configuration_t * const Configuration, uint8_t * const buffer, const size_t BufferLength, const size_t DataLength);
+#ifdef CRC_FILE_AVAILABLE
+extern bool crc64_calculateFile(const crc64_configuration_t * const Configuration, const char * const Path, uint64_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+extern bool crc64_calculateFileDescriptor(const crc64_configuration_t * const Configuration, const int FileDescriptor, uint64_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+extern bool crc64_calculateFileSparse(const crc64_configuration_t * const Configuration, const char * const Path, uint64_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+#endif
+extern uint64_t crc64_calculateList(const crc64_configuration_t * const Configuration, const list_list_t * const List);
+extern uint64_t crc64_calculateParallel(const crc64_configuration_t * const Configuration, const uint8_t *Data, const size_t DataLength, size_t threadCount);
 extern uint64_t crc64_calculatePartial(const crc64_configuration_t * const Configuration, uint64_t crc, const uint8_t Data, const bool First, const bool Last);
+#ifdef CRC_IOVEC_AVAILABLE
+extern uint64_t crc64_calculateV(const crc64_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount);
+#endif
+extern uint64_t crc64_combine(const crc64_configuration_t * const Configuration, uint64_t crcA, const uint64_t LengthA, uint64_t crcB, const uint64_t LengthB);
+extern uint64_t crc64_contextFinal(const crc64_context_t * const Context);
+extern void crc64_contextInit(crc64_context_t * const context, const crc64_configuration_t * const Configuration);
+extern void crc64_contextUpdate(crc64_context_t * const context, const uint8_t *Data, const size_t DataLength);
+extern void crc64_contextZero(crc64_context_t * const context, const uint64_t Length);
+extern uint64_t crc64_copyAndCalculate(const crc64_configuration_t * const Configuration, uint8_t * const destination, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal);
+extern void crc64_copyAndCalculateAndAppend(const crc64_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal);
 extern void crc64_deinit(crc64_configuration_t * const configuration);
-extern void crc64_init(const char * const Name, crc64_configuration_t * const configuration, const bool CreateLookupTable);
+extern uint64_t crc64_fork(const crc64_context_t * const Snapshot, const uint8_t *Data, const size_t DataLength);
+extern void crc64_init(const char * const Name, crc64_configuration_t * const configuration, const crc64_engine_t Engine);
+extern uint64_t crc64_patch(const crc64_configuration_t * const Configuration, const uint64_t OldCrc, const size_t Offset, const uint8_t * const OldData, const uint8_t * const NewData, const size_t DataLength, const size_t TotalLength);
+extern void crc64_rollingDeinit(crc64_rolling_t * const rolling);
+extern uint64_t crc64_rollingFinal(const crc64_rolling_t * const Rolling);
+extern bool crc64_rollingInit(crc64_rolling_t * const rolling, const crc64_configuration_t * const Configuration, const size_t WindowLength);
+extern size_t crc64_rollingScan(crc64_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength, const uint64_t Mask, const uint64_t Match);
+extern void crc64_rollingUpdate(crc64_rolling_t * const rolling, const uint8_t *Data, const size_t DataLength);
+extern void crc64_snapshot(const crc64_configuration_t * const Configuration, const uint8_t *Prefix, const size_t PrefixLength, crc64_context_t * const snapshot);
 extern bool crc64_verify(const crc64_configuration_t * const Configuration, const uint8_t *Buffer, const size_t BufferLength);
+extern bool crc64_verifyList(const crc64_configuration_t * const Configuration, const list_list_t * const List);
+#ifdef CRC_IOVEC_AVAILABLE
+extern bool crc64_verifyV(const crc64_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount);
+#endif
+
+/* Kernels (One Per Catalog Entry, e.g. crc64_xz_calculate) */
+CRC64_KERNEL_LIST(CRC64_KERNEL_PROTOTYPE)
@@ -0,0 +1,18 @@
+/****************************************************************************************************
+ * Pragmas
+ ****************************************************************************************************/
+
+#pragma once
+
+/****************************************************************************************************
+ * Defines (Generated By Project/Script/crc_table.py, Do Not Edit)
+ ****************************************************************************************************/
+
+#define CRC64_KERNEL_LIST(KERNEL) \
+    KERNEL(ecma_182, 0, 0x0000000000000000, 0x0000000000000000, false, 0x0000000000000000) \
+    KERNEL(go_iso, 1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, true, 0xFFFFFFFFFFFFFFFF) \
+    KERNEL(ms, 2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, true, 0x0000000000000000) \
+    KERNEL(nvme, 3, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, true, 0xFFFFFFFFFFFFFFFF) \
+    KERNEL(redis, 4, 0x0000000000000000, 0x0000000000000000, true, 0x0000000000000000) \
+    KERNEL(we, 5, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, false, 0xFFFFFFFFFFFFFFFF) \
+    KERNEL(xz, 6, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, true, 0xFFFFFFFFFFFFFFFF)
@@ -1,13 +1,29 @@
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CRC8_KERNEL_DEFINITION(IDENTIFIER, INDEX, INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT)                         \
+    uint8_t crc8_##IDENTIFIER##_calculate(const uint8_t *Data, const size_t DataLength)                                  \
+    {                                                                                                                  \
+        return crc8_kernel(crc8_LookupTable[INDEX], INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT, Data, DataLength); \
+    }
+#define CRC8_KERNEL_POINTER(IDENTIFIER, ...) crc8_##IDENTIFIER##_calculate,
+
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
+#include "Eclectic/CRC/crc.h"
 #include "Eclectic/CRC/crc8.h"
-#include "Eclectic/Miscellaneous/memory.h"
+#include "Eclectic/CRC/crc8_table.h"
 #include "Eclectic/Miscellaneous/misc.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#ifdef CRC_FILE_AVAILABLE
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 /****************************************************************************************************
  * Constants
@@ -15,27 +31,38 @@
 
 const crc8_configuration_t crc8_Configuration[] =
     {
-        {{}, 0, 0xDF, 0xFF, NULL, "CRC-8/AUTOSAR", 0x2F, false, false, 0x42, 0xFF},
-        {{}, 0, 0x26, 0x00, NULL, "CRC-8/BLUETOOTH", 0xA7, true, true, 0x00, 0x00},
-        {{}, 0, 0xDA, 0xFF, NULL, "CRC-8/CDMA2000", 0x9B, false, false, 0x00, 0x00},
-        {{}, 0, 0x15, 0x00, NULL, "CRC-8/DARC", 0x39, true, true, 0x00, 0x00},
-        {{}, 0, 0xBC, 0x00, NULL, "CRC-8/DVB-S2", 0xD5, false, false, 0x00, 0x00},
-        {{}, 0, 0x37, 0x00, NULL, "CRC-8/GSM-A", 0x1D, false, false, 0x00, 0x00},
-        {{}, 0, 0x94, 0x00, NULL, "CRC-8/GSM-B", 0x49, false, false, 0x53, 0xFF},
-        {{}, 0, 0xB4, 0xFF, NULL, "CRC-8/HITAG", 0x1D, false, false, 0x00, 0x00},
-        {{"CRC-8/ITU"}, 1, 0xA1, 0x00, NULL, "CRC-8/I-432-1", 0x07, false, false, 0xAC, 0x55},
-        {{}, 0, 0x7E, 0xFD, NULL, "CRC-8/I-CODE", 0x1D, false, false, 0x00, 0x00},
-        {{}, 0, 0xEA, 0x00, NULL, "CRC-8/LTE", 0x9B, false, false, 0x00, 0x00},
-        {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, NULL, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00},
-        {{}, 0, 0x99, 0xC7, NULL, "CRC-8/MIFARE-MAD", 0x1D, false, false, 0x00, 0x00},
-        {{}, 0, 0xF7, 0xFF, NULL, "CRC-8/NRSC-5", 0x31, false, false, 0x00, 0x00},
-        {{}, 0, 0x3E, 0x00, NULL, "CRC-8/OPENSAFETY", 0x2F, false, false, 0x00, 0x00},
-        {{}, 0, 0xD0, 0xFF, NULL, "CRC-8/ROHC", 0x07, true, true, 0x00, 0x00},
-        {{}, 0, 0x4B, 0xFF, NULL, "CRC-8/SAE-J1850", 0x1D, false, false, 0xC4, 0xFF},
-        {{"CRC-8"}, 1, 0xF4, 0x00, NULL, "CRC-8/SMBUS", 0x07, false, false, 0x00, 0x00},
-        {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, NULL, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00},
-        {{}, 0, 0x25, 0x00, NULL, "CRC-8/WCDMA", 0x9B, true, true, 0x00, 0x00}};
+        {{}, 0, 0xDF, 0xFF, NULL, NULL, "CRC-8/AUTOSAR", 0x2F, false, false, 0x42, 0xFF},
+        {{}, 0, 0x26, 0x00, NULL, NULL, "CRC-8/BLUETOOTH", 0xA7, true, true, 0x00, 0x00},
+        {{}, 0, 0xDA, 0xFF, NULL, NULL, "CRC-8/CDMA2000", 0x9B, false, false, 0x00, 0x00},
+        {{}, 0, 0x15, 0x00, NULL, NULL, "CRC-8/DARC", 0x39, true, true, 0x00, 0x00},
+        {{}, 0, 0xBC, 0x00, NULL, NULL, "CRC-8/DVB-S2", 0xD5, false, false, 0x00, 0x00},
+        {{}, 0, 0x37, 0x00, NULL, NULL, "CRC-8/GSM-A", 0x1D, false, false, 0x00, 0x00},
+        {{}, 0, 0x94, 0x00, NULL, NULL, "CRC-8/GSM-B", 0x49, false, false, 0x53, 0xFF},
+        {{}, 0, 0xB4, 0xFF, NULL, NULL, "CRC-8/HITAG", 0x1D, false, false, 0x00, 0x00},
+        {{"CRC-8/ITU"}, 1, 0xA1, 0x00, NULL, NULL, "CRC-8/I-432-1", 0x07, false, false, 0xAC, 0x55},
+        {{}, 0, 0x7E, 0xFD, NULL, NULL, "CRC-8/I-CODE", 0x1D, false, false, 0x00, 0x00},
+        {{}, 0, 0xEA, 0x00, NULL, NULL, "CRC-8/LTE", 0x9B, false, false, 0x00, 0x00},
+        {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, NULL, NULL, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00},
+        {{}, 0, 0x99, 0xC7, NULL, NULL, "CRC-8/MIFARE-MAD", 0x1D, false, false, 0x00, 0x00},
+        {{}, 0, 0xF7, 0xFF, NULL, NULL, "CRC-8/NRSC-5", 0x31, false, false, 0x00, 0x00},
+        {{}, 0, 0x3E, 0x00, NULL, NULL, "CRC-8/OPENSAFETY", 0x2F, false, false, 0x00, 0x00},
+        {{}, 0, 0xD0, 0xFF, NULL, NULL, "CRC-8/ROHC", 0x07, true, true, 0x00, 0x00},
+        {{}, 0, 0x4B, 0xFF, NULL, NULL, "CRC-8/SAE-J1850", 0x1D, false, false, 0xC4, 0xFF},
+        {{"CRC-8"}, 1, 0xF4, 0x00, NULL, NULL, "CRC-8/SMBUS", 0x07, false, false, 0x00, 0x00},
+        {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, NULL, NULL, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00},
+        {{}, 0, 0x25, 0x00, NULL, NULL, "CRC-8/WCDMA", 0x9B, true, true, 0x00, 0x00}};
 const size_t crc8_ConfigurationCount = sizeof(crc8_Configuration) / sizeof(crc8_Configuration[0]);
+static const crc8_kernelCallback_t crc8_Kernel[] = {CRC8_KERNEL_LIST(CRC8_KERNEL_POINTER)};
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+#ifdef CRC_FILE_AVAILABLE
+static void crc8_fileUpdate(void * const context, const uint8_t *Data, const size_t DataLength);
+#endif
+static CRC_ALWAYS_INLINE uint8_t crc8_kernel(const uint8_t * const LookupTable, const uint8_t Initial, const uint8_t TableInitial, const bool ReflectIn, const uint8_t XorOut, const uint8_t *Data, size_t dataLength);
+static uint8_t crc8_update(const crc8_configuration_t * const Configuration, uint8_t crc, const uint8_t *Data, size_t dataLength);
 
 /****************************************************************************************************
  * Function Definitions (Public)
@@ -46,8 +73,8 @@ uint8_t crc8_calculate(const crc8_configuration_t * const Configuration, const u
 {
     /*** Calculate ***/
     /* Variable */
+    crc8_context_t context;
     uint8_t crc;
-    size_t i;
 
     /* Set Up */
     crc = 0x00;
@@ -55,12 +82,17 @@ uint8_t crc8_calculate(const crc8_configuration_t * const Configuration, const u
     /* Error Check */
     if((Configuration != NULL) && (Data != NULL))
     {
-        /* Set Up */
-        crc = Configuration->initial;
-
-        /* Calculate */
-        for(i = 0; i < DataLength; i++)
-            crc = crc8_calculatePartial(Configuration, crc, Data[i], (i == (DataLength - 1)));
+        /* Calculate (Specialized Kernel When Installed) */
+        if(Configuration->kernel != NULL)
+        {
+            crc = Configuration->kernel(Data, DataLength);
+        }
+        else
+        {
+            crc8_contextInit(&context, Configuration);
+            crc8_contextUpdate(&context, Data, DataLength);
+            crc = crc8_contextFinal(&context);
+        }
     }
 
     /* Exit */
@@ -86,6 +118,87 @@ void crc8_calculateAndAppend(const crc8_configuration_t * const Configuration, u
     }
 }
 
+#ifdef CRC_FILE_AVAILABLE
+/*** Calculate File ***/
+bool crc8_calculateFile(const crc8_configuration_t * const Configuration, const char * const Path, uint8_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** Calculate File ***/
+    /* Variable */
+    int fileDescriptor;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Path != NULL) && (crc != NULL) && ((fileDescriptor = open(Path, O_RDONLY | O_CLOEXEC)) >= 0))
+    {
+        /* Calculate */
+        success = crc8_calculateFileDescriptor(Configuration, fileDescriptor, crc, ProgressCallback, progressArgument, statistics);
+        (void)close(fileDescriptor);
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Calculate File Descriptor ***/
+bool crc8_calculateFileDescriptor(const crc8_configuration_t * const Configuration, const int FileDescriptor, uint8_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics)
+{
+    /*** Calculate File Descriptor ***/
+    /* Variable */
+    crc8_context_t context;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (crc != NULL))
+    {
+        /* Calculate (Mapped Where Possible, Streamed Otherwise) */
+        crc8_contextInit(&context, Configuration);
+        success = crc_fileRead(FileDescriptor, crc8_fileUpdate, &context, ProgressCallback, progressArgument, statistics);
+        if(success)
+            *crc = crc8_contextFinal(&context);
+    }
+
+    /* Exit */
+    return success;
+}
+#endif
+
+/*** Calculate List ***/
+uint8_t crc8_calculateList(const crc8_configuration_t * const Configuration, const list_list_t * const List)
+{
+    /*** Calculate List ***/
+    /* Variable */
+    crc8_context_t context;
+    const list_node_t *node;
+    const struct iovec *Segment;
+    uint8_t crc;
+
+    /* Set Up */
+    crc = 0x00;
+
+    /* Error Check */
+    if((Configuration != NULL) && (List != NULL))
+    {
+        /* Calculate (Node Data Are Segment Descriptors, CRC Carried Across Segments) */
+        crc8_contextInit(&context, Configuration);
+        for(node = List->head; node != NULL; node = node->next)
+        {
+            Segment = node->data;
+            if(Segment != NULL)
+                crc8_contextUpdate(&context, Segment->iov_base, Segment->iov_len);
+        }
+        crc = crc8_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+
 /*** Calculate Partial ***/
 uint8_t crc8_calculatePartial(const crc8_configuration_t * const Configuration, uint8_t crc, const uint8_t Data, const bool Last)
 {
@@ -135,6 +248,140 @@ uint8_t crc8_calculatePartial(const crc8_configuration_t * const Configuration,
     return crc;
 }
 
+#ifdef CRC_IOVEC_AVAILABLE
+/*** Calculate Vector ***/
+uint8_t crc8_calculateV(const crc8_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount)
+{
+    /*** Calculate Vector ***/
+    /* Variable */
+    crc8_context_t context;
+    uint8_t crc;
+    size_t i;
+
+    /* Set Up */
+    crc = 0x00;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Vector != NULL))
+    {
+        /* Calculate (No Copy, Each Segment Goes Through The Bulk Engine, CRC Carried Across Segments) */
+        crc8_contextInit(&context, Configuration);
+        for(i = 0; i < VectorCount; i++)
+            crc8_contextUpdate(&context, Vector[i].iov_base, Vector[i].iov_len);
+        crc = crc8_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+#endif
+
+/*** Context Final ***/
+uint8_t crc8_contextFinal(const crc8_context_t * const Context)
+{
+    /*** Context Final ***/
+    /* Variable */
+    uint8_t crc;
+
+    /* Set Up */
+    crc = 0x00;
+
+    /* Error Check */
+    if((Context != NULL) && (Context->Configuration != NULL))
+    {
+        /* Set Up (Nothing Consumed Returns Initial, Same As Calculate) */
+        crc = Context->Configuration->initial;
+
+        /* Last */
+        if(Context->length > 0)
+        {
+            crc = Context->crc ^ Context->Configuration->xorOut;
+            if((Context->Configuration->lookupTable == NULL) && Context->Configuration->reflectOut)
+                crc = misc_reflect8(crc);
+        }
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Context Initialize ***/
+void crc8_contextInit(crc8_context_t * const context, const crc8_configuration_t * const Configuration)
+{
+    /*** Context Initialize ***/
+    /* Error Check */
+    if((context != NULL) && (Configuration != NULL))
+    {
+        /* Initialize */
+        context->Configuration = Configuration;
+        context->crc = Configuration->initial;
+        context->length = 0;
+    }
+}
+
+/*** Context Update ***/
+void crc8_contextUpdate(crc8_context_t * const context, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Context Update ***/
+    /* Error Check */
+    if((context != NULL) && (context->Configuration != NULL) && (Data != NULL))
+    {
+        /* Update */
+        context->crc = crc8_update(context->Configuration, context->crc, Data, DataLength);
+        context->length += DataLength;
+    }
+}
+
+/*** Copy And Calculate ***/
+uint8_t crc8_copyAndCalculate(const crc8_configuration_t * const Configuration, uint8_t * const destination, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal)
+{
+    /*** Copy And Calculate ***/
+    /* Variable */
+    size_t blockLength;
+    crc8_context_t context;
+    uint8_t crc;
+    size_t i;
+
+    /* Set Up */
+    crc = 0x00;
+
+    /* Error Check */
+    if((Configuration != NULL) && (destination != NULL) && (Source != NULL))
+    {
+        /* Copy And Calculate (Each Block Is Checksummed While Still In Cache From The Copy) */
+        crc8_contextInit(&context, Configuration);
+        for(i = 0; i < DataLength; i += blockLength)
+        {
+            blockLength = ((DataLength - i) < CRC_COPY_BLOCK_SIZE) ? (DataLength - i) : CRC_COPY_BLOCK_SIZE;
+            crc_copy(destination + i, Source + i, blockLength, NonTemporal);
+            crc8_contextUpdate(&context, Source + i, blockLength);
+        }
+        crc = crc8_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Copy And Calculate And Append ***/
+void crc8_copyAndCalculateAndAppend(const crc8_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal)
+{
+    /*** Copy And Calculate And Append ***/
+    /* Variable */
+    uint8_t crc;
+
+    /* Set Up */
+    crc = 0x00;
+
+    /* Error Check */
+    if((Configuration != NULL) && (destination != NULL) && (Source != NULL) && (DestinationLength >= (DataLength + sizeof(crc))))
+    {
+        /* Copy, Calculate, And Append */
+        crc = crc8_copyAndCalculate(Configuration, destination, Source, DataLength, NonTemporal);
+        destination[DataLength] = crc;
+    }
+}
+
 /*** Deinitialize ***/
 void crc8_deinit(crc8_configuration_t * const configuration)
 {
@@ -142,20 +389,45 @@ void crc8_deinit(crc8_configuration_t * const configuration)
     /* Error Check */
     if(configuration != NULL)
     {
-        /* Deinitialize */
-        memory_free((void **)&(configuration->lookupTable));
+        /* Deinitialize (Lookup Table Is Read Only, Nothing To Free) */
         memset(configuration, 0, sizeof(*configuration));
     }
 }
 
+/*** Fork ***/
+uint8_t crc8_fork(const crc8_context_t * const Snapshot, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Fork ***/
+    /* Variable */
+    crc8_context_t context;
+    uint8_t crc;
+
+    /* Set Up */
+    crc = 0x00;
+
+    /* Error Check */
+    if((Snapshot != NULL) && (Snapshot->Configuration != NULL) && ((Data != NULL) || (DataLength == 0)))
+    {
+        /* Resume (The Snapshot Is Only Read, So One Prefix Serves Any Number Of Frames) */
+        context = *Snapshot;
+        if(DataLength > 0)
+            crc8_contextUpdate(&context, Data, DataLength);
+        crc = crc8_contextFinal(&context);
+    }
+
+    /* Exit */
+    return crc;
+}
+
 /*** Initialize ***/
 void crc8_init(const char * const Name, crc8_configuration_t * const configuration, const bool CreateLookupTable)
 {
     /*** Initialize ***/
     /* Variable */
+    const crc_name_t *algorithm;
     bool found;
-    size_t i, j;
-    uint8_t *lookupTable;
+    size_t i;
+    crc_tier_t tier;
 
     /* Set Up */
     found = false;
@@ -163,33 +435,12 @@ void crc8_init(const char * const Name, crc8_configuration_t * const configurati
     /* Error Check */
     if((Name != NULL) && (configuration != NULL))
     {
-        /* Algorithm */
-        for(i = 0; i < crc8_ConfigurationCount; i++)
+        /* Algorithm (Perfect Hash Over Every Width, Width Must Match) */
+        if(((algorithm = crc_lookup(Name)) != NULL) && (algorithm->width == 8))
         {
-            /* Name */
-            if(strcmp(Name, crc8_Configuration[i].Name) == 0)
-            {
-                /* Found */
-                found = true;
-                break;
-            }
-            else
-            {
-                /* Alias */
-                for(j = 0; j < crc8_Configuration[i].aliasCount; j++)
-                {
-                    if(strcmp(Name, crc8_Configuration[i].Alias[j]) == 0)
-                    {
-                        /* Found */
-                        found = true;
-                        break;
-                    }
-                }
-
-                /* Found */
-                if(found)
-                    break;
-            }
+            /* Found */
+            found = true;
+            i = algorithm->index;
         }
 
         /* Found */
@@ -198,15 +449,12 @@ void crc8_init(const char * const Name, crc8_configuration_t * const configurati
             /* Copy */
             (void)memcpy(configuration, &crc8_Configuration[i], sizeof(crc8_Configuration[i]));
 
-            /* Generate Lookup Table */
-            if(CreateLookupTable)
+            /* Lookup Table (Generated At Build Time, Shared Read Only) And Kernel (Specialized Lookup Table Calculate), Tier Override Wins */
+            tier = crc_tierGet();
+            if((tier == CRC_TIER_AUTOMATIC) ? CreateLookupTable : (tier != CRC_TIER_LOOP))
             {
-                if((lookupTable = memory_malloc(CRC8_LOOKUP_TABLE_MEMORY_SIZE)) != NULL)
-                {
-                    for(i = 0; i < 256; i++)
-                        lookupTable[i] = crc8_calculatePartial(configuration, 0x00, (uint8_t)i, true) ^ configuration->xorOut;
-                    configuration->lookupTable = lookupTable;
-                }
+                configuration->kernel = crc8_Kernel[i];
+                configuration->lookupTable = crc8_LookupTable[i];
             }
         }
         else
@@ -217,6 +465,63 @@ void crc8_init(const char * const Name, crc8_configuration_t * const configurati
     }
 }
 
+/*** Patch ***/
+uint8_t crc8_patch(const crc8_configuration_t * const Configuration, const uint8_t OldCrc, const size_t Offset, const uint8_t * const OldData, const uint8_t * const NewData, const size_t DataLength, const size_t TotalLength)
+{
+    /*** Patch ***/
+    /* Variable */
+    uint8_t crc;
+    uint8_t delta[64];
+    uint8_t deltaCrc;
+    size_t i, j, length;
+    bool reflected;
+
+    /* Set Up */
+    crc = OldCrc;
+
+    /* Error Check */
+    if((Configuration != NULL) && (OldData != NULL) && (NewData != NULL) && (Offset <= TotalLength) && (DataLength <= (TotalLength - Offset)))
+    {
+        /* Delta (CRC Is Linear, So Only The XOR Of The Changed Bytes From A Zero Register Matters) */
+        deltaCrc = 0x00;
+        for(i = 0; i < DataLength; i += length)
+        {
+            length = ((DataLength - i) < sizeof(delta)) ? (DataLength - i) : sizeof(delta);
+            for(j = 0; j < length; j++)
+                delta[j] = OldData[i + j] ^ NewData[i + j];
+            deltaCrc = crc8_update(Configuration, deltaCrc, delta, length);
+        }
+
+        /* Shift Over The Bytes After The Patch (Table Engines Keep A Reflected Register) */
+        reflected = ((Configuration->lookupTable != NULL) && Configuration->reflectIn);
+        if(reflected)
+            deltaCrc = misc_reflect8(deltaCrc);
+        deltaCrc = (uint8_t)crc_shift(deltaCrc, Configuration->polynomial, 8, TotalLength - Offset - DataLength);
+
+        /* Apply (xorOut Cancels Out, Reflection Distributes Over XOR) */
+        if(reflected || ((Configuration->lookupTable == NULL) && Configuration->reflectOut))
+            deltaCrc = misc_reflect8(deltaCrc);
+        crc ^= deltaCrc;
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Snapshot ***/
+void crc8_snapshot(const crc8_configuration_t * const Configuration, const uint8_t *Prefix, const size_t PrefixLength, crc8_context_t * const snapshot)
+{
+    /*** Snapshot ***/
+    /* Error Check */
+    if((Configuration != NULL) && ((Prefix != NULL) || (PrefixLength == 0)) && (snapshot != NULL))
+    {
+        /* Prefix (Register State After The Shared Header, Resumed By Fork Or By Copying Into A Context) */
+        crc8_contextInit(snapshot, Configuration);
+        if(PrefixLength > 0)
+            crc8_contextUpdate(snapshot, Prefix, PrefixLength);
+    }
+}
+
 /*** Verify ***/
 bool crc8_verify(const crc8_configuration_t * const Configuration, const uint8_t *Buffer, const size_t BufferLength)
 {
@@ -239,3 +544,140 @@ bool crc8_verify(const crc8_configuration_t * const Configuration, const uint8_t
     /* Exit */
     return verified;
 }
+
+/*** Verify List ***/
+bool crc8_verifyList(const crc8_configuration_t * const Configuration, const list_list_t * const List)
+{
+    /*** Verify List ***/
+    /* Variable */
+    uint8_t crc;
+    bool verified;
+
+    /* Set Up */
+    verified = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (List != NULL))
+    {
+        /* Verify */
+        crc = crc8_calculateList(Configuration, List);
+        verified = ((crc ^ Configuration->xorOut) == Configuration->residue);
+    }
+
+    /* Exit */
+    return verified;
+}
+
+#ifdef CRC_IOVEC_AVAILABLE
+/*** Verify Vector ***/
+bool crc8_verifyV(const crc8_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount)
+{
+    /*** Verify Vector ***/
+    /* Variable */
+    uint8_t crc;
+    bool verified;
+
+    /* Set Up */
+    verified = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Vector != NULL))
+    {
+        /* Verify */
+        crc = crc8_calculateV(Configuration, Vector, VectorCount);
+        verified = ((crc ^ Configuration->xorOut) == Configuration->residue);
+    }
+
+    /* Exit */
+    return verified;
+}
+#endif
+
+/*** Kernels ***/
+CRC8_KERNEL_LIST(CRC8_KERNEL_DEFINITION)
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+#ifdef CRC_FILE_AVAILABLE
+/*** File Update ***/
+static void crc8_fileUpdate(void * const context, const uint8_t *Data, const size_t DataLength)
+{
+    /*** File Update ***/
+    /* Update */
+    crc8_contextUpdate(context, Data, DataLength);
+}
+#endif
+
+/*** Kernel ***/
+static CRC_ALWAYS_INLINE uint8_t crc8_kernel(const uint8_t * const LookupTable, const uint8_t Initial, const uint8_t TableInitial, const bool ReflectIn, const uint8_t XorOut, const uint8_t *Data, size_t dataLength)
+{
+    /*** Kernel ***/
+    /* Variable */
+    uint8_t crc;
+
+    /* Set Up (Nothing Consumed Returns Initial, Same As Calculate) */
+    crc = 0x00;
+    (void)ReflectIn; // Byte Wide, Same Loop Either Way
+
+    /* Error Check */
+    if(Data != NULL)
+    {
+        /* Set Up */
+        crc = Initial;
+
+        /* Lookup Table (Every Argument Is A Constant From The Kernel List, Folded At Compile Time) */
+        if(dataLength > 0)
+        {
+            crc = TableInitial;
+            while(dataLength-- > 0)
+                crc = LookupTable[crc ^ *Data++];
+            crc ^= XorOut;
+        }
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Update ***/
+static uint8_t crc8_update(const crc8_configuration_t * const Configuration, uint8_t crc, const uint8_t *Data, size_t dataLength)
+{
+    /*** Update ***/
+    /* Variable */
+    size_t bit;
+    const uint8_t *LookupTable;
+
+    /* Set Up */
+    LookupTable = Configuration->lookupTable;
+
+    /* Byte At A Time */
+    if(LookupTable == NULL)
+    {
+        /* Loop */
+        while(dataLength-- > 0)
+        {
+            if(Configuration->reflectIn)
+                crc ^= misc_reflect8(*Data++);
+            else
+                crc ^= *Data++;
+            for(bit = 0; bit < 8; bit++)
+            {
+                if((crc & 0x80) == 0x80)
+                    crc = (crc << 1) ^ Configuration->polynomial;
+                else
+                    crc <<= 1;
+            }
+        }
+    }
+    else
+    {
+        /* Lookup Table */
+        while(dataLength-- > 0)
+            crc = LookupTable[crc ^ *Data++];
+    }
+
+    /* Exit */
+    return crc;
+}
@@ -8,6 +8,7 @@
  * Defines
  ****************************************************************************************************/
 
+#define CRC8_KERNEL_PROTOTYPE(IDENTIFIER, INDEX, INITIAL, TABLE_INITIAL, REFLECT_IN, XOR_OUT) extern uint8_t crc8_##IDENTIFIER##_calculate(const uint8_t *Data, const size_t DataLength);
 #define CRC8_LOOKUP_TABLE_COUNT (256)
 #define CRC8_LOOKUP_TABLE_MEMORY_SIZE (CRC8_LOOKUP_TABLE_COUNT * sizeof(uint8_t))
 #define CRC8_MAXIMUM_ALIAS_COUNT (2)
@@ -16,6 +17,9 @@
  * Includes
  ****************************************************************************************************/
 
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc8_kernel.h"
+#include "Eclectic/Data/list.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -24,6 +28,9 @@
  * Type Definitions
  ****************************************************************************************************/
 
+/*** Callbacks ***/
+typedef uint8_t (*crc8_kernelCallback_t)(const uint8_t *Data, const size_t DataLength);
+
 /*** Structures ***/
 typedef struct crc8_configuration_s
 {
@@ -31,7 +38,8 @@ typedef struct crc8_configuration_s
     size_t aliasCount;
     uint8_t check;
     uint8_t initial;
-    uint8_t *lookupTable;
+    crc8_kernelCallback_t kernel;
+    const uint8_t *lookupTable;
     char *Name;
     uint8_t polynomial;
     bool reflectIn;
@@ -40,13 +48,50 @@ typedef struct crc8_configuration_s
     uint8_t xorOut;
 } crc8_configuration_t;
 
+typedef struct crc8_context_s
+{
+    const crc8_configuration_t *Configuration;
+    uint8_t crc;
+    uint64_t length;
+} crc8_context_t;
+
+/****************************************************************************************************
+ * Constants
+ ****************************************************************************************************/
+
+extern const crc8_configuration_t crc8_Configuration[]; // Catalog, One Entry Per Algorithm (Aliases Folded In)
+extern const size_t crc8_ConfigurationCount;
+
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
 extern uint8_t crc8_calculate(const crc8_configuration_t * const Configuration, const uint8_t *Data, const size_t DataLength);
 extern void crc8_calculateAndAppend(const crc8_configuration_t * const Configuration, uint8_t * const buffer, const size_t BufferLength, const size_t DataLength);
+#ifdef CRC_FILE_AVAILABLE
+extern bool crc8_calculateFile(const crc8_configuration_t * const Configuration, const char * const Path, uint8_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+extern bool crc8_calculateFileDescriptor(const crc8_configuration_t * const Configuration, const int FileDescriptor, uint8_t * const crc, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument, crc_fileStatistics_t * const statistics);
+#endif
+extern uint8_t crc8_calculateList(const crc8_configuration_t * const Configuration, const list_list_t * const List);
 extern uint8_t crc8_calculatePartial(const crc8_configuration_t * const Configuration, uint8_t crc, const uint8_t Data, const bool Last);
+#ifdef CRC_IOVEC_AVAILABLE
+extern uint8_t crc8_calculateV(const crc8_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount);
+#endif
+extern uint8_t crc8_contextFinal(const crc8_context_t * const Context);
+extern void crc8_contextInit(crc8_context_t * const context, const crc8_configuration_t * const Configuration);
+extern void crc8_contextUpdate(crc8_context_t * const context, const uint8_t *Data, const size_t DataLength);
+extern uint8_t crc8_copyAndCalculate(const crc8_configuration_t * const Configuration, uint8_t * const destination, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal);
+extern void crc8_copyAndCalculateAndAppend(const crc8_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, const uint8_t * const Source, const size_t DataLength, const bool NonTemporal);
 extern void crc8_deinit(crc8_configuration_t * const configuration);
+extern uint8_t crc8_fork(const crc8_context_t * const Snapshot, const uint8_t *Data, const size_t DataLength);
 extern void crc8_init(const char * const Name, crc8_configuration_t * const configuration, const bool CreateLookupTable);
+extern uint8_t crc8_patch(const crc8_configuration_t * const Configuration, const uint8_t OldCrc, const size_t Offset, const uint8_t * const OldData, const uint8_t * const NewData, const size_t DataLength, const size_t TotalLength);
+extern void crc8_snapshot(const crc8_configuration_t * const Configuration, const uint8_t *Prefix, const size_t PrefixLength, crc8_context_t * const snapshot);
 extern bool crc8_verify(const crc8_configuration_t * const Configuration, const uint8_t *Buffer, const size_t BufferLength);
+extern bool crc8_verifyList(const crc8_configuration_t * const Configuration, const list_list_t * const List);
+#ifdef CRC_IOVEC_AVAILABLE
+extern bool crc8_verifyV(const crc8_configuration_t * const Configuration, const struct iovec * const Vector, const size_t VectorCount);
+#endif
+
+/* Kernels (One Per Catalog Entry, e.g. crc8_smbus_calculate) */
+CRC8_KERNEL_LIST(CRC8_KERNEL_PROTOTYPE)
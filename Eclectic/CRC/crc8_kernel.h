@@ -0,0 +1,31 @@
+/****************************************************************************************************
+ * Pragmas
+ ****************************************************************************************************/
+
+#pragma once
+
+/****************************************************************************************************
+ * Defines (Generated By Project/Script/crc_table.py, Do Not Edit)
+ ****************************************************************************************************/
+
+#define CRC8_KERNEL_LIST(KERNEL) \
+    KERNEL(autosar, 0, 0xFF, 0xFF, false, 0xFF) \
+    KERNEL(bluetooth, 1, 0x00, 0x00, true, 0x00) \
+    KERNEL(cdma2000, 2, 0xFF, 0xFF, false, 0x00) \
+    KERNEL(darc, 3, 0x00, 0x00, true, 0x00) \
+    KERNEL(dvb_s2, 4, 0x00, 0x00, false, 0x00) \
+    KERNEL(gsm_a, 5, 0x00, 0x00, false, 0x00) \
+    KERNEL(gsm_b, 6, 0x00, 0x00, false, 0xFF) \
+    KERNEL(hitag, 7, 0xFF, 0xFF, false, 0x00) \
+    KERNEL(i_432_1, 8, 0x00, 0x00, false, 0x55) \
+    KERNEL(i_code, 9, 0xFD, 0xFD, false, 0x00) \
+    KERNEL(lte, 10, 0x00, 0x00, false, 0x00) \
+    KERNEL(maxim_dow, 11, 0x00, 0x00, true, 0x00) \
+    KERNEL(mifare_mad, 12, 0xC7, 0xC7, false, 0x00) \
+    KERNEL(nrsc_5, 13, 0xFF, 0xFF, false, 0x00) \
+    KERNEL(opensafety, 14, 0x00, 0x00, false, 0x00) \
+    KERNEL(rohc, 15, 0xFF, 0xFF, true, 0x00) \
+    KERNEL(sae_j1850, 16, 0xFF, 0xFF, false, 0xFF) \
+    KERNEL(smbus, 17, 0x00, 0x00, false, 0x00) \
+    KERNEL(tech_3250, 18, 0xFF, 0xFF, true, 0x00) \
+    KERNEL(wcdma, 19, 0x00, 0x00, true, 0x00)
@@ -0,0 +1,290 @@
+/****************************************************************************************************
+ * Pragmas
+ ****************************************************************************************************/
+
+#pragma once
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define CRC_NAME_BUCKET_COUNT (64)
+#define CRC_NAME_TABLE_COUNT (256)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants (Generated By Project/Script/crc_table.py, Do Not Edit)
+ ****************************************************************************************************/
+
+static const uint16_t crc_NameDisplacement[CRC_NAME_BUCKET_COUNT] =
+    {
+        0x0000, 0x0003, 0x0000, 0x0001, 0x0002, 0x0000, 0x0001, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0001, 0x0002,
+        0x0002, 0x0001, 0x0000, 0x0003, 0x0001, 0x0001, 0x0000, 0x0002, 0x0001, 0x0003, 0x0000, 0x0001, 0x0002, 0x0002, 0x0001, 0x0001,
+        0x0003, 0x0002, 0x0001, 0x0001, 0x0004, 0x0000, 0x0001, 0x0006, 0x0002, 0x0000, 0x0001, 0x0001, 0x0003, 0x0001, 0x0002, 0x0006,
+        0x0002, 0x0006, 0x0002, 0x0001, 0x0000, 0x0001, 0x0000, 0x0005, 0x0003, 0x0001, 0x0003, 0x0004, 0x0007, 0x0001, 0x0001, 0x0006};
+
+static const crc_name_t crc_NameTable[CRC_NAME_TABLE_COUNT] =
+    {
+        {7, "CRC-16/EN-13757", 16},
+        {0, NULL, 0},
+        {2, "CRC-32/BASE91-D", 32},
+        {0, NULL, 0},
+        {1, "CRC-64/GO-ISO", 64},
+        {12, "CRC-A", 16},
+        {25, "CRC-16/T10-DIF", 16},
+        {11, "CRC-8/MAXIM-DOW", 8},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {10, "CRC-16/IBM-3740", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {7, "CRC-8/HITAG", 8},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {19, "CRC-8/WCDMA", 8},
+        {8, "CRC-16/DARC", 16},
+        {0, NULL, 0},
+        {6, "CRC-64/XZ", 64},
+        {8, "CRC-8/ITU", 8},
+        {11, "CRC-16/ISO-IEC-14443-3-B", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {18, "MODBUS", 16},
+        {7, "CRC-32/ADCCP", 32},
+        {24, "CRC-16/SPI-FUJITSU", 16},
+        {20, "CRC-16/OPENSAFETY-A", 16},
+        {13, "CRC-16/CCITT", 16},
+        {5, "X-CRC-16", 16},
+        {30, "CRC-16/LTE", 16},
+        {7, "CRC-32", 32},
+        {0, NULL, 0},
+        {11, "DOW-CRC", 8},
+        {0, NULL, 0},
+        {6, "CRC-32/BASE91-C", 32},
+        {5, "CRC-32/POSIX", 32},
+        {0, NULL, 0},
+        {30, "CRC-16/V-41-MSB", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {11, "CRC-32/XFER", 32},
+        {19, "CRC-16/NRSC-5", 16},
+        {0, NULL, 0},
+        {5, "CRC-32/CKSUM", 32},
+        {8, "CRC-32/JAMCRC", 32},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {15, "CRC-8/ROHC", 8},
+        {13, "CRC-CCITT", 16},
+        {0, NULL, 0},
+        {28, "CRC-16/VERIFONE", 16},
+        {16, "CRC-16/MAXIM", 16},
+        {11, "X-25", 16},
+        {4, "R-CRC-16", 16},
+        {0, NULL, 0},
+        {6, "CRC-64/GO-ECMA", 64},
+        {18, "CRC-8/TECH-3250", 8},
+        {6, "CRC-32C", 32},
+        {0, NULL, 0},
+        {17, "CRC-8", 8},
+        {11, "CRC-16/ISO-HDLC", 16},
+        {0, NULL, 0},
+        {7, "PKZIP", 32},
+        {22, "CRC-16/PROFIBUS", 16},
+        {6, "CRC-8/GSM-B", 8},
+        {0, NULL, 0},
+        {11, "CRC-8/MAXIM", 8},
+        {0, NULL, 0},
+        {3, "CRC-64/NVME", 64},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {11, "CRC-16/X-25", 16},
+        {0, NULL, 0},
+        {0, "ARC", 16},
+        {10, "CRC-16/AUTOSAR", 16},
+        {2, "CRC-8/CDMA2000", 8},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, "CRC-IBM", 16},
+        {0, "CRC-16", 16},
+        {0, NULL, 0},
+        {7, "CRC-32/ISO-HDLC", 32},
+        {0, NULL, 0},
+        {5, "CRC-16/DECT-X", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, "CRC-8/AUTOSAR", 8},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {30, "XMODEM", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {11, "XFER", 32},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {7, "CRC-32/V-42", 32},
+        {9, "CRC-8/I-CODE", 8},
+        {0, "CRC-32Q", 32},
+        {0, NULL, 0},
+        {10, "CRC-32/MPEG-2", 32},
+        {9, "CRC-32/MEF", 32},
+        {0, NULL, 0},
+        {13, "CRC-16/V-41-LSB", 16},
+        {16, "CRC-16/MAXIM-DOW", 16},
+        {28, "CRC-16/BUYPASS", 16},
+        {1, "CRC-32/AUTOSAR", 32},
+        {0, NULL, 0},
+        {12, "CRC-8/MIFARE-MAD", 8},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {17, "CRC-16/MCRF4XX", 16},
+        {28, "CRC-16/UMTS", 16},
+        {0, NULL, 0},
+        {8, "CRC-8/I-432-1", 8},
+        {27, "CRC-16/TMS37157", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {18, "CRC-8/EBU", 8},
+        {8, "CRC-16/EPC", 16},
+        {5, "CKSUM", 32},
+        {3, "CRC-32/AAL5", 32},
+        {0, NULL, 0},
+        {13, "CRC-16/BLUETOOTH", 16},
+        {0, NULL, 0},
+        {18, "CRC-16/MODBUS", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {3, "CRC-32/BZIP2", 32},
+        {12, "CRC-16/ISO-IEC-14443-3-A", 16},
+        {6, "CRC-32/INTERLAKEN", 32},
+        {3, "B-CRC-32", 32},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, "CRC-32/AIXM", 32},
+        {0, NULL, 0},
+        {4, "CRC-64/REDIS", 64},
+        {1, "CRC-16/CDMA2000", 16},
+        {0, NULL, 0},
+        {6, "CRC-32/CASTAGNOLI", 32},
+        {0, NULL, 0},
+        {5, "CRC-64/WE", 64},
+        {8, "JAMCRC", 32},
+        {14, "CRC-16/LJ1200", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {13, "CRC-8/NRSC-5", 8},
+        {16, "CRC-8/SAE-J1850", 8},
+        {13, "CRC-16/KERMIT", 16},
+        {17, "CRC-8/SMBUS", 8},
+        {6, "CRC-16/DNP", 16},
+        {0, NULL, 0},
+        {11, "CRC-16/IBM-SDLC", 16},
+        {3, "CRC-8/DARC", 8},
+        {1, "CRC-8/BLUETOOTH", 8},
+        {0, "CRC-16/LHA", 16},
+        {0, NULL, 0},
+        {21, "CRC-16/OPENSAFETY-B", 16},
+        {18, "CRC-8/AES", 8},
+        {0, NULL, 0},
+        {15, "CRC-16/M17", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {4, "CRC-8/DVB-S2", 8},
+        {0, "CRC-64", 64},
+        {30, "CRC-16/ACORN", 16},
+        {0, NULL, 0},
+        {23, "CRC-16/RIELLO", 16},
+        {3, "CRC-16/DDS-110", 16},
+        {2, "CRC-32D", 32},
+        {14, "CRC-8/OPENSAFETY", 8},
+        {0, NULL, 0},
+        {24, "CRC-16/AUG-CCITT", 16},
+        {8, "CRC-16/I-CODE", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {22, "CRC-16/IEC-61158-2", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {10, "CRC-8/LTE", 8},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {10, "CRC-16/CCITT-FALSE", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {6, "CRC-32/ISCSI", 32},
+        {2, "CRC-16/CMS", 16},
+        {0, NULL, 0},
+        {30, "CRC-16/XMODEM", 16},
+        {4, "CRC-32/CD-ROM-EDC", 32},
+        {0, "CRC-16/ARC", 16},
+        {30, "ZMODEM", 16},
+        {0, NULL, 0},
+        {0, "CRC-64/ECMA-182", 64},
+        {2, "CRC-64/MS", 64},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {7, "CRC-32/XZ", 32},
+        {13, "CRC-16/CCITT-TRUE", 16},
+        {13, "KERMIT", 16},
+        {0, NULL, 0},
+        {3, "CRC-32/DECT-B", 32},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {5, "CRC-8/GSM-A", 8},
+        {11, "CRC-B", 16},
+        {26, "CRC-16/TELEDISK", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {8, "CRC-16/EPC-C1G2", 16},
+        {9, "CRC-16/GSM", 16},
+        {0, NULL, 0},
+        {0, NULL, 0},
+        {29, "CRC-16/USB", 16},
+        {8, "CRC-16/GENIBUS", 16},
+        {4, "CRC-16/DECT-R", 16},
+        {6, "CRC-32/NVME", 32},
+        {0, NULL, 0}};
@@ -0,0 +1,298 @@
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc16.h"
+#include "Eclectic/CRC/crc32.h"
+#include "Eclectic/CRC/hdlc.h"
+#include "Eclectic/Miscellaneous/misc.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void hdlc_append(hdlc_decoder_t * const decoder, const uint8_t *Data, const size_t DataLength);
+static void hdlc_end(hdlc_decoder_t * const decoder);
+static void hdlc_reset(hdlc_decoder_t * const decoder);
+static bool hdlc_stuff(const hdlc_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, size_t * const position, const uint8_t *Data, const size_t DataLength);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/*** Decode ***/
+void hdlc_decode(hdlc_decoder_t * const decoder, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Decode ***/
+    /* Variable */
+    uint8_t byte;
+    size_t i;
+    size_t run;
+
+    /* Error Check */
+    if((decoder != NULL) && (decoder->Configuration != NULL) && (Data != NULL))
+    {
+        /* Decode (One Pass, Plain Runs Copied And Checksummed While Still In L1) */
+        for(i = 0; i < DataLength; )
+        {
+            /* Run (Everything Up To The Next Flag Or Escape) */
+            run = 0;
+            if(!decoder->escape)
+            {
+                while(((i + run) < DataLength) && (Data[i + run] != HDLC_FLAG) && (Data[i + run] != HDLC_ESCAPE))
+                    run++;
+                hdlc_append(decoder, &Data[i], run);
+                i += run;
+            }
+
+            /* Control (Flag, Escape, Or The Byte Following An Escape) */
+            if(i < DataLength)
+            {
+                byte = Data[i++];
+                if(byte == HDLC_FLAG)
+                {
+                    hdlc_end(decoder);
+                }
+                else if(decoder->escape)
+                {
+                    byte ^= HDLC_ESCAPE_XOR;
+                    decoder->escape = false;
+                    hdlc_append(decoder, &byte, 1);
+                }
+                else
+                {
+                    decoder->escape = true;
+                }
+            }
+        }
+    }
+}
+
+/*** Decoder Initialize ***/
+bool hdlc_decoderInit(hdlc_decoder_t * const decoder, const hdlc_configuration_t * const Configuration, uint8_t * const buffer, const size_t BufferLength)
+{
+    /*** Decoder Initialize ***/
+    /* Variable */
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((decoder != NULL) && (Configuration != NULL) && ((Configuration->Crc16 != NULL) || (Configuration->Crc32 != NULL)) && (buffer != NULL) && (BufferLength > 0))
+    {
+        /* Initialize (Bytes Before The First Flag Are Discarded) */
+        memset(decoder, 0, sizeof(*decoder));
+        decoder->buffer = buffer;
+        decoder->bufferLength = BufferLength;
+        decoder->Configuration = Configuration;
+        hdlc_reset(decoder);
+        decoder->hunt = true;
+        success = true;
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Encode ***/
+size_t hdlc_encode(const hdlc_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, const uint8_t * const Source, const size_t SourceLength)
+{
+    /*** Encode ***/
+    /* Variable */
+    size_t blockLength;
+    union
+    {
+        crc16_context_t crc16;
+        crc32_context_t crc32;
+    } context;
+    size_t encodedLength;
+    uint8_t fcs[sizeof(uint32_t)];
+    size_t fcsLength;
+    size_t i;
+    size_t position;
+    bool success;
+
+    /* Set Up */
+    encodedLength = 0;
+    position = 0;
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && ((Configuration->Crc16 != NULL) || (Configuration->Crc32 != NULL)) && (destination != NULL) && (DestinationLength >= 2) && ((Source != NULL) || (SourceLength == 0)))
+    {
+        /* Set Up */
+        if(Configuration->Crc16 != NULL)
+            crc16_contextInit(&context.crc16, Configuration->Crc16);
+        else
+            crc32_contextInit(&context.crc32, Configuration->Crc32);
+        destination[position++] = HDLC_FLAG;
+        success = true;
+
+        /* Data (Each Block Checksummed Then Stuffed While Still In L1) */
+        for(i = 0; success && (i < SourceLength); i += blockLength)
+        {
+            blockLength = ((SourceLength - i) < CRC_COPY_BLOCK_SIZE) ? (SourceLength - i) : CRC_COPY_BLOCK_SIZE;
+            if(Configuration->Crc16 != NULL)
+                crc16_contextUpdate(&context.crc16, &Source[i], blockLength);
+            else
+                crc32_contextUpdate(&context.crc32, &Source[i], blockLength);
+            success = hdlc_stuff(Configuration, destination, DestinationLength, &position, &Source[i], blockLength);
+        }
+
+        /* FCS (Same Byte Order As Calculate And Append, So The Receiver Sees The Residue) */
+        if(Configuration->Crc16 != NULL)
+        {
+            fcsLength = sizeof(uint16_t);
+            misc_insert16(fcs, sizeof(fcs), crc16_contextFinal(&context.crc16), !Configuration->Crc16->reflectOut);
+        }
+        else
+        {
+            fcsLength = sizeof(uint32_t);
+            misc_insert32(fcs, sizeof(fcs), crc32_contextFinal(&context.crc32), !Configuration->Crc32->reflectOut);
+        }
+        success = success && hdlc_stuff(Configuration, destination, DestinationLength, &position, fcs, fcsLength);
+
+        /* Closing Flag */
+        if(success && (position < DestinationLength))
+            encodedLength = position + 1;
+        if(encodedLength > 0)
+            destination[position] = HDLC_FLAG;
+    }
+
+    /* Exit (0 When The Destination Is Too Small) */
+    return encodedLength;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/*** Append ***/
+static void hdlc_append(hdlc_decoder_t * const decoder, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Append ***/
+    /* Error Check (Hunting Discards, Overflow Starts Hunting) */
+    if(!decoder->hunt && (DataLength > 0))
+    {
+        if(DataLength <= (decoder->bufferLength - decoder->length))
+        {
+            /* Append (Checksum The Copy, Not The Source, It Is The Hotter Of The Two) */
+            (void)memcpy(&decoder->buffer[decoder->length], Data, DataLength);
+            if(decoder->Configuration->Crc16 != NULL)
+                crc16_contextUpdate(&decoder->context.crc16, &decoder->buffer[decoder->length], DataLength);
+            else
+                crc32_contextUpdate(&decoder->context.crc32, &decoder->buffer[decoder->length], DataLength);
+            decoder->length += DataLength;
+        }
+        else
+        {
+            decoder->statistics.overflowed++;
+            decoder->hunt = true;
+        }
+    }
+}
+
+/*** End ***/
+static void hdlc_end(hdlc_decoder_t * const decoder)
+{
+    /*** End ***/
+    /* Variable */
+    size_t fcsLength;
+    bool verified;
+
+    /* End (Hunting Ends Here, Back To Back Flags Delimit Nothing) */
+    if(!decoder->hunt && decoder->escape)
+    {
+        decoder->statistics.aborted++;
+    }
+    else if(!decoder->hunt && (decoder->length > 0))
+    {
+        /* Verify (Checksum Over Data And FCS Leaves The Residue) */
+        if(decoder->Configuration->Crc16 != NULL)
+        {
+            fcsLength = sizeof(uint16_t);
+            verified = ((crc16_contextFinal(&decoder->context.crc16) ^ decoder->Configuration->Crc16->xorOut) == decoder->Configuration->Crc16->residue);
+        }
+        else
+        {
+            fcsLength = sizeof(uint32_t);
+            verified = ((crc32_contextFinal(&decoder->context.crc32) ^ decoder->Configuration->Crc32->xorOut) == decoder->Configuration->Crc32->residue);
+        }
+
+        /* Deliver (Zero Copy, Frame Still Sits In The Caller's Buffer) */
+        if(decoder->length <= fcsLength)
+        {
+            decoder->statistics.runts++;
+        }
+        else if(!verified)
+        {
+            decoder->statistics.crcErrors++;
+        }
+        else
+        {
+            decoder->statistics.frames++;
+            if(decoder->Configuration->frameCallback != NULL)
+                decoder->Configuration->frameCallback(decoder->buffer, decoder->length - fcsLength, decoder->Configuration->argument);
+        }
+    }
+
+    /* Reset */
+    hdlc_reset(decoder);
+}
+
+/*** Reset ***/
+static void hdlc_reset(hdlc_decoder_t * const decoder)
+{
+    /*** Reset ***/
+    /* Reset */
+    if(decoder->Configuration->Crc16 != NULL)
+        crc16_contextInit(&decoder->context.crc16, decoder->Configuration->Crc16);
+    else
+        crc32_contextInit(&decoder->context.crc32, decoder->Configuration->Crc32);
+    decoder->escape = false;
+    decoder->hunt = false;
+    decoder->length = 0;
+}
+
+/*** Stuff ***/
+static bool hdlc_stuff(const hdlc_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, size_t * const position, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Stuff ***/
+    /* Variable */
+    uint8_t byte;
+    size_t i;
+    size_t index;
+    bool success;
+
+    /* Set Up */
+    index = *position;
+    success = true;
+
+    /* Stuff (Flag, Escape And Mapped Control Characters Become Escape, Byte ^ 0x20) */
+    for(i = 0; success && (i < DataLength); i++)
+    {
+        byte = Data[i];
+        if((byte == HDLC_FLAG) || (byte == HDLC_ESCAPE) || ((byte < 32) && ((Configuration->accm >> byte) & 1)))
+        {
+            if((success = ((index + 2) <= DestinationLength)))
+            {
+                destination[index++] = HDLC_ESCAPE;
+                destination[index++] = byte ^ HDLC_ESCAPE_XOR;
+            }
+        }
+        else if((success = (index < DestinationLength)))
+        {
+            destination[index++] = byte;
+        }
+    }
+    *position = index;
+
+    /* Exit */
+    return success;
+}
@@ -0,0 +1,75 @@
+/****************************************************************************************************
+ * Pragmas
+ ****************************************************************************************************/
+
+#pragma once
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define HDLC_ACCM_NONE (0x00000000) // Only Flag And Escape Are Stuffed
+#define HDLC_ACCM_PPP (0xFFFFFFFF) // Every Control Character Stuffed, PPP Default Until LCP Negotiates Otherwise
+#define HDLC_ESCAPE (0x7D)
+#define HDLC_ESCAPE_XOR (0x20)
+#define HDLC_FLAG (0x7E)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc16.h"
+#include "Eclectic/CRC/crc32.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Callbacks ***/
+typedef void (*hdlc_frameCallback_t)(const uint8_t * const Frame, const size_t FrameLength, void * const argument); // Verified Frame, FCS Stripped, Valid Until The Callback Returns
+
+/*** Structures ***/
+typedef struct hdlc_configuration_s
+{
+    uint32_t accm; // Async Control Character Map, Bit n Set Stuffs Character n On Encode
+    void *argument;
+    const crc16_configuration_t *Crc16; // FCS-16 (CRC-16/IBM-SDLC), Or NULL
+    const crc32_configuration_t *Crc32; // FCS-32 (CRC-32/ISO-HDLC), Used When Crc16 Is NULL
+    hdlc_frameCallback_t frameCallback;
+} hdlc_configuration_t;
+
+typedef struct hdlc_statistics_s
+{
+    size_t aborted; // Escape Followed By Flag
+    size_t crcErrors;
+    size_t frames;
+    size_t overflowed; // Longer Than The Caller's Buffer
+    size_t runts; // Not Longer Than The FCS
+} hdlc_statistics_t;
+
+typedef struct hdlc_decoder_s
+{
+    uint8_t *buffer; // Caller Owned, Frames Are Unstuffed Straight Into It
+    size_t bufferLength;
+    const hdlc_configuration_t *Configuration;
+    union
+    {
+        crc16_context_t crc16;
+        crc32_context_t crc32;
+    } context;
+    bool escape;
+    bool hunt; // Discarding Until The Next Flag
+    size_t length;
+    hdlc_statistics_t statistics;
+} hdlc_decoder_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void hdlc_decode(hdlc_decoder_t * const decoder, const uint8_t *Data, const size_t DataLength);
+extern bool hdlc_decoderInit(hdlc_decoder_t * const decoder, const hdlc_configuration_t * const Configuration, uint8_t * const buffer, const size_t BufferLength);
+extern size_t hdlc_encode(const hdlc_configuration_t * const Configuration, uint8_t * const destination, const size_t DestinationLength, const uint8_t * const Source, const size_t SourceLength);
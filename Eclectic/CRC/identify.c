@@ -0,0 +1,378 @@
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc16.h"
+#include "Eclectic/CRC/crc32.h"
+#include "Eclectic/CRC/crc64.h"
+#include "Eclectic/CRC/crc8.h"
+#include "Eclectic/CRC/identify.h"
+#include "Eclectic/Miscellaneous/memory.h"
+#include "Eclectic/Miscellaneous/misc.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void identify_catalog(identify_entry_t * const entry);
+static uint64_t identify_crc(const identify_entry_t * const Entry, const uint64_t Crc, const uint64_t Length);
+static uint64_t identify_final(const identify_group_t * const Group);
+static size_t identify_group(identify_group_t * const group, size_t * const groupCount, const identify_entry_t * const Entry);
+static uint64_t identify_reflect(const uint64_t Crc, const size_t Width);
+static void identify_update(identify_group_t * const group, const uint8_t *Data, const size_t DataLength);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/*** Run ***/
+bool identify_run(const uint8_t *Data, const size_t DataLength, const uint8_t Match, identify_result_t result[], const size_t ResultCapacity, size_t * const resultCount)
+{
+    /*** Run ***/
+    /* Variable */
+    uint64_t bigEndian;
+    uint64_t crc;
+    identify_entry_t *entry;
+    size_t entryCount;
+    identify_group_t *group;
+    size_t groupCount;
+    size_t i, j;
+    size_t length;
+    uint64_t littleEndian;
+    uint8_t match;
+    void *memory;
+    uint64_t messageCrc;
+    size_t offset;
+    size_t split;
+    bool success;
+    size_t trailerLength;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if(((Data != NULL) || (DataLength == 0)) && ((result != NULL) || (ResultCapacity == 0)) && (resultCount != NULL))
+    {
+        /* Set Up (One Group Per Entry Is The Worst Case) */
+        *resultCount = 0;
+        entryCount = crc8_ConfigurationCount + crc16_ConfigurationCount + crc32_ConfigurationCount + crc64_ConfigurationCount;
+        if((memory = memory_malloc(entryCount * (sizeof(identify_group_t) + sizeof(identify_entry_t)))) != NULL)
+        {
+            /* Catalog (Entries Sharing Width, Polynomial And Reflect In Share One Engine, They Differ Only By An Affine Term) */
+            group = memory;
+            entry = (identify_entry_t *)&group[entryCount];
+            groupCount = 0;
+            identify_catalog(entry);
+            for(i = 0; i < entryCount; i++)
+                entry[i].group = identify_group(group, &groupCount, &entry[i]);
+
+            /* Stream (Block Outer, Group Inner, So The Sample Crosses The Memory Bus Once) */
+            for(offset = 0; offset < DataLength; offset += length)
+            {
+                length = ((DataLength - offset) < IDENTIFY_BLOCK_SIZE) ? (DataLength - offset) : IDENTIFY_BLOCK_SIZE;
+                for(i = 0; i < groupCount; i++)
+                {
+                    /* Split (Snapshot The Register Where The Trailer Of This Width Starts) */
+                    trailerLength = group[i].width / 8;
+                    split = length;
+                    if((DataLength > trailerLength) && ((DataLength - trailerLength) >= offset) && ((DataLength - trailerLength) < (offset + length)))
+                        split = DataLength - trailerLength - offset;
+                    identify_update(&group[i], &Data[offset], split);
+                    if(split < length)
+                    {
+                        group[i].messageCrc = identify_final(&group[i]);
+                        identify_update(&group[i], &Data[offset + split], length - split);
+                    }
+                }
+            }
+            for(i = 0; i < groupCount; i++)
+                group[i].crc = identify_final(&group[i]);
+
+            /* Match */
+            for(i = 0; i < entryCount; i++)
+            {
+                /* Residue */
+                match = 0;
+                crc = identify_crc(&entry[i], group[entry[i].group].crc, DataLength);
+                if((crc ^ entry[i].xorOut) == entry[i].residue)
+                    match |= IDENTIFY_MATCH_RESIDUE;
+
+                /* Trailer (Both Byte Orders, Devices Disagree) */
+                messageCrc = 0;
+                trailerLength = entry[i].width / 8;
+                if(DataLength > trailerLength)
+                {
+                    messageCrc = identify_crc(&entry[i], group[entry[i].group].messageCrc, DataLength - trailerLength);
+                    bigEndian = 0;
+                    littleEndian = 0;
+                    for(j = 0; j < trailerLength; j++)
+                    {
+                        bigEndian = (bigEndian << 8) | Data[DataLength - trailerLength + j];
+                        littleEndian |= (uint64_t)Data[DataLength - trailerLength + j] << (8 * j);
+                    }
+                    if(messageCrc == bigEndian)
+                        match |= IDENTIFY_MATCH_TRAILER_BIG_ENDIAN;
+                    if(messageCrc == littleEndian)
+                        match |= IDENTIFY_MATCH_TRAILER_LITTLE_ENDIAN;
+                }
+
+                /* Result (Counted Even When The Caller Ran Out Of Room) */
+                if((Match == IDENTIFY_MATCH_ALL) || ((match & Match) != 0))
+                {
+                    if(*resultCount < ResultCapacity)
+                    {
+                        result[*resultCount].crc = crc;
+                        result[*resultCount].match = match;
+                        result[*resultCount].messageCrc = messageCrc;
+                        result[*resultCount].Name = entry[i].Name;
+                        result[*resultCount].width = entry[i].width;
+                    }
+                    (*resultCount)++;
+                }
+            }
+
+            /* Clean Up */
+            for(i = 0; i < groupCount; i++)
+            {
+                switch(group[i].width)
+                {
+                    case 8:
+                        crc8_deinit(&group[i].configuration.crc8);
+                        break;
+                    case 16:
+                        crc16_deinit(&group[i].configuration.crc16);
+                        break;
+                    case 32:
+                        crc32_deinit(&group[i].configuration.crc32);
+                        break;
+                    default:
+                        crc64_deinit(&group[i].configuration.crc64);
+                        break;
+                }
+            }
+            memory_free(&memory);
+            success = true;
+        }
+    }
+
+    /* Exit */
+    return success;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/*** Catalog ***/
+static void identify_catalog(identify_entry_t * const entry)
+{
+    /*** Catalog ***/
+    /* Variable */
+    size_t i;
+    size_t index;
+
+    /* Set Up */
+    index = 0;
+
+    /* CRC-8 */
+    for(i = 0; i < crc8_ConfigurationCount; i++, index++)
+    {
+        entry[index].initial = crc8_Configuration[i].initial;
+        entry[index].Name = crc8_Configuration[i].Name;
+        entry[index].polynomial = crc8_Configuration[i].polynomial;
+        entry[index].reflectIn = crc8_Configuration[i].reflectIn;
+        entry[index].reflectOut = crc8_Configuration[i].reflectOut;
+        entry[index].residue = crc8_Configuration[i].residue;
+        entry[index].width = 8;
+        entry[index].xorOut = crc8_Configuration[i].xorOut;
+    }
+
+    /* CRC-16 */
+    for(i = 0; i < crc16_ConfigurationCount; i++, index++)
+    {
+        entry[index].initial = crc16_Configuration[i].initial;
+        entry[index].Name = crc16_Configuration[i].Name;
+        entry[index].polynomial = crc16_Configuration[i].polynomial;
+        entry[index].reflectIn = crc16_Configuration[i].reflectIn;
+        entry[index].reflectOut = crc16_Configuration[i].reflectOut;
+        entry[index].residue = crc16_Configuration[i].residue;
+        entry[index].width = 16;
+        entry[index].xorOut = crc16_Configuration[i].xorOut;
+    }
+
+    /* CRC-32 */
+    for(i = 0; i < crc32_ConfigurationCount; i++, index++)
+    {
+        entry[index].initial = crc32_Configuration[i].initial;
+        entry[index].Name = crc32_Configuration[i].Name;
+        entry[index].polynomial = crc32_Configuration[i].polynomial;
+        entry[index].reflectIn = crc32_Configuration[i].reflectIn;
+        entry[index].reflectOut = crc32_Configuration[i].reflectOut;
+        entry[index].residue = crc32_Configuration[i].residue;
+        entry[index].width = 32;
+        entry[index].xorOut = crc32_Configuration[i].xorOut;
+    }
+
+    /* CRC-64 */
+    for(i = 0; i < crc64_ConfigurationCount; i++, index++)
+    {
+        entry[index].initial = crc64_Configuration[i].initial;
+        entry[index].Name = crc64_Configuration[i].Name;
+        entry[index].polynomial = crc64_Configuration[i].polynomial;
+        entry[index].reflectIn = crc64_Configuration[i].reflectIn;
+        entry[index].reflectOut = crc64_Configuration[i].reflectOut;
+        entry[index].residue = crc64_Configuration[i].residue;
+        entry[index].width = 64;
+        entry[index].xorOut = crc64_Configuration[i].xorOut;
+    }
+}
+
+/*** CRC ***/
+static uint64_t identify_crc(const identify_entry_t * const Entry, const uint64_t Crc, const uint64_t Length)
+{
+    /*** CRC ***/
+    /* Variable */
+    uint64_t crc;
+
+    /* Set Up (Nothing Consumed Returns Initial, Same As Calculate) */
+    crc = Entry->initial;
+
+    /* CRC (Register = Initial Shifted Over The Sample ^ Group Register, Then The Entry's Own Output Stage) */
+    if(Length > 0)
+    {
+        crc = Entry->reflectIn ? identify_reflect(Crc, Entry->width) : Crc;
+        crc ^= crc_shift(Entry->initial, Entry->polynomial, Entry->width, Length);
+        if(Entry->reflectOut)
+            crc = identify_reflect(crc, Entry->width);
+        crc ^= Entry->xorOut;
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Final ***/
+static uint64_t identify_final(const identify_group_t * const Group)
+{
+    /*** Final ***/
+    /* Variable */
+    uint64_t crc;
+
+    /* Final (Initial And Xor Out Are 0, Reflect Out Follows Reflect In) */
+    switch(Group->width)
+    {
+        case 8:
+            crc = crc8_contextFinal(&Group->context.crc8);
+            break;
+        case 16:
+            crc = crc16_contextFinal(&Group->context.crc16);
+            break;
+        case 32:
+            crc = crc32_contextFinal(&Group->context.crc32);
+            break;
+        default:
+            crc = crc64_contextFinal(&Group->context.crc64);
+            break;
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/*** Group ***/
+static size_t identify_group(identify_group_t * const group, size_t * const groupCount, const identify_entry_t * const Entry)
+{
+    /*** Group ***/
+    /* Variable */
+    size_t i;
+
+    /* Find */
+    for(i = 0; i < *groupCount; i++)
+    {
+        if((group[i].width == Entry->width) && (group[i].polynomial == Entry->polynomial) && (group[i].reflectIn == Entry->reflectIn))
+            break;
+    }
+
+    /* Create (Fastest Engine For The Polynomial, Output Stage Neutralized) */
+    if(i == *groupCount)
+    {
+        memset(&group[i], 0, sizeof(group[i]));
+        group[i].polynomial = Entry->polynomial;
+        group[i].reflectIn = Entry->reflectIn;
+        group[i].width = Entry->width;
+        switch(Entry->width)
+        {
+            case 8:
+                crc8_init(Entry->Name, &group[i].configuration.crc8, true);
+                group[i].configuration.crc8.initial = 0x00;
+                group[i].configuration.crc8.kernel = NULL;
+                group[i].configuration.crc8.reflectOut = Entry->reflectIn;
+                group[i].configuration.crc8.xorOut = 0x00;
+                crc8_contextInit(&group[i].context.crc8, &group[i].configuration.crc8);
+                break;
+            case 16:
+                crc16_init(Entry->Name, &group[i].configuration.crc16, CRC16_ENGINE_AUTOMATIC);
+                group[i].configuration.crc16.initial = 0x0000;
+                group[i].configuration.crc16.kernel = NULL;
+                group[i].configuration.crc16.reflectOut = Entry->reflectIn;
+                group[i].configuration.crc16.xorOut = 0x0000;
+                crc16_contextInit(&group[i].context.crc16, &group[i].configuration.crc16);
+                break;
+            case 32:
+                crc32_init(Entry->Name, &group[i].configuration.crc32, CRC32_ENGINE_AUTOMATIC);
+                group[i].configuration.crc32.initial = 0x00000000;
+                group[i].configuration.crc32.kernel = NULL;
+                group[i].configuration.crc32.reflectOut = Entry->reflectIn;
+                group[i].configuration.crc32.xorOut = 0x00000000;
+                crc32_contextInit(&group[i].context.crc32, &group[i].configuration.crc32);
+                break;
+            default:
+                crc64_init(Entry->Name, &group[i].configuration.crc64, CRC64_ENGINE_AUTOMATIC);
+                group[i].configuration.crc64.initial = 0x0000000000000000;
+                group[i].configuration.crc64.kernel = NULL;
+                group[i].configuration.crc64.reflectOut = Entry->reflectIn;
+                group[i].configuration.crc64.xorOut = 0x0000000000000000;
+                crc64_contextInit(&group[i].context.crc64, &group[i].configuration.crc64);
+                break;
+        }
+        (*groupCount)++;
+    }
+
+    /* Exit */
+    return i;
+}
+
+/*** Reflect ***/
+static uint64_t identify_reflect(const uint64_t Crc, const size_t Width)
+{
+    /*** Reflect ***/
+    /* Exit */
+    return misc_reflect64(Crc) >> (64 - Width);
+}
+
+/*** Update ***/
+static void identify_update(identify_group_t * const group, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Update ***/
+    /* Update */
+    switch(group->width)
+    {
+        case 8:
+            crc8_contextUpdate(&group->context.crc8, Data, DataLength);
+            break;
+        case 16:
+            crc16_contextUpdate(&group->context.crc16, Data, DataLength);
+            break;
+        case 32:
+            crc32_contextUpdate(&group->context.crc32, Data, DataLength);
+            break;
+        default:
+            crc64_contextUpdate(&group->context.crc64, Data, DataLength);
+            break;
+    }
+}
@@ -0,0 +1,85 @@
+/****************************************************************************************************
+ * Pragmas
+ ****************************************************************************************************/
+
+#pragma once
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define IDENTIFY_BLOCK_SIZE (16 * 1024) // Every Group Consumes A Block While It Is Still In L1
+#define IDENTIFY_MATCH_ALL (0) // Report Every Catalog Entry
+#define IDENTIFY_MATCH_ANY (IDENTIFY_MATCH_RESIDUE | IDENTIFY_MATCH_TRAILER_BIG_ENDIAN | IDENTIFY_MATCH_TRAILER_LITTLE_ENDIAN)
+#define IDENTIFY_MATCH_RESIDUE (1 << 0) // Whole Sample Verifies Against The Catalog Residue
+#define IDENTIFY_MATCH_TRAILER_BIG_ENDIAN (1 << 1) // Last Width / 8 Bytes Hold The CRC Of The Rest, Most Significant First
+#define IDENTIFY_MATCH_TRAILER_LITTLE_ENDIAN (1 << 2) // Last Width / 8 Bytes Hold The CRC Of The Rest, Least Significant First
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc16.h"
+#include "Eclectic/CRC/crc32.h"
+#include "Eclectic/CRC/crc64.h"
+#include "Eclectic/CRC/crc8.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Structures ***/
+typedef struct identify_entry_s
+{
+    size_t group;
+    uint64_t initial;
+    const char *Name;
+    uint64_t polynomial;
+    bool reflectIn;
+    bool reflectOut;
+    uint64_t residue;
+    size_t width;
+    uint64_t xorOut;
+} identify_entry_t;
+
+typedef struct identify_group_s
+{
+    union
+    {
+        crc8_configuration_t crc8;
+        crc16_configuration_t crc16;
+        crc32_configuration_t crc32;
+        crc64_configuration_t crc64;
+    } configuration; // Catalog Engine With Initial And Xor Out Zeroed, Shared By Every Entry Of The Group
+    union
+    {
+        crc8_context_t crc8;
+        crc16_context_t crc16;
+        crc32_context_t crc32;
+        crc64_context_t crc64;
+    } context;
+    uint64_t crc; // Whole Sample, Output Representation
+    uint64_t messageCrc; // Sample Minus Trailer, Output Representation
+    uint64_t polynomial;
+    bool reflectIn;
+    size_t width;
+} identify_group_t;
+
+typedef struct identify_result_s
+{
+    uint64_t crc; // Whole Sample, Same As Calculate
+    uint8_t match; // IDENTIFY_MATCH_* Flags
+    uint64_t messageCrc; // Sample Minus The Width / 8 Byte Trailer, 0 When The Sample Is Not Longer Than The Trailer
+    const char *Name;
+    size_t width;
+} identify_result_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern bool identify_run(const uint8_t *Data, const size_t DataLength, const uint8_t Match, identify_result_t result[], const size_t ResultCapacity, size_t * const resultCount);
@@ -0,0 +1,459 @@
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc32.h"
+#include "Eclectic/CRC/mpegts.h"
+#include "Eclectic/Miscellaneous/memory.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef CRC_FILE_AVAILABLE
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static size_t mpegts_continue(mpegts_t * const mpegts, const uint16_t Pid, const uint8_t *Data, const size_t DataLength);
+static bool mpegts_crcPresent(const uint8_t * const Header);
+#ifdef CRC_FILE_AVAILABLE
+static void mpegts_fileUpdate(void * const context, const uint8_t *Data, const size_t DataLength);
+#endif
+static void mpegts_flush(mpegts_t * const mpegts);
+static void mpegts_packet(mpegts_t * const mpegts, const uint8_t * const Packet);
+static void mpegts_pat(mpegts_t * const mpegts, const uint8_t * const Section, const size_t SectionLength);
+static void mpegts_result(mpegts_t * const mpegts, const uint16_t Pid, const uint8_t TableId, const size_t SectionLength, const bool Verified);
+static size_t mpegts_start(mpegts_t * const mpegts, const uint16_t Pid, const uint8_t *Data, const size_t DataLength);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/*** Deinitialize ***/
+void mpegts_deinit(mpegts_t * const mpegts)
+{
+    /*** Deinitialize ***/
+    /* Error Check */
+    if((mpegts != NULL) && (mpegts->pid != NULL))
+    {
+        /* Deinitialize */
+        memory_free((void **)&mpegts->pid);
+        mpegts->batchCount = 0;
+        mpegts->packetLength = 0;
+    }
+}
+
+/*** Initialize ***/
+bool mpegts_init(mpegts_t * const mpegts, const mpegts_configuration_t * const Configuration)
+{
+    /*** Initialize ***/
+    /* Variable */
+    size_t i;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((mpegts != NULL) && (Configuration != NULL) && (Configuration->Crc32 != NULL))
+    {
+        /* PID Table (Reserved SI Range Watched From The Start, PMTs Once A PAT Verifies) */
+        memset(mpegts, 0, sizeof(*mpegts));
+        if((mpegts->pid = memory_malloc(MPEGTS_PID_COUNT * sizeof(mpegts_pid_t))) != NULL)
+        {
+            memset(mpegts->pid, 0, MPEGTS_PID_COUNT * sizeof(mpegts_pid_t));
+            for(i = 0; i < MPEGTS_PID_COUNT; i++)
+            {
+                mpegts->pid[i].continuity = MPEGTS_CONTINUITY_NONE;
+                mpegts->pid[i].psi = (i <= MPEGTS_PID_SI_MAXIMUM);
+            }
+            mpegts->Configuration = Configuration;
+            success = true;
+        }
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Update ***/
+void mpegts_update(mpegts_t * const mpegts, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Update ***/
+    /* Variable */
+    size_t i;
+    size_t run;
+
+    /* Set Up */
+    i = 0;
+
+    /* Error Check */
+    if((mpegts != NULL) && (mpegts->pid != NULL) && (Data != NULL))
+    {
+        /* Straddling Packet (Completed From The Front, Flushed Before The Buffer Can Be Reused) */
+        if(mpegts->packetLength > 0)
+        {
+            run = ((MPEGTS_PACKET_SIZE - mpegts->packetLength) < DataLength) ? (MPEGTS_PACKET_SIZE - mpegts->packetLength) : DataLength;
+            (void)memcpy(&mpegts->packet[mpegts->packetLength], Data, run);
+            mpegts->packetLength += run;
+            i = run;
+            if(mpegts->packetLength == MPEGTS_PACKET_SIZE)
+            {
+                mpegts_packet(mpegts, mpegts->packet);
+                mpegts_flush(mpegts);
+                mpegts->packetLength = 0;
+            }
+        }
+
+        /* Packets (Parsed In Place, Single Packet Sections Never Copied) */
+        while(i < DataLength)
+        {
+            if(Data[i] != MPEGTS_SYNC_BYTE)
+            {
+                /* Hunt (One Error Per Loss, Not Per Skipped Byte) */
+                if(!mpegts->hunt)
+                    mpegts->statistics.syncErrors++;
+                mpegts->hunt = true;
+                i++;
+            }
+            else if((DataLength - i) >= MPEGTS_PACKET_SIZE)
+            {
+                mpegts->hunt = false;
+                mpegts_packet(mpegts, &Data[i]);
+                i += MPEGTS_PACKET_SIZE;
+            }
+            else
+            {
+                mpegts->hunt = false;
+                mpegts->packetLength = DataLength - i;
+                (void)memcpy(mpegts->packet, &Data[i], mpegts->packetLength);
+                i = DataLength;
+            }
+        }
+
+        /* Flush (Batch Points Into Data, Which Is Only Valid Until Return) */
+        mpegts_flush(mpegts);
+        mpegts->statistics.processed += DataLength;
+    }
+}
+
+#ifdef CRC_FILE_AVAILABLE
+/*** Validate File ***/
+bool mpegts_validateFile(mpegts_t * const mpegts, const char * const Path, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument)
+{
+    /*** Validate File ***/
+    /* Variable */
+    int fileDescriptor;
+    crc_fileStatistics_t fileStatistics;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((mpegts != NULL) && (mpegts->pid != NULL) && (Path != NULL) && ((fileDescriptor = open(Path, O_RDONLY | O_CLOEXEC)) >= 0))
+    {
+        /* Validate (Mapped Where Possible, Streamed Otherwise) */
+        success = crc_fileRead(fileDescriptor, mpegts_fileUpdate, mpegts, ProgressCallback, progressArgument, &fileStatistics);
+        (void)close(fileDescriptor);
+
+        /* Statistics (Throughput Over The Whole Capture, Parsing Included) */
+        if(success)
+        {
+            mpegts->statistics.bytesPerSecond = fileStatistics.bytesPerSecond;
+            mpegts->statistics.mapped = fileStatistics.mapped;
+            mpegts->statistics.seconds = fileStatistics.seconds;
+        }
+    }
+
+    /* Exit */
+    return success;
+}
+#endif
+
+/*** Watch ***/
+bool mpegts_watch(mpegts_t * const mpegts, const uint16_t Pid)
+{
+    /*** Watch ***/
+    /* Variable */
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check */
+    if((mpegts != NULL) && (mpegts->pid != NULL) && (Pid < MPEGTS_PID_COUNT))
+    {
+        /* Watch (Sections Are Picked Up From The Next Payload Unit Start) */
+        mpegts->pid[Pid].psi = true;
+        success = true;
+    }
+
+    /* Exit */
+    return success;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/*** Continue ***/
+static size_t mpegts_continue(mpegts_t * const mpegts, const uint16_t Pid, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Continue ***/
+    /* Variable */
+    size_t consumed;
+    mpegts_pid_t *pid;
+    size_t run;
+    size_t sectionLength;
+    bool verified;
+
+    /* Set Up */
+    consumed = 0;
+    pid = &mpegts->pid[Pid];
+
+    /* Continue (Header Collected Byte By Byte, Body Checksummed In Whole Runs) */
+    while(pid->assembling && (consumed < DataLength))
+    {
+        if(pid->headerLength < MPEGTS_SECTION_HEADER_SIZE)
+        {
+            run = 1;
+            pid->header[pid->headerLength++] = Data[consumed];
+            if(pid->headerLength == MPEGTS_SECTION_HEADER_SIZE)
+                pid->remaining = ((size_t)(pid->header[1] & 0x0F) << 8) | pid->header[2];
+        }
+        else
+        {
+            run = (pid->remaining < (DataLength - consumed)) ? pid->remaining : (DataLength - consumed);
+            pid->remaining -= run;
+        }
+        crc32_contextUpdate(&pid->context, &Data[consumed], run);
+        if((Pid == MPEGTS_PID_PAT) && ((mpegts->patLength + run) <= sizeof(mpegts->pat)))
+        {
+            (void)memcpy(&mpegts->pat[mpegts->patLength], &Data[consumed], run);
+            mpegts->patLength += run;
+        }
+        consumed += run;
+
+        /* Complete (A Verified PAT Is Followed From Its Kept Copy) */
+        if((pid->headerLength == MPEGTS_SECTION_HEADER_SIZE) && (pid->remaining == 0))
+        {
+            pid->assembling = false;
+            if(mpegts_crcPresent(pid->header))
+            {
+                sectionLength = MPEGTS_SECTION_HEADER_SIZE + (((size_t)(pid->header[1] & 0x0F) << 8) | pid->header[2]);
+                verified = ((crc32_contextFinal(&pid->context) ^ mpegts->Configuration->Crc32->xorOut) == mpegts->Configuration->Crc32->residue);
+                mpegts_result(mpegts, Pid, pid->header[0], sectionLength, verified);
+                if(verified && (Pid == MPEGTS_PID_PAT) && (pid->header[0] == MPEGTS_TABLE_ID_PAT) && (mpegts->patLength == sectionLength))
+                    mpegts_pat(mpegts, mpegts->pat, mpegts->patLength);
+            }
+            else
+            {
+                pid->statistics.unchecked++;
+                mpegts->statistics.unchecked++;
+            }
+        }
+    }
+
+    /* Exit */
+    return consumed;
+}
+
+/*** CRC Present ***/
+static bool mpegts_crcPresent(const uint8_t * const Header)
+{
+    /*** CRC Present ***/
+    /* Exit (Long Form Sections, Plus The One Short Form Table That Still Carries A CRC) */
+    return ((Header[1] & 0x80) != 0) || (Header[0] == MPEGTS_TABLE_ID_TOT);
+}
+
+#ifdef CRC_FILE_AVAILABLE
+/*** File Update ***/
+static void mpegts_fileUpdate(void * const context, const uint8_t *Data, const size_t DataLength)
+{
+    /*** File Update ***/
+    /* Update */
+    mpegts_update(context, Data, DataLength);
+}
+#endif
+
+/*** Flush ***/
+static void mpegts_flush(mpegts_t * const mpegts)
+{
+    /*** Flush ***/
+    /* Variable */
+    size_t i;
+    bool verified;
+    uint8_t verifiedMap[CRC32_MANY_BITMAP_SIZE(MPEGTS_BATCH_COUNT)];
+
+    /* Error Check */
+    if(mpegts->batchCount > 0)
+    {
+        /* Verify (One Interleaved Call For The Whole Batch) */
+        (void)crc32_verifyMany(mpegts->Configuration->Crc32, mpegts->batch, mpegts->batchLength, verifiedMap, mpegts->batchCount);
+
+        /* Results (Section Bytes Still Valid, So A Verified PAT Can Be Followed) */
+        for(i = 0; i < mpegts->batchCount; i++)
+        {
+            verified = ((verifiedMap[i / 8] >> (i % 8)) & 1) != 0;
+            mpegts_result(mpegts, mpegts->batchPid[i], mpegts->batch[i][0], mpegts->batchLength[i], verified);
+            if(verified && (mpegts->batchPid[i] == MPEGTS_PID_PAT) && (mpegts->batch[i][0] == MPEGTS_TABLE_ID_PAT))
+                mpegts_pat(mpegts, mpegts->batch[i], mpegts->batchLength[i]);
+        }
+        mpegts->batchCount = 0;
+    }
+}
+
+/*** Packet ***/
+static void mpegts_packet(mpegts_t * const mpegts, const uint8_t * const Packet)
+{
+    /*** Packet ***/
+    /* Variable */
+    uint8_t continuity;
+    size_t offset;
+    mpegts_pid_t *pid;
+    uint16_t pidNumber;
+    size_t pointer;
+
+    /* Set Up */
+    pidNumber = (uint16_t)(((Packet[1] & 0x1F) << 8) | Packet[2]);
+    pid = &mpegts->pid[pidNumber];
+    mpegts->statistics.packets++;
+
+    /* Transport Error (Payload Untrustworthy, Section In Progress Dropped) */
+    if((Packet[1] & 0x80) != 0)
+    {
+        mpegts->statistics.transportErrors++;
+        pid->assembling = false;
+    }
+    else if(pid->psi && ((Packet[3] & 0x10) != 0))
+    {
+        /* Continuity (Duplicates Skipped, Jumps Drop The Section In Progress) */
+        continuity = Packet[3] & 0x0F;
+        if(continuity != pid->continuity)
+        {
+            if((pid->continuity != MPEGTS_CONTINUITY_NONE) && (continuity != ((pid->continuity + 1) & 0x0F)))
+            {
+                pid->statistics.discontinuities++;
+                pid->assembling = false;
+            }
+            pid->continuity = continuity;
+
+            /* Payload (After The Adaptation Field, If Any) */
+            offset = 4;
+            if((Packet[3] & 0x20) != 0)
+                offset += 1 + (size_t)Packet[4];
+            if(offset < MPEGTS_PACKET_SIZE)
+            {
+                if((Packet[1] & 0x40) != 0)
+                {
+                    /* Payload Unit Start (Pointer Field Ends The Previous Section, New Ones Follow Back To Back) */
+                    pointer = Packet[offset++];
+                    if((offset + pointer) <= MPEGTS_PACKET_SIZE)
+                    {
+                        if(pid->assembling)
+                            (void)mpegts_continue(mpegts, pidNumber, &Packet[offset], pointer);
+                        pid->assembling = false;
+                        for(offset += pointer; (offset < MPEGTS_PACKET_SIZE) && (Packet[offset] != MPEGTS_TABLE_ID_STUFFING); )
+                            offset += mpegts_start(mpegts, pidNumber, &Packet[offset], MPEGTS_PACKET_SIZE - offset);
+                    }
+                    else
+                    {
+                        pid->assembling = false;
+                    }
+                }
+                else if(pid->assembling)
+                {
+                    /* Continuation (Remainder Of The Packet After The Section Ends Is Stuffing) */
+                    (void)mpegts_continue(mpegts, pidNumber, &Packet[offset], MPEGTS_PACKET_SIZE - offset);
+                }
+            }
+        }
+    }
+}
+
+/*** PAT ***/
+static void mpegts_pat(mpegts_t * const mpegts, const uint8_t * const Section, const size_t SectionLength)
+{
+    /*** PAT ***/
+    /* Variable */
+    size_t i;
+
+    /* Watch (Every Program Map PID And The Network PID, Program Loop Sits Between The 8 Byte Header And The CRC) */
+    for(i = 8; (i + 4 + sizeof(uint32_t)) <= SectionLength; i += 4)
+        mpegts->pid[((Section[i + 2] & 0x1F) << 8) | Section[i + 3]].psi = true;
+}
+
+/*** Result ***/
+static void mpegts_result(mpegts_t * const mpegts, const uint16_t Pid, const uint8_t TableId, const size_t SectionLength, const bool Verified)
+{
+    /*** Result ***/
+    /* Statistics */
+    mpegts->pid[Pid].statistics.sections++;
+    mpegts->statistics.sections++;
+    if(!Verified)
+    {
+        mpegts->pid[Pid].statistics.crcErrors++;
+        mpegts->statistics.crcErrors++;
+    }
+
+    /* Callback */
+    if(mpegts->Configuration->sectionCallback != NULL)
+        mpegts->Configuration->sectionCallback(Pid, TableId, SectionLength, Verified, mpegts->Configuration->argument);
+}
+
+/*** Start ***/
+static size_t mpegts_start(mpegts_t * const mpegts, const uint16_t Pid, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Start ***/
+    /* Variable */
+    size_t consumed;
+    mpegts_pid_t *pid;
+
+    /* Set Up */
+    pid = &mpegts->pid[Pid];
+
+    /* Start (Whole Section In This Packet) */
+    if((DataLength >= MPEGTS_SECTION_HEADER_SIZE) && ((consumed = MPEGTS_SECTION_HEADER_SIZE + (((size_t)(Data[1] & 0x0F) << 8) | Data[2])) <= DataLength))
+    {
+        if(mpegts_crcPresent(Data))
+        {
+            /* Batch (Zero Copy, Verified Together Later) */
+            if(mpegts->batchCount == MPEGTS_BATCH_COUNT)
+                mpegts_flush(mpegts);
+            mpegts->batch[mpegts->batchCount] = Data;
+            mpegts->batchLength[mpegts->batchCount] = consumed;
+            mpegts->batchPid[mpegts->batchCount] = Pid;
+            mpegts->batchCount++;
+
+            /* PAT (Verified At Once, Program Map PIDs Must Be Watched Before Their Next Packet) */
+            if((Pid == MPEGTS_PID_PAT) && (Data[0] == MPEGTS_TABLE_ID_PAT))
+                mpegts_flush(mpegts);
+        }
+        else
+        {
+            pid->statistics.unchecked++;
+            mpegts->statistics.unchecked++;
+        }
+    }
+
+    /* Start (Section Spans Packets, Checksummed As It Arrives) */
+    else
+    {
+        crc32_contextInit(&pid->context, mpegts->Configuration->Crc32);
+        pid->assembling = true;
+        pid->headerLength = 0;
+        pid->remaining = 0;
+        if(Pid == MPEGTS_PID_PAT)
+            mpegts->patLength = 0;
+        consumed = mpegts_continue(mpegts, Pid, Data, DataLength);
+    }
+
+    /* Exit */
+    return consumed;
+}
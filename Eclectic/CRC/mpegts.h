@@ -0,0 +1,109 @@
+/****************************************************************************************************
+ * Pragmas
+ ****************************************************************************************************/
+
+#pragma once
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define MPEGTS_BATCH_COUNT (32) // Single Packet Sections Queued For One Verify Many
+#define MPEGTS_CONTINUITY_NONE (0xFF) // No Packet Seen On The PID Yet
+#define MPEGTS_PACKET_SIZE (188)
+#define MPEGTS_PAT_MAXIMUM_SIZE (1024) // Section Length Is Capped At 1021 Bytes For A PAT
+#define MPEGTS_PID_COUNT (8192)
+#define MPEGTS_PID_PAT (0x0000)
+#define MPEGTS_PID_SI_MAXIMUM (0x001F) // PAT, CAT, TSDT, NIT, SDT, EIT, TDT And The Rest Of The Reserved Range
+#define MPEGTS_SECTION_HEADER_SIZE (3) // Table ID, Flags And Section Length
+#define MPEGTS_SYNC_BYTE (0x47)
+#define MPEGTS_TABLE_ID_PAT (0x00)
+#define MPEGTS_TABLE_ID_STUFFING (0xFF)
+#define MPEGTS_TABLE_ID_TOT (0x73) // Carries A CRC Without The Section Syntax Indicator
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc32.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Callbacks ***/
+typedef void (*mpegts_sectionCallback_t)(const uint16_t Pid, const uint8_t TableId, const size_t SectionLength, const bool Verified, void * const argument); // Sections Carrying A CRC Only, Length Includes The Header
+
+/*** Structures ***/
+typedef struct mpegts_configuration_s
+{
+    void *argument;
+    const crc32_configuration_t *Crc32; // CRC-32/MPEG-2, Automatic Engine Recommended
+    mpegts_sectionCallback_t sectionCallback; // Or NULL
+} mpegts_configuration_t;
+
+typedef struct mpegts_pidStatistics_s
+{
+    size_t crcErrors;
+    size_t discontinuities; // Continuity Counter Jumps, The Section In Progress Is Dropped
+    size_t sections; // Sections Carrying A CRC, Including Failures
+    size_t unchecked; // Sections Without A CRC
+} mpegts_pidStatistics_t;
+
+typedef struct mpegts_pid_s
+{
+    bool assembling; // Section Spanning Packets In Progress
+    crc32_context_t context; // Spanning Section, Checksummed Piece By Piece Instead Of Reassembled
+    uint8_t continuity;
+    uint8_t header[MPEGTS_SECTION_HEADER_SIZE];
+    size_t headerLength;
+    bool psi; // Watched, Everything Else Is Skipped After The Packet Header
+    size_t remaining; // Section Bytes Still To Come Once The Header Is Complete
+    mpegts_pidStatistics_t statistics;
+} mpegts_pid_t;
+
+typedef struct mpegts_statistics_s
+{
+    double bytesPerSecond; // Validate File Only
+    size_t crcErrors;
+    bool mapped; // Validate File Only
+    uint64_t packets;
+    uint64_t processed;
+    double seconds; // Validate File Only
+    size_t sections;
+    size_t syncErrors; // Sync Byte Missing Where A Packet Should Start
+    size_t transportErrors; // Transport Error Indicator Set
+    size_t unchecked;
+} mpegts_statistics_t;
+
+typedef struct mpegts_s
+{
+    const uint8_t *batch[MPEGTS_BATCH_COUNT]; // Points Into The Caller's Data, Flushed Before Each Update Returns
+    size_t batchCount;
+    size_t batchLength[MPEGTS_BATCH_COUNT];
+    uint16_t batchPid[MPEGTS_BATCH_COUNT];
+    const mpegts_configuration_t *Configuration;
+    bool hunt; // Sync Lost, Skipping To The Next Sync Byte
+    uint8_t packet[MPEGTS_PACKET_SIZE]; // Packet Straddling Two Updates
+    size_t packetLength;
+    uint8_t pat[MPEGTS_PAT_MAXIMUM_SIZE]; // PAT Spanning Packets, Kept So Its Program Map PIDs Can Be Watched Once It Verifies
+    size_t patLength;
+    mpegts_pid_t *pid; // MPEGTS_PID_COUNT Entries
+    mpegts_statistics_t statistics;
+} mpegts_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void mpegts_deinit(mpegts_t * const mpegts);
+extern bool mpegts_init(mpegts_t * const mpegts, const mpegts_configuration_t * const Configuration);
+extern void mpegts_update(mpegts_t * const mpegts, const uint8_t *Data, const size_t DataLength);
+#ifdef CRC_FILE_AVAILABLE
+extern bool mpegts_validateFile(mpegts_t * const mpegts, const char * const Path, const crc_fileProgressCallback_t ProgressCallback, void * const progressArgument);
+#endif
+extern bool mpegts_watch(mpegts_t * const mpegts, const uint16_t Pid);
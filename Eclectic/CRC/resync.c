@@ -0,0 +1,207 @@
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc16.h"
+#include "Eclectic/CRC/crc32.h"
+#include "Eclectic/CRC/crc64.h"
+#include "Eclectic/CRC/crc8.h"
+#include "Eclectic/CRC/resync.h"
+#include "Eclectic/Miscellaneous/memory.h"
+#include "Eclectic/Miscellaneous/misc.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static uint64_t resync_reflect(const uint64_t Data, const size_t Width);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/*** Deinitialize ***/
+void resync_deinit(resync_t * const resync)
+{
+    /*** Deinitialize ***/
+    /* Error Check */
+    if((resync != NULL) && (resync->state != NULL))
+    {
+        /* Deinitialize */
+        memory_free((void **)&resync->state);
+        resync->count = 0;
+    }
+}
+
+/*** Initialize ***/
+bool resync_init(resync_t * const resync, const char * const Name, const size_t MinimumLength, const size_t MaximumLength, const resync_frameCallback_t FrameCallback, void * const argument)
+{
+    /*** Initialize ***/
+    /* Variable */
+    const crc_name_t *algorithm;
+    size_t bit;
+    uint64_t crc;
+    size_t i;
+    uint64_t initial;
+    uint64_t polynomial;
+    bool reflectIn;
+    bool reflectOut;
+    uint64_t residue;
+    size_t shift;
+    bool success;
+
+    /* Set Up */
+    success = false;
+
+    /* Error Check (Every Frame Needs A Byte Besides Its CRC) */
+    if((resync != NULL) && ((algorithm = crc_lookup(Name)) != NULL) && (MinimumLength > (algorithm->width / 8)) && (MinimumLength <= MaximumLength) && (FrameCallback != NULL))
+    {
+        /* Catalog (Any Width, Registers Widened To 64 Bits) */
+        switch(algorithm->width)
+        {
+            case 8:
+                initial = crc8_Configuration[algorithm->index].initial;
+                polynomial = crc8_Configuration[algorithm->index].polynomial;
+                reflectIn = crc8_Configuration[algorithm->index].reflectIn;
+                reflectOut = crc8_Configuration[algorithm->index].reflectOut;
+                residue = crc8_Configuration[algorithm->index].residue;
+                break;
+            case 16:
+                initial = crc16_Configuration[algorithm->index].initial;
+                polynomial = crc16_Configuration[algorithm->index].polynomial;
+                reflectIn = crc16_Configuration[algorithm->index].reflectIn;
+                reflectOut = crc16_Configuration[algorithm->index].reflectOut;
+                residue = crc16_Configuration[algorithm->index].residue;
+                break;
+            case 32:
+                initial = crc32_Configuration[algorithm->index].initial;
+                polynomial = crc32_Configuration[algorithm->index].polynomial;
+                reflectIn = crc32_Configuration[algorithm->index].reflectIn;
+                reflectOut = crc32_Configuration[algorithm->index].reflectOut;
+                residue = crc32_Configuration[algorithm->index].residue;
+                break;
+            default:
+                initial = crc64_Configuration[algorithm->index].initial;
+                polynomial = crc64_Configuration[algorithm->index].polynomial;
+                reflectIn = crc64_Configuration[algorithm->index].reflectIn;
+                reflectOut = crc64_Configuration[algorithm->index].reflectOut;
+                residue = crc64_Configuration[algorithm->index].residue;
+                break;
+        }
+
+        /* State (One Register Per Byte Of The Longest Frame) */
+        memset(resync, 0, sizeof(*resync));
+        if((resync->state = memory_malloc(MaximumLength * sizeof(uint64_t))) != NULL)
+        {
+            /* Set Up */
+            resync->argument = argument;
+            resync->frameCallback = FrameCallback;
+            resync->head = MaximumLength - 1; // First Candidate Lands On Index 0
+            resync->maximumLength = MaximumLength;
+            resync->minimumLength = MinimumLength;
+            resync->reflect = reflectIn;
+            shift = 64 - algorithm->width;
+
+            /* Lookup Table (Reflected Registers Sit In The Low Bits, Others In The High Bits, One Step For Every Width) */
+            for(i = 0; i < 256; i++)
+            {
+                if(reflectIn)
+                {
+                    crc = i;
+                    for(bit = 0; bit < 8; bit++)
+                        crc = (crc & 1) ? ((crc >> 1) ^ resync_reflect(polynomial, algorithm->width)) : (crc >> 1);
+                }
+                else
+                {
+                    crc = (uint64_t)i << 56;
+                    for(bit = 0; bit < 8; bit++)
+                        crc = (crc & 0x8000000000000000) ? ((crc << 1) ^ (polynomial << shift)) : (crc << 1);
+                }
+                resync->table[i] = crc;
+            }
+
+            /* Initial And Target (Verify Passes When The Output Stage Turns The Register Into The Residue) */
+            if(reflectIn)
+            {
+                resync->initial = resync_reflect(initial, algorithm->width);
+                resync->target = (reflectIn == reflectOut) ? residue : resync_reflect(residue, algorithm->width);
+            }
+            else
+            {
+                resync->initial = initial << shift;
+                resync->target = ((reflectIn == reflectOut) ? residue : resync_reflect(residue, algorithm->width)) << shift;
+            }
+            success = true;
+        }
+    }
+
+    /* Exit */
+    return success;
+}
+
+/*** Update ***/
+void resync_update(resync_t * const resync, const uint8_t *Data, const size_t DataLength)
+{
+    /*** Update ***/
+    /* Variable */
+    size_t age;
+    size_t count;
+    size_t i, j;
+    size_t length;
+    uint64_t *state;
+
+    /* Error Check */
+    if((resync != NULL) && (resync->state != NULL) && (Data != NULL))
+    {
+        /* Set Up */
+        count = resync->count;
+        state = resync->state;
+
+        /* Update (Every Byte Opens A Candidate And Advances Every Live One, Linear In The Stream For A Bounded Frame Length) */
+        for(i = 0; i < DataLength; i++)
+        {
+            /* Open (Live Candidates Fill The Ring From Index 0, Oldest Retired Once It Is Full) */
+            resync->head = ((resync->head + 1) == resync->maximumLength) ? 0 : (resync->head + 1);
+            state[resync->head] = resync->initial;
+            if(count < resync->maximumLength)
+                count++;
+            resync->offset++;
+
+            /* Advance (Same Byte Into Independent Registers, No Dependency Chain Between Them) */
+            for(j = 0; j < count; j++)
+            {
+                if(resync->reflect)
+                    state[j] = (state[j] >> 8) ^ resync->table[(state[j] ^ Data[i]) & 0xFF];
+                else
+                    state[j] = (state[j] << 8) ^ resync->table[(state[j] >> 56) ^ Data[i]];
+
+                /* Match (Rare, Age Recovered From The Ring Position Only On A Hit) */
+                if(state[j] == resync->target)
+                {
+                    age = (resync->head >= j) ? (resync->head - j) : (resync->head + resync->maximumLength - j);
+                    length = age + 1;
+                    if(length >= resync->minimumLength)
+                        resync->frameCallback(resync->offset - length, length, resync->argument);
+                }
+            }
+        }
+        resync->count = count;
+    }
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/*** Reflect ***/
+static uint64_t resync_reflect(const uint64_t Data, const size_t Width)
+{
+    /*** Reflect ***/
+    /* Exit */
+    return misc_reflect64(Data) >> (64 - Width);
+}
@@ -0,0 +1,46 @@
+/****************************************************************************************************
+ * Pragmas
+ ****************************************************************************************************/
+
+#pragma once
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Callbacks ***/
+typedef void (*resync_frameCallback_t)(const uint64_t Offset, const size_t Length, void * const argument); // Offset From The Start Of The Stream, Length Includes The CRC
+
+/*** Structures ***/
+typedef struct resync_s
+{
+    void *argument;
+    size_t count; // Candidate Starts Alive
+    resync_frameCallback_t frameCallback;
+    size_t head; // Ring Index Of The Newest Candidate
+    uint64_t initial; // Register Representation, Left Aligned When Not Reflected
+    size_t maximumLength;
+    size_t minimumLength;
+    uint64_t offset; // Bytes Consumed
+    bool reflect;
+    uint64_t *state; // Ring Of Registers, One Per Candidate Start
+    uint64_t table[256];
+    uint64_t target; // Register Every Valid Frame Leaves Behind (The Residue)
+} resync_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+extern void resync_deinit(resync_t * const resync);
+extern bool resync_init(resync_t * const resync, const char * const Name, const size_t MinimumLength, const size_t MaximumLength, const resync_frameCallback_t FrameCallback, void * const argument);
+extern void resync_update(resync_t * const resync, const uint8_t *Data, const size_t DataLength);
@@ -0,0 +1,691 @@
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define SCRUB_RING_STOP (UINT64_MAX) // user_data Of The NOP That Stops The Reaper
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc64.h"
+#include "Eclectic/CRC/scrub.h"
+#include "Eclectic/Miscellaneous/memory.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(CRC_FILE_AVAILABLE) && defined(CRC_PTHREAD_AVAILABLE)
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+#ifdef SCRUB_IO_URING_AVAILABLE
+#include <linux/io_uring.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#ifndef __NR_io_uring_setup
+#undef SCRUB_IO_URING_AVAILABLE // Kernel Header Present, C Library Too Old To Name The System Calls
+#endif
+#endif
+
+#if defined(CRC_FILE_AVAILABLE) && defined(CRC_PTHREAD_AVAILABLE)
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void scrub_hashDispatch(scrub_t * const scrub, scrub_slot_t * const slot, const size_t Buffer);
+static void *scrub_hashWorker(void *argument);
+static void scrub_queueClose(scrub_queue_t * const queue);
+static void scrub_queueDeinit(scrub_queue_t * const queue);
+static void scrub_queueInit(scrub_queue_t * const queue, scrub_event_t * const event, const size_t Capacity);
+static bool scrub_queuePop(scrub_queue_t * const queue, scrub_event_t * const event);
+static void scrub_queuePush(scrub_queue_t * const queue, const scrub_event_t * const Event);
+static void scrub_readDispatch(scrub_t * const scrub, scrub_slot_t * const slot);
+static void *scrub_readWorker(void *argument);
+#ifdef SCRUB_IO_URING_AVAILABLE
+static void scrub_ringDeinit(scrub_ring_t * const ring);
+static bool scrub_ringInit(scrub_ring_t * const ring, const unsigned int Entries);
+static void *scrub_ringReaper(void *argument);
+static bool scrub_ringSubmit(scrub_ring_t * const ring, const uint8_t Opcode, const int FileDescriptor, const struct iovec * const Vector, const uint64_t Offset, const uint64_t UserData);
+#endif
+static void scrub_slotAdvance(scrub_t * const scrub, scrub_slot_t * const slot);
+static void scrub_slotComplete(scrub_t * const scrub, scrub_slot_t * const slot);
+static void scrub_slotOpen(scrub_t * const scrub, scrub_slot_t * const slot);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/*** Run ***/
+bool scrub_run(const scrub_configuration_t * const Configuration, const char * const Path[], const size_t PathCount, scrub_statistics_t * const statistics)
+{
+    /*** Run ***/
+    /* Variable */
+    uint8_t *buffer;
+    struct timespec end;
+    scrub_event_t event;
+    size_t eventCapacity;
+    size_t i;
+    void *memory;
+    size_t memorySize;
+    scrub_t scrub;
+    scrub_slot_t *slot;
+    struct timespec start;
+    bool success;
+    size_t workerCount;
+
+    /* Set Up */
+    memory = NULL;
+    success = false;
+
+    /* Error Check */
+    if((Configuration != NULL) && (Configuration->Configuration != NULL) && ((Path != NULL) || (PathCount == 0)))
+    {
+        /* Set Up (Never More Slots Than Files) */
+        (void)memset(&scrub, 0, sizeof(scrub));
+        scrub.Configuration = Configuration;
+        scrub.Path = Path;
+        scrub.pathCount = PathCount;
+        scrub.blockSize = (Configuration->blockSize > 0) ? Configuration->blockSize : SCRUB_BLOCK_SIZE;
+        scrub.queueDepth = (Configuration->queueDepth > 0) ? Configuration->queueDepth : SCRUB_QUEUE_DEPTH;
+        scrub.queueDepth = (scrub.queueDepth > SCRUB_QUEUE_DEPTH_MAXIMUM) ? SCRUB_QUEUE_DEPTH_MAXIMUM : scrub.queueDepth;
+        scrub.queueDepth = (scrub.queueDepth > PathCount) ? PathCount : scrub.queueDepth;
+        workerCount = (Configuration->workerCount > 0) ? Configuration->workerCount : SCRUB_WORKER_COUNT;
+        workerCount = (workerCount > SCRUB_WORKER_COUNT_MAXIMUM) ? SCRUB_WORKER_COUNT_MAXIMUM : workerCount;
+        eventCapacity = 2 * scrub.queueDepth; // One Read And One Hash Outstanding Per Slot
+
+        /* Allocate (Slots, Queues, Threads, Then Two Buffers Per Slot On A Cache Line) */
+        memorySize = (scrub.queueDepth * sizeof(scrub_slot_t)) + (3 * eventCapacity * sizeof(scrub_event_t)) + ((workerCount + scrub.queueDepth) * sizeof(pthread_t)) + 64 + (2 * scrub.queueDepth * scrub.blockSize);
+        if((memory = memory_malloc(memorySize)) != NULL)
+        {
+            (void)clock_gettime(CLOCK_MONOTONIC, &start);
+            (void)memset(memory, 0, memorySize - (2 * scrub.queueDepth * scrub.blockSize));
+            scrub.slot = memory;
+            scrub_queueInit(&scrub.event, (scrub_event_t *)(scrub.slot + scrub.queueDepth), eventCapacity);
+            scrub_queueInit(&scrub.hash, scrub.event.event + eventCapacity, eventCapacity);
+            scrub_queueInit(&scrub.read, scrub.hash.event + eventCapacity, eventCapacity);
+            scrub.worker = (pthread_t *)(scrub.read.event + eventCapacity);
+            scrub.reader = scrub.worker + workerCount;
+            buffer = (uint8_t *)(((uintptr_t)(scrub.reader + scrub.queueDepth) + 63) & ~(uintptr_t)63);
+
+            /* Backend (io_uring Where The Kernel Allows It, pread Threads Otherwise) */
+            scrub.backend = SCRUB_BACKEND_PREAD;
+#ifdef SCRUB_IO_URING_AVAILABLE
+            if((Configuration->backend != SCRUB_BACKEND_PREAD) && scrub_ringInit(&scrub.ring, (unsigned int)scrub.queueDepth + 1))
+            {
+                if(pthread_create(&scrub.ring.reaper, NULL, scrub_ringReaper, &scrub) == 0)
+                    scrub.backend = SCRUB_BACKEND_IO_URING;
+                else
+                    scrub_ringDeinit(&scrub.ring);
+            }
+#endif
+            if(scrub.backend == SCRUB_BACKEND_PREAD)
+            {
+                for(i = 0; i < scrub.queueDepth; i++)
+                {
+                    if(pthread_create(&scrub.reader[scrub.readerCount], NULL, scrub_readWorker, &scrub) == 0)
+                        scrub.readerCount++;
+                }
+            }
+
+            /* Workers (Missing Threads Degrade To Inline Work On This Thread) */
+            for(i = 0; i < workerCount; i++)
+            {
+                if(pthread_create(&scrub.worker[scrub.workerCount], NULL, scrub_hashWorker, &scrub) == 0)
+                    scrub.workerCount++;
+            }
+
+            /* Prime (One File Per Slot) */
+            for(i = 0; i < scrub.queueDepth; i++)
+            {
+                slot = &scrub.slot[i];
+                slot->buffer[0] = buffer + ((2 * i) * scrub.blockSize);
+                slot->buffer[1] = buffer + (((2 * i) + 1) * scrub.blockSize);
+                slot->fileDescriptor = -1;
+                scrub_slotOpen(&scrub, slot);
+                scrub_slotAdvance(&scrub, slot);
+            }
+
+            /* Drain (Every Completion Moves Its Slot Forward, Finished Slots Pick Up The Next File) */
+            while((scrub.activeCount > 0) && scrub_queuePop(&scrub.event, &event))
+            {
+                slot = &scrub.slot[event.slot];
+                if(event.type == SCRUB_EVENT_TYPE_READ)
+                {
+                    if(event.result < 0)
+                    {
+                        slot->error = (int)-event.result;
+                        slot->state[event.buffer] = SCRUB_BUFFER_STATE_FREE;
+                    }
+                    else if(event.result == 0)
+                    {
+                        slot->size = slot->offset; // Truncated While Scrubbing
+                        slot->state[event.buffer] = SCRUB_BUFFER_STATE_FREE;
+                    }
+                    else
+                    {
+                        slot->length[event.buffer] = (size_t)event.result;
+                        slot->offset += (uint64_t)event.result;
+                        slot->state[event.buffer] = SCRUB_BUFFER_STATE_READY;
+                    }
+                }
+                else
+                {
+                    slot->state[event.buffer] = SCRUB_BUFFER_STATE_FREE;
+                }
+                scrub_slotAdvance(&scrub, slot);
+            }
+
+            /* Shut Down */
+            scrub_queueClose(&scrub.hash);
+            scrub_queueClose(&scrub.read);
+            for(i = 0; i < scrub.workerCount; i++)
+                (void)pthread_join(scrub.worker[i], NULL);
+            for(i = 0; i < scrub.readerCount; i++)
+                (void)pthread_join(scrub.reader[i], NULL);
+#ifdef SCRUB_IO_URING_AVAILABLE
+            if(scrub.backend == SCRUB_BACKEND_IO_URING)
+            {
+                (void)scrub_ringSubmit(&scrub.ring, IORING_OP_NOP, -1, NULL, 0, SCRUB_RING_STOP);
+                (void)pthread_join(scrub.ring.reaper, NULL);
+                scrub_ringDeinit(&scrub.ring);
+            }
+#endif
+            scrub_queueDeinit(&scrub.event);
+            scrub_queueDeinit(&scrub.hash);
+            scrub_queueDeinit(&scrub.read);
+            memory_free(&memory);
+
+            /* Statistics */
+            if(statistics != NULL)
+            {
+                (void)clock_gettime(CLOCK_MONOTONIC, &end);
+                *statistics = scrub.statistics;
+                statistics->backend = scrub.backend;
+                statistics->seconds = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+                statistics->bytesPerSecond = (statistics->seconds > 0.0) ? ((double)statistics->bytes / statistics->seconds) : 0.0;
+            }
+            success = true;
+        }
+    }
+
+    /* Exit */
+    return success;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/*** Hash Dispatch ***/
+static void scrub_hashDispatch(scrub_t * const scrub, scrub_slot_t * const slot, const size_t Buffer)
+{
+    /*** Hash Dispatch ***/
+    /* Variable */
+    scrub_event_t event;
+
+    /* Set Up */
+    (void)memset(&event, 0, sizeof(event));
+    event.buffer = Buffer;
+    event.data = slot->buffer[Buffer];
+    event.length = slot->length[Buffer];
+    event.slot = (size_t)(slot - scrub->slot);
+    event.type = SCRUB_EVENT_TYPE_HASH;
+    slot->state[Buffer] = SCRUB_BUFFER_STATE_HASHING;
+
+    /* Dispatch */
+    if(scrub->workerCount > 0)
+    {
+        scrub_queuePush(&scrub->hash, &event);
+    }
+    else
+    {
+        crc64_contextUpdate(&slot->context, event.data, event.length);
+        scrub_queuePush(&scrub->event, &event);
+    }
+}
+
+/*** Hash Worker ***/
+static void *scrub_hashWorker(void *argument)
+{
+    /*** Hash Worker ***/
+    /* Variable */
+    scrub_event_t event;
+    scrub_t * const Scrub = argument;
+
+    /* Hash (A Slot Never Has Two Blocks Queued, So Its Context Sees Them In Order) */
+    while(scrub_queuePop(&Scrub->hash, &event))
+    {
+        crc64_contextUpdate(&Scrub->slot[event.slot].context, event.data, event.length);
+        scrub_queuePush(&Scrub->event, &event);
+    }
+
+    /* Exit */
+    return NULL;
+}
+
+/*** Queue Close ***/
+static void scrub_queueClose(scrub_queue_t * const queue)
+{
+    /*** Queue Close ***/
+    /* Close (Waiters Drain What Is Left, Then Stop) */
+    (void)pthread_mutex_lock(&queue->mutex);
+    queue->closed = true;
+    (void)pthread_cond_broadcast(&queue->condition);
+    (void)pthread_mutex_unlock(&queue->mutex);
+}
+
+/*** Queue Deinitialize ***/
+static void scrub_queueDeinit(scrub_queue_t * const queue)
+{
+    /*** Queue Deinitialize ***/
+    /* Deinitialize */
+    (void)pthread_cond_destroy(&queue->condition);
+    (void)pthread_mutex_destroy(&queue->mutex);
+}
+
+/*** Queue Initialize ***/
+static void scrub_queueInit(scrub_queue_t * const queue, scrub_event_t * const event, const size_t Capacity)
+{
+    /*** Queue Initialize ***/
+    /* Initialize */
+    queue->capacity = Capacity;
+    queue->closed = false;
+    queue->count = 0;
+    queue->event = event;
+    queue->head = 0;
+    (void)pthread_cond_init(&queue->condition, NULL);
+    (void)pthread_mutex_init(&queue->mutex, NULL);
+}
+
+/*** Queue Pop ***/
+static bool scrub_queuePop(scrub_queue_t * const queue, scrub_event_t * const event)
+{
+    /*** Queue Pop ***/
+    /* Variable */
+    bool popped;
+
+    /* Pop (Blocks Until An Event Arrives Or The Queue Is Closed And Empty) */
+    (void)pthread_mutex_lock(&queue->mutex);
+    while((queue->count == 0) && !queue->closed)
+        (void)pthread_cond_wait(&queue->condition, &queue->mutex);
+    popped = (queue->count > 0);
+    if(popped)
+    {
+        *event = queue->event[queue->head];
+        queue->head = (queue->head + 1) % queue->capacity;
+        queue->count--;
+        (void)pthread_cond_broadcast(&queue->condition);
+    }
+    (void)pthread_mutex_unlock(&queue->mutex);
+
+    /* Exit */
+    return popped;
+}
+
+/*** Queue Push ***/
+static void scrub_queuePush(scrub_queue_t * const queue, const scrub_event_t * const Event)
+{
+    /*** Queue Push ***/
+    /* Push (Capacity Covers Every Outstanding Event, The Wait Is Only A Safety Net) */
+    (void)pthread_mutex_lock(&queue->mutex);
+    while(queue->count == queue->capacity)
+        (void)pthread_cond_wait(&queue->condition, &queue->mutex);
+    queue->event[(queue->head + queue->count) % queue->capacity] = *Event;
+    queue->count++;
+    (void)pthread_cond_broadcast(&queue->condition);
+    (void)pthread_mutex_unlock(&queue->mutex);
+}
+
+/*** Read Dispatch ***/
+static void scrub_readDispatch(scrub_t * const scrub, scrub_slot_t * const slot)
+{
+    /*** Read Dispatch ***/
+    /* Variable */
+    scrub_event_t event;
+
+    /* Set Up */
+    (void)memset(&event, 0, sizeof(event));
+    event.buffer = slot->readBuffer;
+    event.data = slot->buffer[event.buffer];
+    event.fileDescriptor = slot->fileDescriptor;
+    event.length = ((slot->size - slot->offset) < scrub->blockSize) ? (size_t)(slot->size - slot->offset) : scrub->blockSize;
+    event.offset = slot->offset;
+    event.slot = (size_t)(slot - scrub->slot);
+    event.type = SCRUB_EVENT_TYPE_READ;
+    slot->state[event.buffer] = SCRUB_BUFFER_STATE_READING;
+    slot->readBuffer ^= 1;
+
+    /* Dispatch */
+#ifdef SCRUB_IO_URING_AVAILABLE
+    if(scrub->backend == SCRUB_BACKEND_IO_URING)
+    {
+        slot->vector[event.buffer].iov_base = event.data;
+        slot->vector[event.buffer].iov_len = event.length;
+        if(!scrub_ringSubmit(&scrub->ring, IORING_OP_READV, event.fileDescriptor, &slot->vector[event.buffer], event.offset, (event.slot << 1) | event.buffer))
+        {
+            event.result = -EIO;
+            scrub_queuePush(&scrub->event, &event);
+        }
+    }
+    else
+#endif
+    if(scrub->readerCount > 0)
+    {
+        scrub_queuePush(&scrub->read, &event);
+    }
+    else
+    {
+        while(((event.result = pread(event.fileDescriptor, event.data, event.length, (off_t)event.offset)) < 0) && (errno == EINTR))
+            ;
+        if(event.result < 0)
+            event.result = -errno;
+        scrub_queuePush(&scrub->event, &event);
+    }
+}
+
+/*** Read Worker ***/
+static void *scrub_readWorker(void *argument)
+{
+    /*** Read Worker ***/
+    /* Variable */
+    scrub_event_t event;
+    scrub_t * const Scrub = argument;
+
+    /* Read (Each Thread Keeps One pread In Flight) */
+    while(scrub_queuePop(&Scrub->read, &event))
+    {
+        while(((event.result = pread(event.fileDescriptor, event.data, event.length, (off_t)event.offset)) < 0) && (errno == EINTR))
+            ;
+        if(event.result < 0)
+            event.result = -errno;
+        scrub_queuePush(&Scrub->event, &event);
+    }
+
+    /* Exit */
+    return NULL;
+}
+
+#ifdef SCRUB_IO_URING_AVAILABLE
+/*** Ring Deinitialize ***/
+static void scrub_ringDeinit(scrub_ring_t * const ring)
+{
+    /*** Ring Deinitialize ***/
+    /* Unmap */
+    if(ring->sqes != NULL)
+        (void)munmap(ring->sqes, ring->sqesSize);
+    if((ring->completionRing != NULL) && (ring->completionRing != ring->submissionRing))
+        (void)munmap(ring->completionRing, ring->completionRingSize);
+    if(ring->submissionRing != NULL)
+        (void)munmap(ring->submissionRing, ring->submissionRingSize);
+
+    /* Close */
+    if(ring->fileDescriptor >= 0)
+        (void)close(ring->fileDescriptor);
+    (void)memset(ring, 0, sizeof(*ring));
+    ring->fileDescriptor = -1;
+}
+
+/*** Ring Initialize ***/
+static bool scrub_ringInit(scrub_ring_t * const ring, const unsigned int Entries)
+{
+    /*** Ring Initialize ***/
+    /* Variable */
+    uint8_t *completion;
+    void *mapping;
+    struct io_uring_params parameters;
+    bool singleMapping;
+    uint8_t *submission;
+    bool success;
+
+    /* Set Up (Seccomp Or io_uring_disabled Makes Setup Fail, Which Selects The pread Backend) */
+    (void)memset(ring, 0, sizeof(*ring));
+    (void)memset(&parameters, 0, sizeof(parameters));
+    success = false;
+
+    /* Error Check */
+    if((ring->fileDescriptor = (int)syscall(__NR_io_uring_setup, Entries, &parameters)) >= 0)
+    {
+        /* Map Rings */
+        ring->submissionRingSize = parameters.sq_off.array + (parameters.sq_entries * sizeof(unsigned int));
+        ring->completionRingSize = parameters.cq_off.cqes + (parameters.cq_entries * sizeof(struct io_uring_cqe));
+        singleMapping = false;
+#ifdef IORING_FEAT_SINGLE_MMAP
+        singleMapping = ((parameters.features & IORING_FEAT_SINGLE_MMAP) == IORING_FEAT_SINGLE_MMAP);
+#endif
+        if(singleMapping)
+        {
+            ring->submissionRingSize = (ring->completionRingSize > ring->submissionRingSize) ? ring->completionRingSize : ring->submissionRingSize;
+            ring->completionRingSize = ring->submissionRingSize;
+        }
+        mapping = mmap(NULL, ring->submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fileDescriptor, IORING_OFF_SQ_RING);
+        ring->submissionRing = (mapping != MAP_FAILED) ? mapping : NULL;
+        if(singleMapping)
+            mapping = ring->submissionRing;
+        else
+            mapping = mmap(NULL, ring->completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fileDescriptor, IORING_OFF_CQ_RING);
+        ring->completionRing = (mapping != MAP_FAILED) ? mapping : NULL;
+        ring->sqesSize = parameters.sq_entries * sizeof(struct io_uring_sqe);
+        mapping = mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fileDescriptor, IORING_OFF_SQES);
+        ring->sqes = (mapping != MAP_FAILED) ? mapping : NULL;
+        success = ((ring->submissionRing != NULL) && (ring->completionRing != NULL) && (ring->sqes != NULL));
+
+        /* Ring Pointers */
+        if(success)
+        {
+            submission = ring->submissionRing;
+            completion = ring->completionRing;
+            ring->sqArray = (unsigned int *)(submission + parameters.sq_off.array);
+            ring->sqHead = (unsigned int *)(submission + parameters.sq_off.head);
+            ring->sqMask = (unsigned int *)(submission + parameters.sq_off.ring_mask);
+            ring->sqTail = (unsigned int *)(submission + parameters.sq_off.tail);
+            ring->cqes = completion + parameters.cq_off.cqes;
+            ring->cqHead = (unsigned int *)(completion + parameters.cq_off.head);
+            ring->cqMask = (unsigned int *)(completion + parameters.cq_off.ring_mask);
+            ring->cqTail = (unsigned int *)(completion + parameters.cq_off.tail);
+        }
+    }
+
+    /* Clean Up */
+    if(!success)
+        scrub_ringDeinit(ring);
+
+    /* Exit */
+    return success;
+}
+
+/*** Ring Reaper ***/
+static void *scrub_ringReaper(void *argument)
+{
+    /*** Ring Reaper ***/
+    /* Variable */
+    const struct io_uring_cqe *Cqe;
+    scrub_event_t event;
+    unsigned int head;
+    scrub_ring_t *ring;
+    scrub_t * const Scrub = argument;
+    bool stop;
+
+    /* Set Up */
+    ring = &Scrub->ring;
+    stop = false;
+
+    /* Reap (Sole Consumer Of The Completion Ring, Submission Stays On The Scrubbing Thread) */
+    while(!stop)
+    {
+        head = *ring->cqHead;
+        if(head == __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE))
+        {
+            (void)syscall(__NR_io_uring_enter, ring->fileDescriptor, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+            continue;
+        }
+        Cqe = &((const struct io_uring_cqe *)ring->cqes)[head & *ring->cqMask];
+        if(Cqe->user_data == SCRUB_RING_STOP)
+        {
+            stop = true;
+        }
+        else
+        {
+            (void)memset(&event, 0, sizeof(event));
+            event.buffer = (size_t)(Cqe->user_data & 1);
+            event.result = Cqe->res;
+            event.slot = (size_t)(Cqe->user_data >> 1);
+            event.type = SCRUB_EVENT_TYPE_READ;
+            scrub_queuePush(&Scrub->event, &event);
+        }
+        __atomic_store_n(ring->cqHead, head + 1, __ATOMIC_RELEASE);
+    }
+
+    /* Exit */
+    return NULL;
+}
+
+/*** Ring Submit ***/
+static bool scrub_ringSubmit(scrub_ring_t * const ring, const uint8_t Opcode, const int FileDescriptor, const struct iovec * const Vector, const uint64_t Offset, const uint64_t UserData)
+{
+    /*** Ring Submit ***/
+    /* Variable */
+    unsigned int index;
+    struct io_uring_sqe *sqe;
+    bool success;
+    unsigned int tail;
+
+    /* Fill (The Ring Has More Entries Than Reads In Flight, So It Never Fills) */
+    tail = *ring->sqTail;
+    index = tail & *ring->sqMask;
+    sqe = &((struct io_uring_sqe *)ring->sqes)[index];
+    (void)memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = Opcode;
+    sqe->fd = FileDescriptor;
+    sqe->addr = (uint64_t)(uintptr_t)Vector;
+    sqe->len = (Vector != NULL) ? 1 : 0;
+    sqe->off = Offset;
+    sqe->user_data = UserData;
+    ring->sqArray[index] = index;
+    __atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+
+    /* Submit (Published Entries Cannot Be Taken Back, So Retry Until The Kernel Has Consumed This One) */
+    success = true;
+    while(success && (__atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE) != (tail + 1)))
+    {
+        if((syscall(__NR_io_uring_enter, ring->fileDescriptor, 1, 0, 0, NULL, 0) < 0) && (errno != EINTR))
+        {
+            /* Completion Ring Full Until The Reaper Drains It, Or Kernel Short Of Memory, Otherwise The Ring Is Unusable And Never Consumes Anything Again */
+            if((errno == EAGAIN) || (errno == EBUSY))
+                (void)sched_yield();
+            else
+                success = false;
+        }
+    }
+
+    /* Exit */
+    return success;
+}
+#endif
+
+/*** Slot Advance ***/
+static void scrub_slotAdvance(scrub_t * const scrub, scrub_slot_t * const slot)
+{
+    /*** Slot Advance ***/
+    /* Variable */
+    size_t buffer;
+
+    /* Advance (Loops Only To Skip Through Files That Finish Without Any I/O) */
+    while(slot->active)
+    {
+        /* Hash (At Most One Block Per Slot, Two Buffers Means The Ready One Is Always Next In Order) */
+        if((slot->state[0] != SCRUB_BUFFER_STATE_HASHING) && (slot->state[1] != SCRUB_BUFFER_STATE_HASHING))
+        {
+            for(buffer = 0; buffer < 2; buffer++)
+            {
+                if(slot->state[buffer] == SCRUB_BUFFER_STATE_READY)
+                {
+                    scrub_hashDispatch(scrub, slot, buffer);
+                    break;
+                }
+            }
+        }
+
+        /* Read (One Read In Flight Per Slot, Overlapping The Hash Of The Previous Block) */
+        if((slot->error == 0) && (slot->offset < slot->size) && (slot->state[0] != SCRUB_BUFFER_STATE_READING) && (slot->state[1] != SCRUB_BUFFER_STATE_READING) && (slot->state[slot->readBuffer] == SCRUB_BUFFER_STATE_FREE))
+            scrub_readDispatch(scrub, slot);
+
+        /* Complete */
+        if((slot->state[0] != SCRUB_BUFFER_STATE_FREE) || (slot->state[1] != SCRUB_BUFFER_STATE_FREE))
+            break;
+        scrub_slotComplete(scrub, slot);
+    }
+}
+
+/*** Slot Complete ***/
+static void scrub_slotComplete(scrub_t * const scrub, scrub_slot_t * const slot)
+{
+    /*** Slot Complete ***/
+    /* Variable */
+    uint64_t crc;
+
+    /* Report */
+    crc = (slot->error == 0) ? crc64_contextFinal(&slot->context) : 0;
+    scrub->statistics.bytes += slot->offset;
+    scrub->statistics.files++;
+    if(slot->error != 0)
+        scrub->statistics.failed++;
+    if(scrub->Configuration->resultCallback != NULL)
+        scrub->Configuration->resultCallback(scrub->Path[slot->path], crc, slot->offset, slot->error, scrub->Configuration->argument);
+
+    /* Close */
+    if(slot->fileDescriptor >= 0)
+        (void)close(slot->fileDescriptor);
+    slot->fileDescriptor = -1;
+    slot->active = false;
+    scrub->activeCount--;
+
+    /* Next File */
+    scrub_slotOpen(scrub, slot);
+}
+
+/*** Slot Open ***/
+static void scrub_slotOpen(scrub_t * const scrub, scrub_slot_t * const slot)
+{
+    /*** Slot Open ***/
+    /* Variable */
+    struct stat fileStatus;
+
+    /* Error Check */
+    if(scrub->nextPath < scrub->pathCount)
+    {
+        /* Set Up */
+        slot->active = true;
+        slot->error = 0;
+        slot->offset = 0;
+        slot->path = scrub->nextPath++;
+        slot->readBuffer = 0;
+        slot->size = 0;
+        slot->state[0] = SCRUB_BUFFER_STATE_FREE;
+        slot->state[1] = SCRUB_BUFFER_STATE_FREE;
+        crc64_contextInit(&slot->context, scrub->Configuration->Configuration);
+        scrub->activeCount++;
+
+        /* Open (Failures Are Reported Through The Slot Like Any Other Result) */
+        if(scrub->Path[slot->path] == NULL)
+            slot->error = EINVAL;
+        else if((slot->fileDescriptor = open(scrub->Path[slot->path], O_RDONLY | O_CLOEXEC)) < 0)
+            slot->error = errno;
+        else if(fstat(slot->fileDescriptor, &fileStatus) != 0)
+            slot->error = errno;
+        else if(!S_ISREG(fileStatus.st_mode))
+            slot->error = EINVAL;
+        else
+            slot->size = (uint64_t)fileStatus.st_size;
+#ifdef POSIX_FADV_SEQUENTIAL
+        if(slot->error == 0)
+            (void)posix_fadvise(slot->fileDescriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    }
+}
+#endif
@@ -0,0 +1,177 @@
+/****************************************************************************************************
+ * Pragmas
+ ****************************************************************************************************/
+
+#pragma once
+
+/****************************************************************************************************
+ * Defines
+ ****************************************************************************************************/
+
+#define SCRUB_BLOCK_SIZE (1024 * 1024)
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define SCRUB_IO_URING_AVAILABLE
+#endif
+#endif
+#define SCRUB_QUEUE_DEPTH (32)
+#define SCRUB_QUEUE_DEPTH_MAXIMUM (256)
+#define SCRUB_WORKER_COUNT (4)
+#define SCRUB_WORKER_COUNT_MAXIMUM (64)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "Eclectic/CRC/crc.h"
+#include "Eclectic/CRC/crc64.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#if defined(CRC_FILE_AVAILABLE) && defined(CRC_PTHREAD_AVAILABLE)
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#endif
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Enumerations ***/
+typedef enum scrub_backend_e
+{
+    SCRUB_BACKEND_AUTOMATIC,
+    SCRUB_BACKEND_IO_URING,
+    SCRUB_BACKEND_PREAD
+} scrub_backend_t;
+
+typedef enum scrub_bufferState_e
+{
+    SCRUB_BUFFER_STATE_FREE,
+    SCRUB_BUFFER_STATE_READING,
+    SCRUB_BUFFER_STATE_READY,
+    SCRUB_BUFFER_STATE_HASHING
+} scrub_bufferState_t;
+
+typedef enum scrub_eventType_e
+{
+    SCRUB_EVENT_TYPE_HASH,
+    SCRUB_EVENT_TYPE_READ
+} scrub_eventType_t;
+
+/*** Callbacks ***/
+typedef void (*scrub_resultCallback_t)(const char * const Path, const uint64_t Crc, const uint64_t Length, const int Error, void * const argument); // Error Is An errno Value, 0 On Success
+
+/*** Structures ***/
+typedef struct scrub_configuration_s
+{
+    void *argument;
+    scrub_backend_t backend;
+    size_t blockSize; // 0 Selects SCRUB_BLOCK_SIZE
+    const crc64_configuration_t *Configuration;
+    size_t queueDepth; // Reads In Flight, 0 Selects SCRUB_QUEUE_DEPTH
+    scrub_resultCallback_t resultCallback;
+    size_t workerCount; // CRC Threads, 0 Selects SCRUB_WORKER_COUNT
+} scrub_configuration_t;
+
+typedef struct scrub_statistics_s
+{
+    scrub_backend_t backend;
+    uint64_t bytes;
+    double bytesPerSecond;
+    size_t failed;
+    size_t files;
+    double seconds;
+} scrub_statistics_t;
+
+#if defined(CRC_FILE_AVAILABLE) && defined(CRC_PTHREAD_AVAILABLE)
+typedef struct scrub_event_s
+{
+    size_t buffer;
+    uint8_t *data;
+    int fileDescriptor;
+    size_t length;
+    uint64_t offset;
+    ssize_t result; // Bytes Read, Or -errno
+    size_t slot;
+    scrub_eventType_t type;
+} scrub_event_t;
+
+typedef struct scrub_queue_s
+{
+    size_t capacity;
+    bool closed;
+    pthread_cond_t condition;
+    size_t count;
+    scrub_event_t *event;
+    size_t head;
+    pthread_mutex_t mutex;
+} scrub_queue_t;
+
+typedef struct scrub_ring_s
+{
+    void *completionRing;
+    size_t completionRingSize;
+    void *cqes;
+    unsigned int *cqHead;
+    unsigned int *cqMask;
+    unsigned int *cqTail;
+    int fileDescriptor;
+    pthread_t reaper;
+    void *sqes;
+    size_t sqesSize;
+    unsigned int *sqArray;
+    unsigned int *sqHead; // Advanced By The Kernel As It Consumes Entries
+    unsigned int *sqMask;
+    unsigned int *sqTail;
+    void *submissionRing;
+    size_t submissionRingSize;
+} scrub_ring_t;
+
+typedef struct scrub_slot_s
+{
+    bool active;
+    uint8_t *buffer[2];
+    crc64_context_t context;
+    int error;
+    int fileDescriptor;
+    size_t length[2];
+    uint64_t offset; // Next Read
+    size_t path;
+    size_t readBuffer; // Next Buffer To Read Into
+    uint64_t size;
+    scrub_bufferState_t state[2];
+    struct iovec vector[2];
+} scrub_slot_t;
+
+typedef struct scrub_s
+{
+    size_t activeCount;
+    scrub_backend_t backend;
+    size_t blockSize;
+    const scrub_configuration_t *Configuration;
+    scrub_queue_t event; // Read And Hash Completions, Drained By The Submitting Thread
+    scrub_queue_t hash; // Blocks Waiting For A CRC Worker
+    size_t nextPath;
+    const char * const *Path;
+    size_t pathCount;
+    size_t queueDepth;
+    scrub_queue_t read; // Read Requests Waiting For A pread Thread
+    size_t readerCount;
+    pthread_t *reader;
+    scrub_ring_t ring;
+    scrub_slot_t *slot;
+    scrub_statistics_t statistics;
+    size_t workerCount;
+    pthread_t *worker;
+} scrub_t;
+#endif
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+#if defined(CRC_FILE_AVAILABLE) && defined(CRC_PTHREAD_AVAILABLE)
+extern bool scrub_run(const scrub_configuration_t * const Configuration, const char * const Path[], const size_t PathCount, scrub_statistics_t * const statistics);
+#endif
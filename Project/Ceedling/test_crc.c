@@ -0,0 +1,707 @@
+/****************************************************************************************************
+ * Include
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include "misc.h"
+#include "mock_memory.h"
+#include "random.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "unity.h"
+
+/****************************************************************************************************
+ * Helper
+ ****************************************************************************************************/
+
+/*** File Progress (Count Calls) ***/
+static void helper_fileProgress(const uint64_t Processed, const uint64_t Total, void * const argument)
+{
+    /*** File Progress (Count Calls) ***/
+    /* Count */
+    (void)Processed;
+    (void)Total;
+    (*(size_t *)argument)++;
+}
+
+/*** File Update (Append To Buffer) ***/
+static void helper_fileUpdate(void * const context, const uint8_t *Data, const size_t DataLength)
+{
+    /*** File Update (Append To Buffer) ***/
+    /* Variable */
+    uint8_t **cursor = context;
+
+    /* Append */
+    memcpy(*cursor, Data, DataLength);
+    *cursor += DataLength;
+}
+
+/*** File Zero (Append Zeros To Buffer) ***/
+static void helper_fileZero(void * const context, const uint64_t Length)
+{
+    /*** File Zero (Append Zeros To Buffer) ***/
+    /* Variable */
+    uint8_t **cursor = context;
+
+    /* Append */
+    memset(*cursor, 0, (size_t)Length);
+    *cursor += Length;
+}
+
+/*** Table Generate (Fill With Argument) ***/
+static void helper_tableGenerate(void * const table, const size_t Size, const void * const Argument)
+{
+    /*** Table Generate (Fill With Argument) ***/
+    /* Generate */
+    memset(table, *(const uint8_t *)Argument, Size);
+}
+
+/*** Bitwise Update (Reference) ***/
+static uint64_t helper_bitwiseUpdate(const uint64_t Polynomial, const size_t Width, const bool Reflect, uint64_t crc, const uint8_t * const Data, const size_t DataLength)
+{
+    /*** Bitwise Update (Reference) ***/
+    /* Constant */
+    const uint64_t Mask = (Width == 64) ? 0xFFFFFFFFFFFFFFFF : (((uint64_t)1 << Width) - 1);
+    const uint64_t TopBit = (uint64_t)1 << (Width - 1);
+    const uint64_t ReflectedPolynomial = misc_reflect64(Polynomial) >> (64 - Width);
+
+    /* Update */
+    for(size_t i = 0; i < DataLength; i++)
+    {
+        if(Reflect)
+        {
+            crc ^= Data[i];
+            for(size_t bit = 0; bit < 8; bit++)
+                crc = (crc & 1) ? ((crc >> 1) ^ ReflectedPolynomial) : (crc >> 1);
+        }
+        else
+        {
+            crc ^= (uint64_t)Data[i] << (Width - 8);
+            for(size_t bit = 0; bit < 8; bit++)
+                crc = (crc & TopBit) ? (((crc << 1) ^ Polynomial) & Mask) : ((crc << 1) & Mask);
+        }
+    }
+
+    /* Exit */
+    return crc;
+}
+
+/****************************************************************************************************
+ * Set Up/Tear Down
+ ****************************************************************************************************/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    crc_tierSet(CRC_TIER_AUTOMATIC);
+}
+
+/****************************************************************************************************
+ * Test (Public)
+ ****************************************************************************************************/
+
+/*** Carry-Less Multiplication Initialize ***/
+void test_clmulInit_1(void)
+{
+    /*** Carry-Less Multiplication Initialize (Carry-Less Multiplication NULL) ***/
+    /* Initialize */
+    crc_clmulInit(NULL, 0x04C11DB7, 32, true);
+}
+
+void test_clmulInit_2(void)
+{
+    /*** Carry-Less Multiplication Initialize (Width Invalid) ***/
+    /* Constant */
+    const size_t Width[] = {0, 7, 65};
+
+    /* Variable */
+    crc_clmul_t actualClmul, expectedClmul;
+
+    /* Initialize */
+    for(size_t i = 0; i < (sizeof(Width) / sizeof(Width[0])); i++)
+    {
+        /* Set Up */
+        (void)memset(&actualClmul, 0xA5, sizeof(actualClmul));
+        (void)memset(&expectedClmul, 0xA5, sizeof(expectedClmul));
+
+        /* Initialize */
+        crc_clmulInit(&actualClmul, 0x04C11DB7, Width[i], true);
+
+        /* Verify */
+        TEST_ASSERT_EQUAL_MEMORY(&expectedClmul, &actualClmul, sizeof(actualClmul));
+    }
+}
+
+void test_clmulInit_3(void)
+{
+    /*** Carry-Less Multiplication Initialize (Constants) ***/
+    /* Variable */
+    crc_clmul_t clmul;
+
+    /* Initialize (Normal) */
+    crc_clmulInit(&clmul, 0x04C11DB7, 32, false);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_HEX64(0x04C11DB700000000, clmul.barrett[1]);
+    TEST_ASSERT_FALSE(clmul.reflect);
+    TEST_ASSERT_EQUAL_UINT(32, clmul.shift);
+
+    /* Initialize (Reflected) */
+    crc_clmulInit(&clmul, 0x04C11DB7, 32, true);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_HEX64(0x00000000EDB88320, clmul.barrett[1]);
+    TEST_ASSERT_TRUE(clmul.reflect);
+    TEST_ASSERT_EQUAL_UINT(32, clmul.shift);
+}
+
+/*** Carry-Less Multiplication Update ***/
+void test_clmulUpdate_1(void)
+{
+    /*** Carry-Less Multiplication Update (Carry-Less Multiplication NULL) ***/
+    /* Variable */
+    uint8_t buffer[64] = {0};
+
+    /* Update */
+    TEST_ASSERT_EQUAL_HEX64(0x0123456789ABCDEF, crc_clmulUpdate(NULL, 0x0123456789ABCDEF, buffer, sizeof(buffer)));
+}
+
+void test_clmulUpdate_2(void)
+{
+    /*** Carry-Less Multiplication Update (Data NULL) ***/
+    /* Variable */
+    crc_clmul_t clmul;
+
+    /* Set Up */
+    crc_clmulInit(&clmul, 0x42F0E1EBA9EA3693, 64, false);
+
+    /* Update */
+    TEST_ASSERT_EQUAL_HEX64(0x0123456789ABCDEF, crc_clmulUpdate(&clmul, 0x0123456789ABCDEF, NULL, 64));
+}
+
+void test_clmulUpdate_3(void)
+{
+    /*** Carry-Less Multiplication Update (Data Length Less Than Block Size) ***/
+    /* Variable */
+    uint8_t buffer[CRC_CLMUL_BLOCK_SIZE - 1] = {0};
+    crc_clmul_t clmul;
+
+    /* Set Up */
+    crc_clmulInit(&clmul, 0x42F0E1EBA9EA3693, 64, false);
+
+    /* Update */
+    TEST_ASSERT_EQUAL_HEX64(0x0123456789ABCDEF, crc_clmulUpdate(&clmul, 0x0123456789ABCDEF, buffer, sizeof(buffer)));
+}
+
+void test_clmulUpdate_4(void)
+{
+    /*** Carry-Less Multiplication Update (Loop) ***/
+    /* Type Definition */
+    typedef struct test_polynomial_s
+    {
+        uint64_t polynomial;
+        size_t width;
+    } test_polynomial_t;
+
+    /* Constant */
+    const test_polynomial_t Polynomial[] = {{0x07, 8}, {0x1021, 16}, {0x8005, 16}, {0x04C11DB7, 32}, {0x1EDC6F41, 32}, {0x42F0E1EBA9EA3693, 64}, {0x000000000000001B, 64}};
+
+    /* Variable */
+    uint8_t buffer[512];
+    crc_clmul_t clmul;
+    uint64_t crc, expectedCrc;
+
+    /* Error Check */
+    if(!crc_clmulSupported())
+        TEST_IGNORE_MESSAGE("Carry-Less Multiplication Not Supported");
+
+    /* Update */
+    for(size_t i = 0; i < (sizeof(Polynomial) / sizeof(Polynomial[0])); i++)
+    {
+        for(size_t reflect = 0; reflect < 2; reflect++)
+        {
+            /* Set Up */
+            crc_clmulInit(&clmul, Polynomial[i].polynomial, Polynomial[i].width, (reflect == 1));
+            random_buffer(buffer, sizeof(buffer));
+
+            /* Verify (Whole Blocks Only) */
+            for(size_t j = CRC_CLMUL_BLOCK_SIZE; j <= sizeof(buffer); j += CRC_CLMUL_BLOCK_SIZE)
+            {
+                crc = (((uint64_t)random_U32() << 32) | random_U32()) >> (64 - Polynomial[i].width);
+                expectedCrc = helper_bitwiseUpdate(Polynomial[i].polynomial, Polynomial[i].width, (reflect == 1), crc, buffer, j);
+                TEST_ASSERT_EQUAL_HEX64(expectedCrc, crc_clmulUpdate(&clmul, crc, buffer, j));
+            }
+        }
+    }
+}
+
+/*** Copy ***/
+void test_copy_1(void)
+{
+    /*** Copy (NULL Pointer) ***/
+    /* Variable */
+    uint8_t buffer[4] = {0xA5, 0xA5, 0xA5, 0xA5};
+
+    /* Copy */
+    crc_copy(NULL, buffer, sizeof(buffer), false);
+    crc_copy(buffer, NULL, sizeof(buffer), true);
+
+    /* Verify */
+    TEST_ASSERT_EACH_EQUAL_HEX8(0xA5, buffer, sizeof(buffer));
+}
+
+void test_copy_2(void)
+{
+    /*** Copy (Temporal And Non-Temporal, Unaligned) ***/
+    /* Type Definition */
+    typedef struct testData_s
+    {
+        size_t offset;
+        size_t length;
+        bool nonTemporal;
+    } testData_t;
+
+    /* Variable */
+    uint8_t destination[1100];
+    uint8_t source[1100];
+    const testData_t TestData[] =
+    {
+        {0, 1024, false},
+        {0, 1024, true},
+        {3, 1000, true},
+        {13, 77, true},
+        {7, 255, true},
+        {1, 1099, true},
+    };
+
+    /* Set Up */
+    random_buffer(source, sizeof(source));
+
+    /* Copy */
+    for(size_t i = 0; i < (sizeof(TestData) / sizeof(testData_t)); i++)
+    {
+        memset(destination, 0, sizeof(destination));
+        crc_copy(destination + TestData[i].offset, source, TestData[i].length, TestData[i].nonTemporal);
+        TEST_ASSERT_EQUAL_MEMORY(source, destination + TestData[i].offset, TestData[i].length);
+        if((TestData[i].offset + TestData[i].length) < sizeof(destination))
+            TEST_ASSERT_EQUAL_HEX8(0x00, destination[TestData[i].offset + TestData[i].length]);
+    }
+}
+
+/*** CRC-32C Update ***/
+void test_crc32cUpdate_1(void)
+{
+    /*** CRC-32C Update (Data NULL) ***/
+    /* Update */
+    TEST_ASSERT_EQUAL_HEX32(0x01234567, crc_crc32cUpdate(0x01234567, NULL, 64));
+}
+
+void test_crc32cUpdate_2(void)
+{
+    /*** CRC-32C Update (Data Length 0) ***/
+    /* Variable */
+    uint8_t buffer[1] = {0};
+
+    /* Update */
+    TEST_ASSERT_EQUAL_HEX32(0x01234567, crc_crc32cUpdate(0x01234567, buffer, 0));
+}
+
+void test_crc32cUpdate_3(void)
+{
+    /*** CRC-32C Update (Loop) ***/
+    /* Constant */
+    const size_t DataLength[] = {1, 7, 8, 255, 767, 768, 769, 4096, 24575, 24576, 24576 + 768 + 9, 60000};
+    const size_t DataLengthCount = sizeof(DataLength) / sizeof(DataLength[0]);
+
+    /* Variable */
+    static uint8_t buffer[60000 + 8];
+    uint32_t crc;
+
+    /* Error Check */
+    if(!crc_crc32cSupported())
+        TEST_IGNORE_MESSAGE("CRC-32C Not Supported");
+
+    /* Set Up */
+    random_buffer(buffer, sizeof(buffer));
+
+    /* Update (Unaligned Start Exercises The Alignment Prologue) */
+    for(size_t i = 0; i < DataLengthCount; i++)
+    {
+        crc = random_U32();
+        TEST_ASSERT_EQUAL_HEX32((uint32_t)helper_bitwiseUpdate(CRC_CRC32C_POLYNOMIAL, 32, true, crc, buffer + (i % 8), DataLength[i]), crc_crc32cUpdate(crc, buffer + (i % 8), DataLength[i]));
+    }
+}
+
+/*** Features ***/
+void test_features_1(void)
+{
+    /*** Features ***/
+    /* Verify (Detected Once, Same Answer Every Call) */
+    TEST_ASSERT_EQUAL_HEX32(crc_features(), crc_features());
+    TEST_ASSERT_EQUAL_INT(crc_clmulSupported(), (crc_features() & CRC_FEATURE_CLMUL) == CRC_FEATURE_CLMUL);
+    TEST_ASSERT_EQUAL_INT(crc_crc32cSupported(), (crc_features() & CRC_FEATURE_CRC32C) == CRC_FEATURE_CRC32C);
+}
+
+/*** File Read ***/
+void test_fileRead_1(void)
+{
+    /*** File Read (Invalid) ***/
+    /* Variable */
+    uint8_t buffer[1];
+    uint8_t *cursor = buffer;
+
+    /* Read */
+    TEST_ASSERT_FALSE(crc_fileRead(-1, helper_fileUpdate, &cursor, NULL, NULL, NULL));
+    TEST_ASSERT_FALSE(crc_fileRead(STDIN_FILENO, NULL, &cursor, NULL, NULL, NULL));
+}
+
+void test_fileRead_2(void)
+{
+    /*** File Read (Mapped) ***/
+    /* Variable */
+    static uint8_t data[(2 * CRC_FILE_BLOCK_SIZE) + 100];
+    static uint8_t read[sizeof(data)];
+    uint8_t *cursor = read;
+    int fileDescriptor;
+    char path[] = "/tmp/test_crcXXXXXX";
+    size_t progressCount = 0;
+    crc_fileStatistics_t statistics;
+
+    /* Set Up */
+    random_buffer(data, sizeof(data));
+    fileDescriptor = mkstemp(path);
+    TEST_ASSERT_TRUE(fileDescriptor >= 0);
+    TEST_ASSERT_EQUAL_size_t(sizeof(data), (size_t)write(fileDescriptor, data, sizeof(data)));
+    (void)lseek(fileDescriptor, 0, SEEK_SET);
+    unlink(path);
+
+    /* Read */
+    TEST_ASSERT_TRUE(crc_fileRead(fileDescriptor, helper_fileUpdate, &cursor, helper_fileProgress, &progressCount, &statistics));
+    close(fileDescriptor);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_MEMORY(data, read, sizeof(data));
+    TEST_ASSERT_EQUAL_PTR(read + sizeof(read), cursor);
+    TEST_ASSERT_EQUAL_size_t(3, progressCount);
+    TEST_ASSERT_TRUE(statistics.mapped);
+    TEST_ASSERT_EQUAL_UINT64(sizeof(data), statistics.processed);
+}
+
+void test_fileRead_3(void)
+{
+    /*** File Read (Pipe) ***/
+    /* Variable */
+    void *buffer;
+    uint8_t data[4096];
+    int fileDescriptor[2];
+    uint8_t read[sizeof(data)];
+    uint8_t *cursor = read;
+    crc_fileStatistics_t statistics;
+
+    /* Set Up */
+    buffer = malloc(2 * CRC_FILE_BLOCK_SIZE);
+    memory_malloc_ExpectAndReturn(2 * CRC_FILE_BLOCK_SIZE, buffer);
+    memory_free_ExpectAnyArgs();
+    random_buffer(data, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(0, pipe(fileDescriptor));
+    TEST_ASSERT_EQUAL_size_t(sizeof(data), (size_t)write(fileDescriptor[1], data, sizeof(data)));
+    close(fileDescriptor[1]);
+
+    /* Read */
+    TEST_ASSERT_TRUE(crc_fileRead(fileDescriptor[0], helper_fileUpdate, &cursor, NULL, NULL, &statistics));
+    close(fileDescriptor[0]);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_MEMORY(data, read, sizeof(data));
+    TEST_ASSERT_FALSE(statistics.mapped);
+    TEST_ASSERT_EQUAL_UINT64(sizeof(data), statistics.processed);
+
+    /* Clean Up */
+    free(buffer);
+}
+
+/*** File Read Sparse ***/
+void test_fileReadSparse_1(void)
+{
+    /*** File Read Sparse (Invalid) ***/
+    /* Variable */
+    uint8_t buffer[1];
+    uint8_t *cursor = buffer;
+
+    /* Read */
+    TEST_ASSERT_FALSE(crc_fileReadSparse(-1, helper_fileUpdate, helper_fileZero, &cursor, NULL, NULL, NULL));
+    TEST_ASSERT_FALSE(crc_fileReadSparse(STDIN_FILENO, helper_fileUpdate, NULL, &cursor, NULL, NULL, NULL));
+}
+
+void test_fileReadSparse_2(void)
+{
+    /*** File Read Sparse (Holes Become Zero Callbacks) ***/
+    /* Variable */
+    static uint8_t data[4 * 1024 * 1024];
+    static uint8_t read[sizeof(data)];
+    uint8_t *cursor = read;
+    int fileDescriptor;
+    char path[] = "/tmp/test_crcXXXXXX";
+    crc_fileStatistics_t statistics;
+
+    /* Set Up */
+    memset(data, 0, sizeof(data));
+    random_buffer(data + (1024 * 1024), 4096);
+    memset(read, 0xA5, sizeof(read));
+    fileDescriptor = mkstemp(path);
+    TEST_ASSERT_TRUE(fileDescriptor >= 0);
+    unlink(path);
+    TEST_ASSERT_EQUAL_INT(0, ftruncate(fileDescriptor, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(4096, pwrite(fileDescriptor, data + (1024 * 1024), 4096, 1024 * 1024));
+
+    /* Read */
+    TEST_ASSERT_TRUE(crc_fileReadSparse(fileDescriptor, helper_fileUpdate, helper_fileZero, &cursor, NULL, NULL, &statistics));
+    close(fileDescriptor);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_PTR(read + sizeof(read), cursor);
+    TEST_ASSERT_EQUAL_MEMORY(data, read, sizeof(data));
+    TEST_ASSERT_EQUAL_UINT64(sizeof(data), statistics.processed);
+}
+
+/*** Lookup ***/
+void test_lookup_1(void)
+{
+    /*** Lookup (Not Found) ***/
+    /* Verify */
+    TEST_ASSERT_NULL(crc_lookup(NULL));
+    TEST_ASSERT_NULL(crc_lookup(""));
+    TEST_ASSERT_NULL(crc_lookup("CRC-16/UNKNOWN"));
+    TEST_ASSERT_NULL(crc_lookup("crc-16/modbus"));
+}
+
+void test_lookup_2(void)
+{
+    /*** Lookup (Name And Alias) ***/
+    /* Structure */
+    typedef struct testData_s
+    {
+        const char *Name;
+        const char *ExpectedName;
+        size_t expectedIndex;
+        size_t expectedWidth;
+    } testData_t;
+
+    /* Test Data */
+    const testData_t TestData[] =
+    {
+        {"CRC-8/SMBUS", "CRC-8/SMBUS", 17, 8},
+        {"CRC-16/MODBUS", "CRC-16/MODBUS", 18, 16},
+        {"MODBUS", "MODBUS", 18, 16},
+        {"CRC-16/ARC", "CRC-16/ARC", 0, 16},
+        {"CRC-IBM", "CRC-IBM", 0, 16},
+        {"CRC-32C", "CRC-32C", 6, 32},
+        {"CRC-64/XZ", "CRC-64/XZ", 6, 64}
+    };
+    const size_t TestDataCount = sizeof(TestData) / sizeof(TestData[0]);
+
+    /* Variable */
+    const crc_name_t *name;
+
+    /* Lookup */
+    for(size_t i = 0; i < TestDataCount; i++)
+    {
+        name = crc_lookup(TestData[i].Name);
+        TEST_ASSERT_NOT_NULL(name);
+        TEST_ASSERT_EQUAL_STRING(TestData[i].ExpectedName, name->Name);
+        TEST_ASSERT_EQUAL_size_t(TestData[i].expectedIndex, name->index);
+        TEST_ASSERT_EQUAL_size_t(TestData[i].expectedWidth, name->width);
+    }
+}
+
+/*** Shift ***/
+void test_shift_1(void)
+{
+    /*** Shift (Width Invalid) ***/
+    /* Verify */
+    TEST_ASSERT_EQUAL_HEX64(0x0123, crc_shift(0x0123, 0x1021, 7, 100));
+    TEST_ASSERT_EQUAL_HEX64(0x0123, crc_shift(0x0123, 0x1021, 65, 100));
+}
+
+void test_shift_2(void)
+{
+    /*** Shift (Length 0) ***/
+    /* Verify */
+    TEST_ASSERT_EQUAL_HEX64(0x0123, crc_shift(0x0123, 0x1021, 16, 0));
+}
+
+void test_shift_3(void)
+{
+    /*** Shift (Loop) ***/
+    /* Type Definition */
+    typedef struct test_polynomial_s
+    {
+        uint64_t polynomial;
+        size_t width;
+    } test_polynomial_t;
+
+    /* Constant */
+    const test_polynomial_t Polynomial[] = {{0x07, 8}, {0x1021, 16}, {0x04C11DB7, 32}, {0x42F0E1EBA9EA3693, 64}};
+    const size_t Length[] = {1, 2, 3, 7, 64, 255, 1000};
+
+    /* Variable */
+    static uint8_t zero[1000];
+    uint64_t crc;
+
+    /* Shift */
+    for(size_t i = 0; i < (sizeof(Polynomial) / sizeof(Polynomial[0])); i++)
+    {
+        for(size_t j = 0; j < (sizeof(Length) / sizeof(Length[0])); j++)
+        {
+            /* Set Up */
+            crc = (((uint64_t)random_U32() << 32) | random_U32()) >> (64 - Polynomial[i].width);
+
+            /* Verify (Shifting Equals Feeding Zero Bytes) */
+            TEST_ASSERT_EQUAL_HEX64(helper_bitwiseUpdate(Polynomial[i].polynomial, Polynomial[i].width, false, crc, zero, Length[j]), crc_shift(crc, Polynomial[i].polynomial, Polynomial[i].width, Length[j]));
+        }
+    }
+}
+
+/*** Table Acquire ***/
+void test_tableAcquire_1(void)
+{
+    /*** Table Acquire (NULL Pointer) ***/
+    /* Constant */
+    const uint8_t Fill = 0xA5;
+
+    /* Verify */
+    TEST_ASSERT_NULL(crc_tableAcquire(32, 0x04C11DB7, true, 1024, NULL, &Fill));
+    TEST_ASSERT_NULL(crc_tableAcquire(32, 0x04C11DB7, true, 0, helper_tableGenerate, &Fill));
+}
+
+void test_tableAcquire_2(void)
+{
+    /*** Table Acquire (Memory Allocation Failure) ***/
+    /* Constant */
+    const uint8_t Fill = 0xA5;
+
+    /* Mock */
+    memory_malloc_ExpectAndReturn(1024, NULL);
+
+    /* Verify */
+    TEST_ASSERT_NULL(crc_tableAcquire(32, 0x04C11DB7, true, 1024, helper_tableGenerate, &Fill));
+}
+
+void test_tableAcquire_3(void)
+{
+    /*** Table Acquire (Shared) ***/
+    /* Constant */
+    const uint8_t Fill = 0xA5;
+
+    /* Variable */
+    const uint8_t *first, *second, *third;
+    void *memory, *otherMemory;
+
+    /* Set Up */
+    memory = malloc(2048);
+    otherMemory = malloc(1024);
+
+    /* Mock */
+    memory_malloc_ExpectAndReturn(2048, memory);
+    memory_malloc_ExpectAndReturn(1024, otherMemory);
+    memory_free_ExpectAnyArgs();
+    memory_free_ExpectAnyArgs();
+
+    /* Acquire */
+    first = crc_tableAcquire(32, 0x04C11DB7, true, 2048, helper_tableGenerate, &Fill);
+    second = crc_tableAcquire(32, 0x04C11DB7, true, 1024, helper_tableGenerate, &Fill); // Smaller Request Served By Larger Table
+    third = crc_tableAcquire(32, 0x04C11DB7, false, 1024, helper_tableGenerate, &Fill); // Different Key
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_PTR(memory, first);
+    TEST_ASSERT_EQUAL_PTR(memory, second);
+    TEST_ASSERT_EQUAL_PTR(otherMemory, third);
+    TEST_ASSERT_EACH_EQUAL_HEX8(Fill, first, 2048);
+
+    /* Release (Shared Table Freed On Last Release Only) */
+    crc_tableRelease(first);
+    crc_tableRelease(third);
+    crc_tableRelease(second);
+
+    /* Clean Up */
+    free(memory);
+    free(otherMemory);
+}
+
+/*** Table Release ***/
+void test_tableRelease_1(void)
+{
+    /*** Table Release (NULL Pointer) ***/
+    /* Release */
+    crc_tableRelease(NULL);
+}
+
+void test_tableRelease_2(void)
+{
+    /*** Table Release (Regenerated After Last Release) ***/
+    /* Variable */
+    uint8_t fill;
+    const uint8_t *table;
+    void *memory;
+
+    /* Set Up */
+    memory = malloc(256);
+
+    /* Mock */
+    memory_malloc_ExpectAndReturn(256, memory);
+    memory_free_ExpectAnyArgs();
+    memory_malloc_ExpectAndReturn(256, memory);
+    memory_free_ExpectAnyArgs();
+
+    /* Acquire, Release, Acquire */
+    fill = 0x11;
+    table = crc_tableAcquire(16, 0x1021, false, 256, helper_tableGenerate, &fill);
+    crc_tableRelease(table);
+    fill = 0x22;
+    table = crc_tableAcquire(16, 0x1021, false, 256, helper_tableGenerate, &fill);
+
+    /* Verify */
+    TEST_ASSERT_EACH_EQUAL_HEX8(0x22, table, 256);
+
+    /* Clean Up */
+    crc_tableRelease(table);
+    free(memory);
+}
+
+/*** Tier From Name ***/
+void test_tierFromName_1(void)
+{
+    /*** Tier From Name ***/
+    /* Verify */
+    TEST_ASSERT_EQUAL_INT(CRC_TIER_AUTOMATIC, crc_tierFromName(NULL));
+    TEST_ASSERT_EQUAL_INT(CRC_TIER_AUTOMATIC, crc_tierFromName("unknown"));
+    TEST_ASSERT_EQUAL_INT(CRC_TIER_AUTOMATIC, crc_tierFromName("automatic"));
+    TEST_ASSERT_EQUAL_INT(CRC_TIER_LOOP, crc_tierFromName("loop"));
+    TEST_ASSERT_EQUAL_INT(CRC_TIER_LOOKUP_TABLE, crc_tierFromName("lookup-table"));
+    TEST_ASSERT_EQUAL_INT(CRC_TIER_SLICING, crc_tierFromName("slicing"));
+    TEST_ASSERT_EQUAL_INT(CRC_TIER_CLMUL, crc_tierFromName("clmul"));
+    TEST_ASSERT_EQUAL_INT(CRC_TIER_HARDWARE, crc_tierFromName("hardware"));
+}
+
+/*** Tier Set ***/
+void test_tierSet_1(void)
+{
+    /*** Tier Set ***/
+    /* Set */
+    crc_tierSet(CRC_TIER_CLMUL);
+    TEST_ASSERT_EQUAL_INT(CRC_TIER_CLMUL, crc_tierGet());
+
+    /* Set (Out Of Range Ignored) */
+    crc_tierSet(CRC_TIER_COUNT);
+    TEST_ASSERT_EQUAL_INT(CRC_TIER_CLMUL, crc_tierGet());
+
+    /* Set (Automatic Clears The Override) */
+    crc_tierSet(CRC_TIER_AUTOMATIC);
+    TEST_ASSERT_EQUAL_INT(CRC_TIER_AUTOMATIC, crc_tierGet());
+}
@@ -2,13 +2,16 @@
  * Include
  ****************************************************************************************************/
 
+#include "crc.h"
 #include "crc8.h"
+#include "list.h"
 #include "misc.h"
 #include "mock_memory.h"
 #include "random.h"
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include "unity.h"
 
 /****************************************************************************************************
@@ -27,6 +30,7 @@ void setUp(void)
 
 void tearDown(void)
 {
+    crc_tierSet(CRC_TIER_AUTOMATIC);
 }
 
 /****************************************************************************************************
@@ -90,17 +94,10 @@ void test_calculate_4(void)
     /* Variable */
     crc8_configuration_t configuration;
     uint8_t crc;
-    void *memory;
 
     /* Calculate */
     for(size_t i = 0; i < CrcNameCount; i++)
     {
-        /* Set Up */
-        memory = malloc(CRC8_LOOKUP_TABLE_MEMORY_SIZE);
-
-        /* Mock */
-        memory_malloc_ExpectAndReturn(CRC8_LOOKUP_TABLE_MEMORY_SIZE, memory);
-
         /* Initialize */
         crc8_init(CrcName[i], &configuration, true); // true (Lookup Table)
 
@@ -109,9 +106,44 @@ void test_calculate_4(void)
 
         /* Verify */
         TEST_ASSERT_EQUAL_HEX8(configuration.check, crc);
+    }
+}
+
+void test_calculate_5(void)
+{
+    /*** Calculate (Specialized Kernel) ***/
+    /* Structure */
+    typedef struct testData_s
+    {
+        const char *Name;
+        crc8_kernelCallback_t kernel;
+    } testData_t;
+
+    /* Test Data */
+    const testData_t TestData[] =
+    {
+        {"CRC-8/SMBUS", crc8_smbus_calculate},
+        {"CRC-8/TECH-3250", crc8_tech_3250_calculate}
+    };
+    const size_t TestDataCount = sizeof(TestData) / sizeof(TestData[0]);
+
+    /* Variable */
+    uint8_t buffer[64];
+    crc8_configuration_t configuration;
+
+    /* Calculate */
+    for(size_t i = 0; i < TestDataCount; i++)
+    {
+        /* Set Up */
+        random_buffer(buffer, sizeof(buffer));
+        crc8_init(TestData[i].Name, &configuration, false); // false (Loop)
 
-        /* Clean Up */
-        free(memory);
+        /* Verify */
+        TEST_ASSERT_EQUAL_HEX8(configuration.check, TestData[i].kernel(test_CheckData, sizeof(test_CheckData)));
+        TEST_ASSERT_EQUAL_HEX8(configuration.initial, TestData[i].kernel(test_CheckData, 0));
+        TEST_ASSERT_EQUAL_HEX8(0, TestData[i].kernel(NULL, sizeof(test_CheckData)));
+        for(size_t j = 0; j <= sizeof(buffer); j++)
+            TEST_ASSERT_EQUAL_HEX8(crc8_calculate(&configuration, buffer, j), TestData[i].kernel(buffer, j));
     }
 }
 
@@ -178,14 +210,9 @@ void test_calculateAndAppend_5(void)
     /* Variable */
     uint8_t actualBuffer[sizeof(test_CheckData) + sizeof(uint8_t)];
     crc8_configuration_t configuration;
-    void *memory;
 
     /* Set Up */
     (void)memcpy(actualBuffer, test_CheckData, sizeof(test_CheckData));
-    memory = malloc(CRC8_LOOKUP_TABLE_MEMORY_SIZE);
-
-    /* Mock */
-    memory_malloc_ExpectAndReturn(CRC8_LOOKUP_TABLE_MEMORY_SIZE, memory);
 
     /* Calculate And Append */
     crc8_init("CRC-8/AUTOSAR", &configuration, true); // true (Lookup Table)
@@ -193,9 +220,127 @@ void test_calculateAndAppend_5(void)
 
     /* Verify */
     TEST_ASSERT_EQUAL_HEX8_ARRAY(ExpectedBuffer, actualBuffer, sizeof(ExpectedBuffer));
+}
+
+/*** Calculate File ***/
+void test_calculateFile_1(void)
+{
+    /*** Calculate File (NULL Pointer, Missing File) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    uint8_t crc;
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+
+    /* Calculate */
+    TEST_ASSERT_FALSE(crc8_calculateFile(NULL, "/dev/null", &crc, NULL, NULL, NULL));
+    TEST_ASSERT_FALSE(crc8_calculateFile(&configuration, NULL, &crc, NULL, NULL, NULL));
+    TEST_ASSERT_FALSE(crc8_calculateFile(&configuration, "/dev/null", NULL, NULL, NULL, NULL));
+    TEST_ASSERT_FALSE(crc8_calculateFile(&configuration, "/nonexistent/test_crc8", &crc, NULL, NULL, NULL));
+}
+
+void test_calculateFile_2(void)
+{
+    /*** Calculate File (Mapped) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    uint8_t crc;
+    static uint8_t data[CRC_FILE_BLOCK_SIZE + 1000];
+    int fileDescriptor;
+    char path[] = "/tmp/test_crc8XXXXXX";
+    crc_fileStatistics_t statistics;
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+    random_buffer(data, sizeof(data));
+    fileDescriptor = mkstemp(path);
+    TEST_ASSERT_TRUE(fileDescriptor >= 0);
+    TEST_ASSERT_EQUAL_size_t(sizeof(data), (size_t)write(fileDescriptor, data, sizeof(data)));
+    close(fileDescriptor);
+
+    /* Calculate */
+    TEST_ASSERT_TRUE(crc8_calculateFile(&configuration, path, &crc, NULL, NULL, &statistics));
+    unlink(path);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_HEX8(crc8_calculate(&configuration, data, sizeof(data)), crc);
+    TEST_ASSERT_TRUE(statistics.mapped);
+    TEST_ASSERT_EQUAL_UINT64(sizeof(data), statistics.processed);
+}
+
+/*** Calculate File Descriptor ***/
+void test_calculateFileDescriptor_1(void)
+{
+    /*** Calculate File Descriptor (Pipe) ***/
+    /* Variable */
+    void *buffer;
+    crc8_configuration_t configuration;
+    uint8_t crc;
+    int fileDescriptor[2];
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+    buffer = malloc(2 * CRC_FILE_BLOCK_SIZE);
+    memory_malloc_ExpectAndReturn(2 * CRC_FILE_BLOCK_SIZE, buffer);
+    memory_free_ExpectAnyArgs();
+    TEST_ASSERT_EQUAL_INT(0, pipe(fileDescriptor));
+    TEST_ASSERT_EQUAL_size_t(sizeof(test_CheckData), (size_t)write(fileDescriptor[1], test_CheckData, sizeof(test_CheckData)));
+    close(fileDescriptor[1]);
+
+    /* Calculate */
+    TEST_ASSERT_TRUE(crc8_calculateFileDescriptor(&configuration, fileDescriptor[0], &crc, NULL, NULL, NULL));
+    close(fileDescriptor[0]);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_HEX8(configuration.check, crc);
 
     /* Clean Up */
-    free(memory);
+    free(buffer);
+}
+
+/*** Calculate List ***/
+void test_calculateList_1(void)
+{
+    /*** Calculate List (NULL Pointer) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+
+    /* Calculate */
+    TEST_ASSERT_EQUAL_HEX8(0, crc8_calculateList(NULL, NULL));
+    TEST_ASSERT_EQUAL_HEX8(0, crc8_calculateList(&configuration, NULL));
+}
+
+void test_calculateList_2(void)
+{
+    /*** Calculate List ***/
+    /* Variable */
+    uint8_t buffer[200];
+    crc8_configuration_t configuration;
+    list_list_t list = {NULL, NULL, NULL, NULL, 3};
+    list_node_t node[3];
+    struct iovec segment[3];
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+    random_buffer(buffer, sizeof(buffer));
+    segment[0] = (struct iovec){buffer, 7};
+    segment[1] = (struct iovec){buffer + 7, 0};
+    segment[2] = (struct iovec){buffer + 7, sizeof(buffer) - 7};
+    for(size_t i = 0; i < 3; i++)
+    {
+        node[i].data = &segment[i];
+        node[i].next = (i < 2) ? &node[i + 1] : NULL;
+        node[i].prev = (i > 0) ? &node[i - 1] : NULL;
+    }
+    list.head = &node[0];
+    list.tail = &node[2];
+
+    /* Calculate */
+    TEST_ASSERT_EQUAL_HEX8(crc8_calculate(&configuration, buffer, sizeof(buffer)), crc8_calculateList(&configuration, &list));
 }
 
 /*** Calculate Partial ***/
@@ -249,17 +394,10 @@ void test_calculatePartial_3(void)
     /* Variable */
     crc8_configuration_t configuration;
     uint8_t crc;
-    void *memory;
 
     /* Calculate Partial */
     for(size_t i = 0; i < CrcNameCount; i++)
     {
-        /* Set Up */
-        memory = malloc(CRC8_LOOKUP_TABLE_MEMORY_SIZE);
-
-        /* Mock */
-        memory_malloc_ExpectAndReturn(CRC8_LOOKUP_TABLE_MEMORY_SIZE, memory);
-
         /* Initialize (Lookup Table) */
         crc8_init(CrcName[i], &configuration, true); // true (Lookup Table)
 
@@ -270,12 +408,258 @@ void test_calculatePartial_3(void)
 
         /* Verify */
         TEST_ASSERT_EQUAL_HEX8(configuration.check, crc);
+    }
+}
+
+/*** Calculate Vector ***/
+void test_calculateV_1(void)
+{
+    /*** Calculate Vector (NULL Pointer) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    struct iovec segment[1] = {{(void *)test_CheckData, sizeof(test_CheckData)}};
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+
+    /* Calculate */
+    TEST_ASSERT_EQUAL_HEX8(0, crc8_calculateV(NULL, segment, 1));
+    TEST_ASSERT_EQUAL_HEX8(0, crc8_calculateV(&configuration, NULL, 1));
+}
+
+void test_calculateV_2(void)
+{
+    /*** Calculate Vector ***/
+    /* Variable */
+    uint8_t buffer[200];
+    crc8_configuration_t configuration;
+    struct iovec segment[4];
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+    random_buffer(buffer, sizeof(buffer));
+    segment[0] = (struct iovec){buffer, 7};
+    segment[1] = (struct iovec){buffer + 7, 0};
+    segment[2] = (struct iovec){buffer + 7, 143};
+    segment[3] = (struct iovec){buffer + 150, 50};
+
+    /* Calculate */
+    TEST_ASSERT_EQUAL_HEX8(crc8_calculate(&configuration, buffer, sizeof(buffer)), crc8_calculateV(&configuration, segment, 4));
+    TEST_ASSERT_EQUAL_HEX8(configuration.check, crc8_calculateV(&configuration, (struct iovec[2]){{(void *)test_CheckData, 4}, {(void *)(test_CheckData + 4), 5}}, 2));
+}
+
+/*** Context Final ***/
+void test_contextFinal_1(void)
+{
+    /*** Context Final (Context NULL) ***/
+    /* Verify */
+    TEST_ASSERT_EQUAL_HEX8(0, crc8_contextFinal(NULL));
+}
+
+void test_contextFinal_2(void)
+{
+    /*** Context Final (No Update) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    crc8_context_t context;
+
+    /* Initialize */
+    crc8_init("CRC-8/AUTOSAR", &configuration, false); // false (Loop)
+    crc8_contextInit(&context, &configuration);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_HEX8(configuration.initial, crc8_contextFinal(&context));
+    TEST_ASSERT_EQUAL_HEX8(crc8_calculate(&configuration, test_CheckData, 0), crc8_contextFinal(&context));
+}
 
-        /* Clean Up */
-        free(memory);
+/*** Context Initialize ***/
+void test_contextInit_1(void)
+{
+    /*** Context Initialize (Context NULL) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+
+    /* Initialize */
+    crc8_init("CRC-8/AUTOSAR", &configuration, false); // false (Loop)
+    crc8_contextInit(NULL, &configuration);
+}
+
+void test_contextInit_2(void)
+{
+    /*** Context Initialize (Configuration NULL) ***/
+    /* Variable */
+    crc8_context_t actualContext, expectedContext;
+
+    /* Set Up */
+    (void)memset(&actualContext, 0xA5, sizeof(actualContext));
+    (void)memset(&expectedContext, 0xA5, sizeof(expectedContext));
+
+    /* Initialize */
+    crc8_contextInit(&actualContext, NULL);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_MEMORY(&expectedContext, &actualContext, sizeof(actualContext));
+}
+
+/*** Context Update ***/
+void test_contextUpdate_1(void)
+{
+    /*** Context Update (Data NULL) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    crc8_context_t context;
+
+    /* Initialize */
+    crc8_init("CRC-8/AUTOSAR", &configuration, false); // false (Loop)
+    crc8_contextInit(&context, &configuration);
+
+    /* Update */
+    crc8_contextUpdate(NULL, test_CheckData, sizeof(test_CheckData));
+    crc8_contextUpdate(&context, NULL, sizeof(test_CheckData));
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_UINT64(0, context.length);
+    TEST_ASSERT_EQUAL_HEX8(configuration.initial, crc8_contextFinal(&context));
+}
+
+void test_contextUpdate_2(void)
+{
+    /*** Context Update (Loop) ***/
+    /* Constant */
+    const char *CrcName[] = {"CRC-8", "CRC-8/AES", "CRC-8/AUTOSAR", "CRC-8/BLUETOOTH", "CRC-8/CDMA2000", "CRC-8/DARC", "CRC-8/DVB-S2", "CRC-8/EBU", "CRC-8/GSM-A", "CRC-8/GSM-B", "CRC-8/HITAG", "CRC-8/I-432-1", "CRC-8/I-CODE", "CRC-8/ITU", "CRC-8/LTE", "CRC-8/MAXIM", "CRC-8/MAXIM-DOW", "CRC-8/MIFARE-MAD", "CRC-8/NRSC-5", "CRC-8/OPENSAFETY", "CRC-8/ROHC", "CRC-8/SAE-J1850", "CRC-8/SMBUS", "CRC-8/TECH-3250", "CRC-8/WCDMA", "DOW-CRC"};
+    const size_t CrcNameCount = sizeof(CrcName) / sizeof(CrcName[0]);
+
+    /* Variable */
+    uint8_t buffer[256];
+    size_t chunkLength;
+    crc8_configuration_t configuration;
+    crc8_context_t context;
+
+    /* Update */
+    for(size_t i = 0; i < CrcNameCount; i++)
+    {
+        /* Set Up */
+        random_buffer(buffer, sizeof(buffer));
+
+        /* Initialize */
+        crc8_init(CrcName[i], &configuration, false); // false (Loop)
+        crc8_contextInit(&context, &configuration);
+
+        /* Update (Chunks Of Random Length) */
+        for(size_t j = 0; j < sizeof(buffer); j += chunkLength)
+        {
+            chunkLength = random_U32WithinRange(0, 32);
+            if(chunkLength > (sizeof(buffer) - j))
+                chunkLength = sizeof(buffer) - j;
+            crc8_contextUpdate(&context, buffer + j, chunkLength);
+        }
+
+        /* Verify */
+        TEST_ASSERT_EQUAL_UINT64(sizeof(buffer), context.length);
+        TEST_ASSERT_EQUAL_HEX8(crc8_calculate(&configuration, buffer, sizeof(buffer)), crc8_contextFinal(&context));
+    }
+}
+
+void test_contextUpdate_3(void)
+{
+    /*** Context Update (Lookup Table) ***/
+    /* Constant */
+    const char *CrcName[] = {"CRC-8", "CRC-8/AES", "CRC-8/AUTOSAR", "CRC-8/BLUETOOTH", "CRC-8/CDMA2000", "CRC-8/DARC", "CRC-8/DVB-S2", "CRC-8/EBU", "CRC-8/GSM-A", "CRC-8/GSM-B", "CRC-8/HITAG", "CRC-8/I-432-1", "CRC-8/I-CODE", "CRC-8/ITU", "CRC-8/LTE", "CRC-8/MAXIM", "CRC-8/MAXIM-DOW", "CRC-8/MIFARE-MAD", "CRC-8/NRSC-5", "CRC-8/OPENSAFETY", "CRC-8/ROHC", "CRC-8/SAE-J1850", "CRC-8/SMBUS", "CRC-8/TECH-3250", "CRC-8/WCDMA", "DOW-CRC"};
+    const size_t CrcNameCount = sizeof(CrcName) / sizeof(CrcName[0]);
+
+    /* Variable */
+    uint8_t buffer[256];
+    size_t chunkLength;
+    crc8_configuration_t configuration;
+    crc8_context_t context;
+
+    /* Update */
+    for(size_t i = 0; i < CrcNameCount; i++)
+    {
+        /* Set Up */
+        random_buffer(buffer, sizeof(buffer));
+
+        /* Initialize */
+        crc8_init(CrcName[i], &configuration, true); // true (Lookup Table)
+        crc8_contextInit(&context, &configuration);
+
+        /* Update (Chunks Of Random Length) */
+        for(size_t j = 0; j < sizeof(buffer); j += chunkLength)
+        {
+            chunkLength = random_U32WithinRange(0, 32);
+            if(chunkLength > (sizeof(buffer) - j))
+                chunkLength = sizeof(buffer) - j;
+            crc8_contextUpdate(&context, buffer + j, chunkLength);
+        }
+
+        /* Verify */
+        TEST_ASSERT_EQUAL_UINT64(sizeof(buffer), context.length);
+        TEST_ASSERT_EQUAL_HEX8(crc8_calculate(&configuration, buffer, sizeof(buffer)), crc8_contextFinal(&context));
     }
 }
 
+/*** Copy And Calculate ***/
+void test_copyAndCalculate_1(void)
+{
+    /*** Copy And Calculate (NULL Pointer) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    uint8_t destination[sizeof(test_CheckData)];
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+
+    /* Copy And Calculate */
+    TEST_ASSERT_EQUAL_HEX8(0, crc8_copyAndCalculate(NULL, destination, test_CheckData, sizeof(test_CheckData), false));
+    TEST_ASSERT_EQUAL_HEX8(0, crc8_copyAndCalculate(&configuration, NULL, test_CheckData, sizeof(test_CheckData), false));
+    TEST_ASSERT_EQUAL_HEX8(0, crc8_copyAndCalculate(&configuration, destination, NULL, sizeof(test_CheckData), false));
+}
+
+void test_copyAndCalculate_2(void)
+{
+    /*** Copy And Calculate ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    uint8_t destination[10000];
+    uint8_t source[10000];
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+    random_buffer(source, sizeof(source));
+
+    /* Copy And Calculate (Spans Several Copy Blocks) */
+    for(size_t i = 0; i < 2; i++)
+    {
+        memset(destination, 0, sizeof(destination));
+        TEST_ASSERT_EQUAL_HEX8(crc8_calculate(&configuration, source, sizeof(source)), crc8_copyAndCalculate(&configuration, destination, source, sizeof(source), i == 1));
+        TEST_ASSERT_EQUAL_MEMORY(source, destination, sizeof(source));
+    }
+    TEST_ASSERT_EQUAL_HEX8(configuration.check, crc8_copyAndCalculate(&configuration, destination, test_CheckData, sizeof(test_CheckData), true));
+}
+
+/*** Copy And Calculate And Append ***/
+void test_copyAndCalculateAndAppend_1(void)
+{
+    /*** Copy And Calculate And Append ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    uint8_t destination[1000 + sizeof(uint8_t)];
+    uint8_t expected[1000 + sizeof(uint8_t)];
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+    random_buffer(expected, sizeof(expected) - sizeof(uint8_t));
+    crc8_calculateAndAppend(&configuration, expected, sizeof(expected), sizeof(expected) - sizeof(uint8_t));
+
+    /* Copy, Calculate, And Append */
+    crc8_copyAndCalculateAndAppend(&configuration, destination, sizeof(destination) - 1, expected, sizeof(expected) - sizeof(uint8_t), true); // Too Short
+    crc8_copyAndCalculateAndAppend(&configuration, destination, sizeof(destination), expected, sizeof(expected) - sizeof(uint8_t), true);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_MEMORY(expected, destination, sizeof(expected));
+    TEST_ASSERT_TRUE(crc8_verify(&configuration, destination, sizeof(destination)));
+}
+
 /*** Deinitialize ***/
 void test_deinit_1(void)
 {
@@ -290,9 +674,6 @@ void test_deinit_2(void)
     /* Variable */
     crc8_configuration_t configuration;
 
-    /* Mock */
-    memory_free_Expect((void **)&configuration.lookupTable);
-
     /* Set Up */
     crc8_init("CRC-8/AUTOSAR", &configuration, false); // false (Loop)
 
@@ -315,14 +696,6 @@ void test_deinit_3(void)
     /*** Deinitialize (Lookup Table) ***/
     /* Variable */
     crc8_configuration_t configuration;
-    void *memory;
-
-    /* Set Up */
-    memory = malloc(CRC8_LOOKUP_TABLE_MEMORY_SIZE);
-
-    /* Mock */
-    memory_malloc_ExpectAndReturn(CRC8_LOOKUP_TABLE_MEMORY_SIZE, memory);
-    memory_free_Expect((void **)&configuration.lookupTable);
 
     /* Set Up */
     crc8_init("CRC-8/AUTOSAR", &configuration, true); // true (Lookup Table)
@@ -339,9 +712,66 @@ void test_deinit_3(void)
     TEST_ASSERT_EQUAL_INT(false, configuration.reflectOut);
     TEST_ASSERT_EQUAL_INT(false, configuration.residue);
     TEST_ASSERT_EQUAL_HEX8(0x00, configuration.xorOut);
+}
 
-    /* Clean Up */
-    free(memory);
+/*** Fork ***/
+void test_fork_1(void)
+{
+    /*** Fork (NULL Pointer) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    crc8_context_t snapshot;
+
+    /* Set Up */
+    crc8_init("CRC-8/AUTOSAR", &configuration, true);
+    crc8_snapshot(&configuration, test_CheckData, sizeof(test_CheckData), &snapshot);
+
+    /* Fork */
+    TEST_ASSERT_EQUAL_HEX8(0, crc8_fork(NULL, test_CheckData, sizeof(test_CheckData)));
+    TEST_ASSERT_EQUAL_HEX8(0, crc8_fork(&snapshot, NULL, sizeof(test_CheckData)));
+}
+
+void test_fork_2(void)
+{
+    /*** Fork (Shared Prefix, Many Frames) ***/
+    /* Type Definition */
+    typedef struct testData_s
+    {
+        const char *Name;
+        bool engine;
+    } testData_t;
+
+    /* Variable */
+    crc8_configuration_t configuration;
+    uint8_t frame[64 + 200];
+    const size_t FrameLength[] = {0, 1, 7, 64, 200};
+    const size_t PrefixLength = 64;
+    crc8_context_t snapshot;
+    crc8_context_t snapshotCopy;
+    const testData_t TestData[] =
+    {
+        {"CRC-8/AUTOSAR", false},
+        {"CRC-8/AUTOSAR", true},
+        {"CRC-8/SMBUS", false},
+        {"CRC-8/SMBUS", true},
+        {"CRC-8/BLUETOOTH", false},
+        {"CRC-8/BLUETOOTH", true},
+    };
+
+    /* Fork */
+    for(size_t i = 0; i < (sizeof(TestData) / sizeof(testData_t)); i++)
+    {
+        crc8_init(TestData[i].Name, &configuration, TestData[i].engine);
+        random_buffer(frame, sizeof(frame));
+        crc8_snapshot(&configuration, frame, PrefixLength, &snapshot);
+        snapshotCopy = snapshot;
+        for(size_t j = 0; j < (sizeof(FrameLength) / sizeof(FrameLength[0])); j++)
+        {
+            random_buffer(frame + PrefixLength, FrameLength[j]);
+            TEST_ASSERT_EQUAL_HEX8(crc8_calculate(&configuration, frame, PrefixLength + FrameLength[j]), crc8_fork(&snapshot, frame + PrefixLength, FrameLength[j]));
+        }
+        TEST_ASSERT_EQUAL_MEMORY(&snapshotCopy, &snapshot, sizeof(snapshot)); // Snapshot Untouched
+    }
 }
 
 /*** Initialize ***/
@@ -374,32 +804,24 @@ void test_init_3(void)
 
 void test_init_4(void)
 {
-    /*** Initialize (Memory Allocation Failure) ***/
-    /* Constant */
-    const crc8_configuration_t ExpectedConfiguration = {{}, 0, 0xDF, 0xFF, NULL, "CRC-8/AUTOSAR", 0x2F, false, false, 0x42, 0xFF};
-
+    /*** Initialize (Lookup Table Read Only) ***/
     /* Variable */
-    crc8_configuration_t actualConfiguration;
+    crc8_configuration_t firstConfiguration, secondConfiguration;
 
-    /* Mock */
-    memory_malloc_ExpectAndReturn(CRC8_LOOKUP_TABLE_MEMORY_SIZE, NULL);
+    /* Initialize (No Memory Allocation) */
+    crc8_init("CRC-8/AUTOSAR", &firstConfiguration, true); // true (Lookup Table)
+    crc8_init("CRC-8/AUTOSAR", &secondConfiguration, true); // true (Lookup Table)
 
-    /* Initialize */
-    crc8_init("CRC-8/AUTOSAR", &actualConfiguration, true); // true (Lookup Table)
+    /* Verify (Shared) */
+    TEST_ASSERT_NOT_NULL(firstConfiguration.lookupTable);
+    TEST_ASSERT_EQUAL_PTR(firstConfiguration.lookupTable, secondConfiguration.lookupTable);
+
+    /* Deinitialize (No Memory Free) */
+    crc8_deinit(&firstConfiguration);
 
     /* Verify */
-    TEST_ASSERT_EQUAL_UINT(ExpectedConfiguration.aliasCount, actualConfiguration.aliasCount);
-    for(size_t j = 0; j < ExpectedConfiguration.aliasCount; j++)
-        TEST_ASSERT_EQUAL_STRING(ExpectedConfiguration.Alias[j], actualConfiguration.Alias[j]);
-    TEST_ASSERT_EQUAL_HEX8(ExpectedConfiguration.check, actualConfiguration.check);
-    TEST_ASSERT_EQUAL_HEX8(ExpectedConfiguration.initial, actualConfiguration.initial);
-    TEST_ASSERT_NULL(actualConfiguration.lookupTable);
-    TEST_ASSERT_EQUAL_STRING(ExpectedConfiguration.Name, actualConfiguration.Name);
-    TEST_ASSERT_EQUAL_HEX8(ExpectedConfiguration.polynomial, actualConfiguration.polynomial);
-    TEST_ASSERT_EQUAL_INT(ExpectedConfiguration.reflectIn, actualConfiguration.reflectIn);
-    TEST_ASSERT_EQUAL_INT(ExpectedConfiguration.reflectOut, actualConfiguration.reflectOut);
-    TEST_ASSERT_EQUAL_HEX8(ExpectedConfiguration.residue, actualConfiguration.residue);
-    TEST_ASSERT_EQUAL_HEX8(ExpectedConfiguration.xorOut, actualConfiguration.xorOut);
+    TEST_ASSERT_NULL(firstConfiguration.lookupTable);
+    TEST_ASSERT_EQUAL_HEX8(secondConfiguration.check, crc8_calculate(&secondConfiguration, test_CheckData, sizeof(test_CheckData)));
 }
 
 void test_init_5(void)
@@ -415,32 +837,32 @@ void test_init_5(void)
     /* Test Data */
     const testData_t TestData[] =
     {
-        {"CRC-8", {{"CRC-8"}, 1, 0xF4, 0x00, NULL, "CRC-8/SMBUS", 0x07, false, false, 0x00, 0x00}},
-        {"CRC-8/AES", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, NULL, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
-        {"CRC-8/AUTOSAR", {{}, 0, 0xDF, 0xFF, NULL, "CRC-8/AUTOSAR", 0x2F, false, false, 0x42, 0xFF}},
-        {"CRC-8/BLUETOOTH", {{}, 0, 0x26, 0x00, NULL, "CRC-8/BLUETOOTH", 0xA7, true, true, 0x00, 0x00}},
-        {"CRC-8/CDMA2000", {{}, 0, 0xDA, 0xFF, NULL, "CRC-8/CDMA2000", 0x9B, false, false, 0x00, 0x00}},
-        {"CRC-8/DARC", {{}, 0, 0x15, 0x00, NULL, "CRC-8/DARC", 0x39, true, true, 0x00, 0x00}},
-        {"CRC-8/DVB-S2", {{}, 0, 0xBC, 0x00, NULL, "CRC-8/DVB-S2", 0xD5, false, false, 0x00, 0x00}},
-        {"CRC-8/EBU", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, NULL, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
-        {"CRC-8/GSM-A", {{}, 0, 0x37, 0x00, NULL, "CRC-8/GSM-A", 0x1D, false, false, 0x00, 0x00}},
-        {"CRC-8/GSM-B", {{}, 0, 0x94, 0x00, NULL, "CRC-8/GSM-B", 0x49, false, false, 0x53, 0xFF}},
-        {"CRC-8/HITAG", {{}, 0, 0xB4, 0xFF, NULL, "CRC-8/HITAG", 0x1D, false, false, 0x00, 0x00}},
-        {"CRC-8/I-432-1", {{"CRC-8/ITU"}, 1, 0xA1, 0x00, NULL, "CRC-8/I-432-1", 0x07, false, false, 0xAC, 0x55}},
-        {"CRC-8/I-CODE", {{}, 0, 0x7E, 0xFD, NULL, "CRC-8/I-CODE", 0x1D, false, false, 0x00, 0x00}},
-        {"CRC-8/ITU", {{"CRC-8/ITU"}, 1, 0xA1, 0x00, NULL, "CRC-8/I-432-1", 0x07, false, false, 0xAC, 0x55}},
-        {"CRC-8/LTE", {{}, 0, 0xEA, 0x00, NULL, "CRC-8/LTE", 0x9B, false, false, 0x00, 0x00}},
-        {"CRC-8/MAXIM", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, NULL, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}},
-        {"CRC-8/MAXIM-DOW", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, NULL, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}},
-        {"CRC-8/MIFARE-MAD", {{}, 0, 0x99, 0xC7, NULL, "CRC-8/MIFARE-MAD", 0x1D, false, false, 0x00, 0x00}},
-        {"CRC-8/NRSC-5", {{}, 0, 0xF7, 0xFF, NULL, "CRC-8/NRSC-5", 0x31, false, false, 0x00, 0x00}},
-        {"CRC-8/OPENSAFETY", {{}, 0, 0x3E, 0x00, NULL, "CRC-8/OPENSAFETY", 0x2F, false, false, 0x00, 0x00}},
-        {"CRC-8/ROHC", {{}, 0, 0xD0, 0xFF, NULL, "CRC-8/ROHC", 0x07, true, true, 0x00, 0x00}},
-        {"CRC-8/SAE-J1850", {{}, 0, 0x4B, 0xFF, NULL, "CRC-8/SAE-J1850", 0x1D, false, false, 0xC4, 0xFF}},
-        {"CRC-8/SMBUS", {{"CRC-8"}, 1, 0xF4, 0x00, NULL, "CRC-8/SMBUS", 0x07, false, false, 0x00, 0x00}},
-        {"CRC-8/TECH-3250", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, NULL, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
-        {"CRC-8/WCDMA", {{}, 0, 0x25, 0x00, NULL, "CRC-8/WCDMA", 0x9B, true, true, 0x00, 0x00}},
-        {"DOW-CRC", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, NULL, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}}
+        {"CRC-8", {{"CRC-8"}, 1, 0xF4, 0x00, NULL, NULL, "CRC-8/SMBUS", 0x07, false, false, 0x00, 0x00}},
+        {"CRC-8/AES", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, NULL, NULL, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
+        {"CRC-8/AUTOSAR", {{}, 0, 0xDF, 0xFF, NULL, NULL, "CRC-8/AUTOSAR", 0x2F, false, false, 0x42, 0xFF}},
+        {"CRC-8/BLUETOOTH", {{}, 0, 0x26, 0x00, NULL, NULL, "CRC-8/BLUETOOTH", 0xA7, true, true, 0x00, 0x00}},
+        {"CRC-8/CDMA2000", {{}, 0, 0xDA, 0xFF, NULL, NULL, "CRC-8/CDMA2000", 0x9B, false, false, 0x00, 0x00}},
+        {"CRC-8/DARC", {{}, 0, 0x15, 0x00, NULL, NULL, "CRC-8/DARC", 0x39, true, true, 0x00, 0x00}},
+        {"CRC-8/DVB-S2", {{}, 0, 0xBC, 0x00, NULL, NULL, "CRC-8/DVB-S2", 0xD5, false, false, 0x00, 0x00}},
+        {"CRC-8/EBU", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, NULL, NULL, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
+        {"CRC-8/GSM-A", {{}, 0, 0x37, 0x00, NULL, NULL, "CRC-8/GSM-A", 0x1D, false, false, 0x00, 0x00}},
+        {"CRC-8/GSM-B", {{}, 0, 0x94, 0x00, NULL, NULL, "CRC-8/GSM-B", 0x49, false, false, 0x53, 0xFF}},
+        {"CRC-8/HITAG", {{}, 0, 0xB4, 0xFF, NULL, NULL, "CRC-8/HITAG", 0x1D, false, false, 0x00, 0x00}},
+        {"CRC-8/I-432-1", {{"CRC-8/ITU"}, 1, 0xA1, 0x00, NULL, NULL, "CRC-8/I-432-1", 0x07, false, false, 0xAC, 0x55}},
+        {"CRC-8/I-CODE", {{}, 0, 0x7E, 0xFD, NULL, NULL, "CRC-8/I-CODE", 0x1D, false, false, 0x00, 0x00}},
+        {"CRC-8/ITU", {{"CRC-8/ITU"}, 1, 0xA1, 0x00, NULL, NULL, "CRC-8/I-432-1", 0x07, false, false, 0xAC, 0x55}},
+        {"CRC-8/LTE", {{}, 0, 0xEA, 0x00, NULL, NULL, "CRC-8/LTE", 0x9B, false, false, 0x00, 0x00}},
+        {"CRC-8/MAXIM", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, NULL, NULL, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}},
+        {"CRC-8/MAXIM-DOW", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, NULL, NULL, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}},
+        {"CRC-8/MIFARE-MAD", {{}, 0, 0x99, 0xC7, NULL, NULL, "CRC-8/MIFARE-MAD", 0x1D, false, false, 0x00, 0x00}},
+        {"CRC-8/NRSC-5", {{}, 0, 0xF7, 0xFF, NULL, NULL, "CRC-8/NRSC-5", 0x31, false, false, 0x00, 0x00}},
+        {"CRC-8/OPENSAFETY", {{}, 0, 0x3E, 0x00, NULL, NULL, "CRC-8/OPENSAFETY", 0x2F, false, false, 0x00, 0x00}},
+        {"CRC-8/ROHC", {{}, 0, 0xD0, 0xFF, NULL, NULL, "CRC-8/ROHC", 0x07, true, true, 0x00, 0x00}},
+        {"CRC-8/SAE-J1850", {{}, 0, 0x4B, 0xFF, NULL, NULL, "CRC-8/SAE-J1850", 0x1D, false, false, 0xC4, 0xFF}},
+        {"CRC-8/SMBUS", {{"CRC-8"}, 1, 0xF4, 0x00, NULL, NULL, "CRC-8/SMBUS", 0x07, false, false, 0x00, 0x00}},
+        {"CRC-8/TECH-3250", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, NULL, NULL, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
+        {"CRC-8/WCDMA", {{}, 0, 0x25, 0x00, NULL, NULL, "CRC-8/WCDMA", 0x9B, true, true, 0x00, 0x00}},
+        {"DOW-CRC", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, NULL, NULL, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}}
     };
     const size_t TestDataCount = sizeof(TestData) / sizeof(TestData[0]);
 
@@ -482,48 +904,41 @@ void test_init_6(void)
     /* Test Data */
     const testData_t TestData[] =
     {
-        {"CRC-8", {{"CRC-8"}, 1, 0xF4, 0x00, (uint8_t []){0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD, 0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A, 0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4, 0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34, 0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83, 0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3}, "CRC-8/SMBUS", 0x07, false, false, 0x00, 0x00}},
-        {"CRC-8/AES", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, (uint8_t []){0x00, 0x64, 0xC8, 0xAC, 0xE1, 0x85, 0x29, 0x4D, 0xB3, 0xD7, 0x7B, 0x1F, 0x52, 0x36, 0x9A, 0xFE, 0x17, 0x73, 0xDF, 0xBB, 0xF6, 0x92, 0x3E, 0x5A, 0xA4, 0xC0, 0x6C, 0x08, 0x45, 0x21, 0x8D, 0xE9, 0x2E, 0x4A, 0xE6, 0x82, 0xCF, 0xAB, 0x07, 0x63, 0x9D, 0xF9, 0x55, 0x31, 0x7C, 0x18, 0xB4, 0xD0, 0x39, 0x5D, 0xF1, 0x95, 0xD8, 0xBC, 0x10, 0x74, 0x8A, 0xEE, 0x42, 0x26, 0x6B, 0x0F, 0xA3, 0xC7, 0x5C, 0x38, 0x94, 0xF0, 0xBD, 0xD9, 0x75, 0x11, 0xEF, 0x8B, 0x27, 0x43, 0x0E, 0x6A, 0xC6, 0xA2, 0x4B, 0x2F, 0x83, 0xE7, 0xAA, 0xCE, 0x62, 0x06, 0xF8, 0x9C, 0x30, 0x54, 0x19, 0x7D, 0xD1, 0xB5, 0x72, 0x16, 0xBA, 0xDE, 0x93, 0xF7, 0x5B, 0x3F, 0xC1, 0xA5, 0x09, 0x6D, 0x20, 0x44, 0xE8, 0x8C, 0x65, 0x01, 0xAD, 0xC9, 0x84, 0xE0, 0x4C, 0x28, 0xD6, 0xB2, 0x1E, 0x7A, 0x37, 0x53, 0xFF, 0x9B, 0xB8, 0xDC, 0x70, 0x14, 0x59, 0x3D, 0x91, 0xF5, 0x0B, 0x6F, 0xC3, 0xA7, 0xEA, 0x8E, 0x22, 0x46, 0xAF, 0xCB, 0x67, 0x03, 0x4E, 0x2A, 0x86, 0xE2, 0x1C, 0x78, 0xD4, 0xB0, 0xFD, 0x99, 0x35, 0x51, 0x96, 0xF2, 0x5E, 0x3A, 0x77, 0x13, 0xBF, 0xDB, 0x25, 0x41, 0xED, 0x89, 0xC4, 0xA0, 0x0C, 0x68, 0x81, 0xE5, 0x49, 0x2D, 0x60, 0x04, 0xA8, 0xCC, 0x32, 0x56, 0xFA, 0x9E, 0xD3, 0xB7, 0x1B, 0x7F, 0xE4, 0x80, 0x2C, 0x48, 0x05, 0x61, 0xCD, 0xA9, 0x57, 0x33, 0x9F, 0xFB, 0xB6, 0xD2, 0x7E, 0x1A, 0xF3, 0x97, 0x3B, 0x5F, 0x12, 0x76, 0xDA, 0xBE, 0x40, 0x24, 0x88, 0xEC, 0xA1, 0xC5, 0x69, 0x0D, 0xCA, 0xAE, 0x02, 0x66, 0x2B, 0x4F, 0xE3, 0x87, 0x79, 0x1D, 0xB1, 0xD5, 0x98, 0xFC, 0x50, 0x34, 0xDD, 0xB9, 0x15, 0x71, 0x3C, 0x58, 0xF4, 0x90, 0x6E, 0x0A, 0xA6, 0xC2, 0x8F, 0xEB, 0x47, 0x23}, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
-        {"CRC-8/AUTOSAR", {{}, 0, 0xDF, 0xFF, (uint8_t []){0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD, 0x57, 0x78, 0x09, 0x26, 0xEB, 0xC4, 0xB5, 0x9A, 0xAE, 0x81, 0xF0, 0xDF, 0x12, 0x3D, 0x4C, 0x63, 0xF9, 0xD6, 0xA7, 0x88, 0x45, 0x6A, 0x1B, 0x34, 0x73, 0x5C, 0x2D, 0x02, 0xCF, 0xE0, 0x91, 0xBE, 0x24, 0x0B, 0x7A, 0x55, 0x98, 0xB7, 0xC6, 0xE9, 0xDD, 0xF2, 0x83, 0xAC, 0x61, 0x4E, 0x3F, 0x10, 0x8A, 0xA5, 0xD4, 0xFB, 0x36, 0x19, 0x68, 0x47, 0xE6, 0xC9, 0xB8, 0x97, 0x5A, 0x75, 0x04, 0x2B, 0xB1, 0x9E, 0xEF, 0xC0, 0x0D, 0x22, 0x53, 0x7C, 0x48, 0x67, 0x16, 0x39, 0xF4, 0xDB, 0xAA, 0x85, 0x1F, 0x30, 0x41, 0x6E, 0xA3, 0x8C, 0xFD, 0xD2, 0x95, 0xBA, 0xCB, 0xE4, 0x29, 0x06, 0x77, 0x58, 0xC2, 0xED, 0x9C, 0xB3, 0x7E, 0x51, 0x20, 0x0F, 0x3B, 0x14, 0x65, 0x4A, 0x87, 0xA8, 0xD9, 0xF6, 0x6C, 0x43, 0x32, 0x1D, 0xD0, 0xFF, 0x8E, 0xA1, 0xE3, 0xCC, 0xBD, 0x92, 0x5F, 0x70, 0x01, 0x2E, 0xB4, 0x9B, 0xEA, 0xC5, 0x08, 0x27, 0x56, 0x79, 0x4D, 0x62, 0x13, 0x3C, 0xF1, 0xDE, 0xAF, 0x80, 0x1A, 0x35, 0x44, 0x6B, 0xA6, 0x89, 0xF8, 0xD7, 0x90, 0xBF, 0xCE, 0xE1, 0x2C, 0x03, 0x72, 0x5D, 0xC7, 0xE8, 0x99, 0xB6, 0x7B, 0x54, 0x25, 0x0A, 0x3E, 0x11, 0x60, 0x4F, 0x82, 0xAD, 0xDC, 0xF3, 0x69, 0x46, 0x37, 0x18, 0xD5, 0xFA, 0x8B, 0xA4, 0x05, 0x2A, 0x5B, 0x74, 0xB9, 0x96, 0xE7, 0xC8, 0x52, 0x7D, 0x0C, 0x23, 0xEE, 0xC1, 0xB0, 0x9F, 0xAB, 0x84, 0xF5, 0xDA, 0x17, 0x38, 0x49, 0x66, 0xFC, 0xD3, 0xA2, 0x8D, 0x40, 0x6F, 0x1E, 0x31, 0x76, 0x59, 0x28, 0x07, 0xCA, 0xE5, 0x94, 0xBB, 0x21, 0x0E, 0x7F, 0x50, 0x9D, 0xB2, 0xC3, 0xEC, 0xD8, 0xF7, 0x86, 0xA9, 0x64, 0x4B, 0x3A, 0x15, 0x8F, 0xA0, 0xD1, 0xFE, 0x33, 0x1C, 0x6D, 0x42}, "CRC-8/AUTOSAR", 0x2F, false, false, 0x42, 0xFF}},
-        {"CRC-8/BLUETOOTH", {{}, 0, 0x26, 0x00, (uint8_t []){0x00, 0x6B, 0xD6, 0xBD, 0x67, 0x0C, 0xB1, 0xDA, 0xCE, 0xA5, 0x18, 0x73, 0xA9, 0xC2, 0x7F, 0x14, 0x57, 0x3C, 0x81, 0xEA, 0x30, 0x5B, 0xE6, 0x8D, 0x99, 0xF2, 0x4F, 0x24, 0xFE, 0x95, 0x28, 0x43, 0xAE, 0xC5, 0x78, 0x13, 0xC9, 0xA2, 0x1F, 0x74, 0x60, 0x0B, 0xB6, 0xDD, 0x07, 0x6C, 0xD1, 0xBA, 0xF9, 0x92, 0x2F, 0x44, 0x9E, 0xF5, 0x48, 0x23, 0x37, 0x5C, 0xE1, 0x8A, 0x50, 0x3B, 0x86, 0xED, 0x97, 0xFC, 0x41, 0x2A, 0xF0, 0x9B, 0x26, 0x4D, 0x59, 0x32, 0x8F, 0xE4, 0x3E, 0x55, 0xE8, 0x83, 0xC0, 0xAB, 0x16, 0x7D, 0xA7, 0xCC, 0x71, 0x1A, 0x0E, 0x65, 0xD8, 0xB3, 0x69, 0x02, 0xBF, 0xD4, 0x39, 0x52, 0xEF, 0x84, 0x5E, 0x35, 0x88, 0xE3, 0xF7, 0x9C, 0x21, 0x4A, 0x90, 0xFB, 0x46, 0x2D, 0x6E, 0x05, 0xB8, 0xD3, 0x09, 0x62, 0xDF, 0xB4, 0xA0, 0xCB, 0x76, 0x1D, 0xC7, 0xAC, 0x11, 0x7A, 0xE5, 0x8E, 0x33, 0x58, 0x82, 0xE9, 0x54, 0x3F, 0x2B, 0x40, 0xFD, 0x96, 0x4C, 0x27, 0x9A, 0xF1, 0xB2, 0xD9, 0x64, 0x0F, 0xD5, 0xBE, 0x03, 0x68, 0x7C, 0x17, 0xAA, 0xC1, 0x1B, 0x70, 0xCD, 0xA6, 0x4B, 0x20, 0x9D, 0xF6, 0x2C, 0x47, 0xFA, 0x91, 0x85, 0xEE, 0x53, 0x38, 0xE2, 0x89, 0x34, 0x5F, 0x1C, 0x77, 0xCA, 0xA1, 0x7B, 0x10, 0xAD, 0xC6, 0xD2, 0xB9, 0x04, 0x6F, 0xB5, 0xDE, 0x63, 0x08, 0x72, 0x19, 0xA4, 0xCF, 0x15, 0x7E, 0xC3, 0xA8, 0xBC, 0xD7, 0x6A, 0x01, 0xDB, 0xB0, 0x0D, 0x66, 0x25, 0x4E, 0xF3, 0x98, 0x42, 0x29, 0x94, 0xFF, 0xEB, 0x80, 0x3D, 0x56, 0x8C, 0xE7, 0x5A, 0x31, 0xDC, 0xB7, 0x0A, 0x61, 0xBB, 0xD0, 0x6D, 0x06, 0x12, 0x79, 0xC4, 0xAF, 0x75, 0x1E, 0xA3, 0xC8, 0x8B, 0xE0, 0x5D, 0x36, 0xEC, 0x87, 0x3A, 0x51, 0x45, 0x2E, 0x93, 0xF8, 0x22, 0x49, 0xF4, 0x9F}, "CRC-8/BLUETOOTH", 0xA7, true, true, 0x00, 0x00}},
-        {"CRC-8/CDMA2000", {{}, 0, 0xDA, 0xFF, (uint8_t []){0x00, 0x9B, 0xAD, 0x36, 0xC1, 0x5A, 0x6C, 0xF7, 0x19, 0x82, 0xB4, 0x2F, 0xD8, 0x43, 0x75, 0xEE, 0x32, 0xA9, 0x9F, 0x04, 0xF3, 0x68, 0x5E, 0xC5, 0x2B, 0xB0, 0x86, 0x1D, 0xEA, 0x71, 0x47, 0xDC, 0x64, 0xFF, 0xC9, 0x52, 0xA5, 0x3E, 0x08, 0x93, 0x7D, 0xE6, 0xD0, 0x4B, 0xBC, 0x27, 0x11, 0x8A, 0x56, 0xCD, 0xFB, 0x60, 0x97, 0x0C, 0x3A, 0xA1, 0x4F, 0xD4, 0xE2, 0x79, 0x8E, 0x15, 0x23, 0xB8, 0xC8, 0x53, 0x65, 0xFE, 0x09, 0x92, 0xA4, 0x3F, 0xD1, 0x4A, 0x7C, 0xE7, 0x10, 0x8B, 0xBD, 0x26, 0xFA, 0x61, 0x57, 0xCC, 0x3B, 0xA0, 0x96, 0x0D, 0xE3, 0x78, 0x4E, 0xD5, 0x22, 0xB9, 0x8F, 0x14, 0xAC, 0x37, 0x01, 0x9A, 0x6D, 0xF6, 0xC0, 0x5B, 0xB5, 0x2E, 0x18, 0x83, 0x74, 0xEF, 0xD9, 0x42, 0x9E, 0x05, 0x33, 0xA8, 0x5F, 0xC4, 0xF2, 0x69, 0x87, 0x1C, 0x2A, 0xB1, 0x46, 0xDD, 0xEB, 0x70, 0x0B, 0x90, 0xA6, 0x3D, 0xCA, 0x51, 0x67, 0xFC, 0x12, 0x89, 0xBF, 0x24, 0xD3, 0x48, 0x7E, 0xE5, 0x39, 0xA2, 0x94, 0x0F, 0xF8, 0x63, 0x55, 0xCE, 0x20, 0xBB, 0x8D, 0x16, 0xE1, 0x7A, 0x4C, 0xD7, 0x6F, 0xF4, 0xC2, 0x59, 0xAE, 0x35, 0x03, 0x98, 0x76, 0xED, 0xDB, 0x40, 0xB7, 0x2C, 0x1A, 0x81, 0x5D, 0xC6, 0xF0, 0x6B, 0x9C, 0x07, 0x31, 0xAA, 0x44, 0xDF, 0xE9, 0x72, 0x85, 0x1E, 0x28, 0xB3, 0xC3, 0x58, 0x6E, 0xF5, 0x02, 0x99, 0xAF, 0x34, 0xDA, 0x41, 0x77, 0xEC, 0x1B, 0x80, 0xB6, 0x2D, 0xF1, 0x6A, 0x5C, 0xC7, 0x30, 0xAB, 0x9D, 0x06, 0xE8, 0x73, 0x45, 0xDE, 0x29, 0xB2, 0x84, 0x1F, 0xA7, 0x3C, 0x0A, 0x91, 0x66, 0xFD, 0xCB, 0x50, 0xBE, 0x25, 0x13, 0x88, 0x7F, 0xE4, 0xD2, 0x49, 0x95, 0x0E, 0x38, 0xA3, 0x54, 0xCF, 0xF9, 0x62, 0x8C, 0x17, 0x21, 0xBA, 0x4D, 0xD6, 0xE0, 0x7B}, "CRC-8/CDMA2000", 0x9B, false, false, 0x00, 0x00}},
-        {"CRC-8/DARC", {{}, 0, 0x15, 0x00, (uint8_t []){0x00, 0x72, 0xE4, 0x96, 0xF1, 0x83, 0x15, 0x67, 0xDB, 0xA9, 0x3F, 0x4D, 0x2A, 0x58, 0xCE, 0xBC, 0x8F, 0xFD, 0x6B, 0x19, 0x7E, 0x0C, 0x9A, 0xE8, 0x54, 0x26, 0xB0, 0xC2, 0xA5, 0xD7, 0x41, 0x33, 0x27, 0x55, 0xC3, 0xB1, 0xD6, 0xA4, 0x32, 0x40, 0xFC, 0x8E, 0x18, 0x6A, 0x0D, 0x7F, 0xE9, 0x9B, 0xA8, 0xDA, 0x4C, 0x3E, 0x59, 0x2B, 0xBD, 0xCF, 0x73, 0x01, 0x97, 0xE5, 0x82, 0xF0, 0x66, 0x14, 0x4E, 0x3C, 0xAA, 0xD8, 0xBF, 0xCD, 0x5B, 0x29, 0x95, 0xE7, 0x71, 0x03, 0x64, 0x16, 0x80, 0xF2, 0xC1, 0xB3, 0x25, 0x57, 0x30, 0x42, 0xD4, 0xA6, 0x1A, 0x68, 0xFE, 0x8C, 0xEB, 0x99, 0x0F, 0x7D, 0x69, 0x1B, 0x8D, 0xFF, 0x98, 0xEA, 0x7C, 0x0E, 0xB2, 0xC0, 0x56, 0x24, 0x43, 0x31, 0xA7, 0xD5, 0xE6, 0x94, 0x02, 0x70, 0x17, 0x65, 0xF3, 0x81, 0x3D, 0x4F, 0xD9, 0xAB, 0xCC, 0xBE, 0x28, 0x5A, 0x9C, 0xEE, 0x78, 0x0A, 0x6D, 0x1F, 0x89, 0xFB, 0x47, 0x35, 0xA3, 0xD1, 0xB6, 0xC4, 0x52, 0x20, 0x13, 0x61, 0xF7, 0x85, 0xE2, 0x90, 0x06, 0x74, 0xC8, 0xBA, 0x2C, 0x5E, 0x39, 0x4B, 0xDD, 0xAF, 0xBB, 0xC9, 0x5F, 0x2D, 0x4A, 0x38, 0xAE, 0xDC, 0x60, 0x12, 0x84, 0xF6, 0x91, 0xE3, 0x75, 0x07, 0x34, 0x46, 0xD0, 0xA2, 0xC5, 0xB7, 0x21, 0x53, 0xEF, 0x9D, 0x0B, 0x79, 0x1E, 0x6C, 0xFA, 0x88, 0xD2, 0xA0, 0x36, 0x44, 0x23, 0x51, 0xC7, 0xB5, 0x09, 0x7B, 0xED, 0x9F, 0xF8, 0x8A, 0x1C, 0x6E, 0x5D, 0x2F, 0xB9, 0xCB, 0xAC, 0xDE, 0x48, 0x3A, 0x86, 0xF4, 0x62, 0x10, 0x77, 0x05, 0x93, 0xE1, 0xF5, 0x87, 0x11, 0x63, 0x04, 0x76, 0xE0, 0x92, 0x2E, 0x5C, 0xCA, 0xB8, 0xDF, 0xAD, 0x3B, 0x49, 0x7A, 0x08, 0x9E, 0xEC, 0x8B, 0xF9, 0x6F, 0x1D, 0xA1, 0xD3, 0x45, 0x37, 0x50, 0x22, 0xB4, 0xC6}, "CRC-8/DARC", 0x39, true, true, 0x00, 0x00}},
-        {"CRC-8/DVB-S2", {{}, 0, 0xBC, 0x00, (uint8_t []){0x00, 0xD5, 0x7F, 0xAA, 0xFE, 0x2B, 0x81, 0x54, 0x29, 0xFC, 0x56, 0x83, 0xD7, 0x02, 0xA8, 0x7D, 0x52, 0x87, 0x2D, 0xF8, 0xAC, 0x79, 0xD3, 0x06, 0x7B, 0xAE, 0x04, 0xD1, 0x85, 0x50, 0xFA, 0x2F, 0xA4, 0x71, 0xDB, 0x0E, 0x5A, 0x8F, 0x25, 0xF0, 0x8D, 0x58, 0xF2, 0x27, 0x73, 0xA6, 0x0C, 0xD9, 0xF6, 0x23, 0x89, 0x5C, 0x08, 0xDD, 0x77, 0xA2, 0xDF, 0x0A, 0xA0, 0x75, 0x21, 0xF4, 0x5E, 0x8B, 0x9D, 0x48, 0xE2, 0x37, 0x63, 0xB6, 0x1C, 0xC9, 0xB4, 0x61, 0xCB, 0x1E, 0x4A, 0x9F, 0x35, 0xE0, 0xCF, 0x1A, 0xB0, 0x65, 0x31, 0xE4, 0x4E, 0x9B, 0xE6, 0x33, 0x99, 0x4C, 0x18, 0xCD, 0x67, 0xB2, 0x39, 0xEC, 0x46, 0x93, 0xC7, 0x12, 0xB8, 0x6D, 0x10, 0xC5, 0x6F, 0xBA, 0xEE, 0x3B, 0x91, 0x44, 0x6B, 0xBE, 0x14, 0xC1, 0x95, 0x40, 0xEA, 0x3F, 0x42, 0x97, 0x3D, 0xE8, 0xBC, 0x69, 0xC3, 0x16, 0xEF, 0x3A, 0x90, 0x45, 0x11, 0xC4, 0x6E, 0xBB, 0xC6, 0x13, 0xB9, 0x6C, 0x38, 0xED, 0x47, 0x92, 0xBD, 0x68, 0xC2, 0x17, 0x43, 0x96, 0x3C, 0xE9, 0x94, 0x41, 0xEB, 0x3E, 0x6A, 0xBF, 0x15, 0xC0, 0x4B, 0x9E, 0x34, 0xE1, 0xB5, 0x60, 0xCA, 0x1F, 0x62, 0xB7, 0x1D, 0xC8, 0x9C, 0x49, 0xE3, 0x36, 0x19, 0xCC, 0x66, 0xB3, 0xE7, 0x32, 0x98, 0x4D, 0x30, 0xE5, 0x4F, 0x9A, 0xCE, 0x1B, 0xB1, 0x64, 0x72, 0xA7, 0x0D, 0xD8, 0x8C, 0x59, 0xF3, 0x26, 0x5B, 0x8E, 0x24, 0xF1, 0xA5, 0x70, 0xDA, 0x0F, 0x20, 0xF5, 0x5F, 0x8A, 0xDE, 0x0B, 0xA1, 0x74, 0x09, 0xDC, 0x76, 0xA3, 0xF7, 0x22, 0x88, 0x5D, 0xD6, 0x03, 0xA9, 0x7C, 0x28, 0xFD, 0x57, 0x82, 0xFF, 0x2A, 0x80, 0x55, 0x01, 0xD4, 0x7E, 0xAB, 0x84, 0x51, 0xFB, 0x2E, 0x7A, 0xAF, 0x05, 0xD0, 0xAD, 0x78, 0xD2, 0x07, 0x53, 0x86, 0x2C, 0xF9}, "CRC-8/DVB-S2", 0xD5, false, false, 0x00, 0x00}},
-        {"CRC-8/EBU", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, (uint8_t []){0x00, 0x64, 0xC8, 0xAC, 0xE1, 0x85, 0x29, 0x4D, 0xB3, 0xD7, 0x7B, 0x1F, 0x52, 0x36, 0x9A, 0xFE, 0x17, 0x73, 0xDF, 0xBB, 0xF6, 0x92, 0x3E, 0x5A, 0xA4, 0xC0, 0x6C, 0x08, 0x45, 0x21, 0x8D, 0xE9, 0x2E, 0x4A, 0xE6, 0x82, 0xCF, 0xAB, 0x07, 0x63, 0x9D, 0xF9, 0x55, 0x31, 0x7C, 0x18, 0xB4, 0xD0, 0x39, 0x5D, 0xF1, 0x95, 0xD8, 0xBC, 0x10, 0x74, 0x8A, 0xEE, 0x42, 0x26, 0x6B, 0x0F, 0xA3, 0xC7, 0x5C, 0x38, 0x94, 0xF0, 0xBD, 0xD9, 0x75, 0x11, 0xEF, 0x8B, 0x27, 0x43, 0x0E, 0x6A, 0xC6, 0xA2, 0x4B, 0x2F, 0x83, 0xE7, 0xAA, 0xCE, 0x62, 0x06, 0xF8, 0x9C, 0x30, 0x54, 0x19, 0x7D, 0xD1, 0xB5, 0x72, 0x16, 0xBA, 0xDE, 0x93, 0xF7, 0x5B, 0x3F, 0xC1, 0xA5, 0x09, 0x6D, 0x20, 0x44, 0xE8, 0x8C, 0x65, 0x01, 0xAD, 0xC9, 0x84, 0xE0, 0x4C, 0x28, 0xD6, 0xB2, 0x1E, 0x7A, 0x37, 0x53, 0xFF, 0x9B, 0xB8, 0xDC, 0x70, 0x14, 0x59, 0x3D, 0x91, 0xF5, 0x0B, 0x6F, 0xC3, 0xA7, 0xEA, 0x8E, 0x22, 0x46, 0xAF, 0xCB, 0x67, 0x03, 0x4E, 0x2A, 0x86, 0xE2, 0x1C, 0x78, 0xD4, 0xB0, 0xFD, 0x99, 0x35, 0x51, 0x96, 0xF2, 0x5E, 0x3A, 0x77, 0x13, 0xBF, 0xDB, 0x25, 0x41, 0xED, 0x89, 0xC4, 0xA0, 0x0C, 0x68, 0x81, 0xE5, 0x49, 0x2D, 0x60, 0x04, 0xA8, 0xCC, 0x32, 0x56, 0xFA, 0x9E, 0xD3, 0xB7, 0x1B, 0x7F, 0xE4, 0x80, 0x2C, 0x48, 0x05, 0x61, 0xCD, 0xA9, 0x57, 0x33, 0x9F, 0xFB, 0xB6, 0xD2, 0x7E, 0x1A, 0xF3, 0x97, 0x3B, 0x5F, 0x12, 0x76, 0xDA, 0xBE, 0x40, 0x24, 0x88, 0xEC, 0xA1, 0xC5, 0x69, 0x0D, 0xCA, 0xAE, 0x02, 0x66, 0x2B, 0x4F, 0xE3, 0x87, 0x79, 0x1D, 0xB1, 0xD5, 0x98, 0xFC, 0x50, 0x34, 0xDD, 0xB9, 0x15, 0x71, 0x3C, 0x58, 0xF4, 0x90, 0x6E, 0x0A, 0xA6, 0xC2, 0x8F, 0xEB, 0x47, 0x23}, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
-        {"CRC-8/GSM-A", {{}, 0, 0x37, 0x00, (uint8_t []){0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB, 0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76, 0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C, 0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1, 0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8, 0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65, 0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F, 0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2, 0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D, 0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50, 0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A, 0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7, 0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E, 0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43, 0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09, 0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4}, "CRC-8/GSM-A", 0x1D, false, false, 0x00, 0x00}},
-        {"CRC-8/GSM-B", {{}, 0, 0x94, 0x00, (uint8_t []){0x00, 0x49, 0x92, 0xDB, 0x6D, 0x24, 0xFF, 0xB6, 0xDA, 0x93, 0x48, 0x01, 0xB7, 0xFE, 0x25, 0x6C, 0xFD, 0xB4, 0x6F, 0x26, 0x90, 0xD9, 0x02, 0x4B, 0x27, 0x6E, 0xB5, 0xFC, 0x4A, 0x03, 0xD8, 0x91, 0xB3, 0xFA, 0x21, 0x68, 0xDE, 0x97, 0x4C, 0x05, 0x69, 0x20, 0xFB, 0xB2, 0x04, 0x4D, 0x96, 0xDF, 0x4E, 0x07, 0xDC, 0x95, 0x23, 0x6A, 0xB1, 0xF8, 0x94, 0xDD, 0x06, 0x4F, 0xF9, 0xB0, 0x6B, 0x22, 0x2F, 0x66, 0xBD, 0xF4, 0x42, 0x0B, 0xD0, 0x99, 0xF5, 0xBC, 0x67, 0x2E, 0x98, 0xD1, 0x0A, 0x43, 0xD2, 0x9B, 0x40, 0x09, 0xBF, 0xF6, 0x2D, 0x64, 0x08, 0x41, 0x9A, 0xD3, 0x65, 0x2C, 0xF7, 0xBE, 0x9C, 0xD5, 0x0E, 0x47, 0xF1, 0xB8, 0x63, 0x2A, 0x46, 0x0F, 0xD4, 0x9D, 0x2B, 0x62, 0xB9, 0xF0, 0x61, 0x28, 0xF3, 0xBA, 0x0C, 0x45, 0x9E, 0xD7, 0xBB, 0xF2, 0x29, 0x60, 0xD6, 0x9F, 0x44, 0x0D, 0x5E, 0x17, 0xCC, 0x85, 0x33, 0x7A, 0xA1, 0xE8, 0x84, 0xCD, 0x16, 0x5F, 0xE9, 0xA0, 0x7B, 0x32, 0xA3, 0xEA, 0x31, 0x78, 0xCE, 0x87, 0x5C, 0x15, 0x79, 0x30, 0xEB, 0xA2, 0x14, 0x5D, 0x86, 0xCF, 0xED, 0xA4, 0x7F, 0x36, 0x80, 0xC9, 0x12, 0x5B, 0x37, 0x7E, 0xA5, 0xEC, 0x5A, 0x13, 0xC8, 0x81, 0x10, 0x59, 0x82, 0xCB, 0x7D, 0x34, 0xEF, 0xA6, 0xCA, 0x83, 0x58, 0x11, 0xA7, 0xEE, 0x35, 0x7C, 0x71, 0x38, 0xE3, 0xAA, 0x1C, 0x55, 0x8E, 0xC7, 0xAB, 0xE2, 0x39, 0x70, 0xC6, 0x8F, 0x54, 0x1D, 0x8C, 0xC5, 0x1E, 0x57, 0xE1, 0xA8, 0x73, 0x3A, 0x56, 0x1F, 0xC4, 0x8D, 0x3B, 0x72, 0xA9, 0xE0, 0xC2, 0x8B, 0x50, 0x19, 0xAF, 0xE6, 0x3D, 0x74, 0x18, 0x51, 0x8A, 0xC3, 0x75, 0x3C, 0xE7, 0xAE, 0x3F, 0x76, 0xAD, 0xE4, 0x52, 0x1B, 0xC0, 0x89, 0xE5, 0xAC, 0x77, 0x3E, 0x88, 0xC1, 0x1A, 0x53}, "CRC-8/GSM-B", 0x49, false, false, 0x53, 0xFF}},
-        {"CRC-8/HITAG", {{}, 0, 0xB4, 0xFF, (uint8_t []){0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB, 0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76, 0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C, 0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1, 0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8, 0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65, 0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F, 0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2, 0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D, 0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50, 0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A, 0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7, 0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E, 0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43, 0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09, 0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4}, "CRC-8/HITAG", 0x1D, false, false, 0x00, 0x00}},
-        {"CRC-8/I-432-1", {{"CRC-8/ITU"}, 1, 0xA1, 0x00, (uint8_t []){0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD, 0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A, 0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4, 0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34, 0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83, 0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3}, "CRC-8/I-432-1", 0x07, false, false, 0xAC, 0x55}},
-        {"CRC-8/I-CODE", {{}, 0, 0x7E, 0xFD, (uint8_t []){0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB, 0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76, 0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C, 0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1, 0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8, 0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65, 0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F, 0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2, 0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D, 0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50, 0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A, 0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7, 0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E, 0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43, 0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09, 0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4}, "CRC-8/I-CODE", 0x1D, false, false, 0x00, 0x00}},
-        {"CRC-8/ITU", {{"CRC-8/ITU"}, 1, 0xA1, 0x00, (uint8_t []){0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD, 0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A, 0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4, 0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34, 0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83, 0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3}, "CRC-8/I-432-1", 0x07, false, false, 0xAC, 0x55}},
-        {"CRC-8/LTE", {{}, 0, 0xEA, 0x00, (uint8_t []){0x00, 0x9B, 0xAD, 0x36, 0xC1, 0x5A, 0x6C, 0xF7, 0x19, 0x82, 0xB4, 0x2F, 0xD8, 0x43, 0x75, 0xEE, 0x32, 0xA9, 0x9F, 0x04, 0xF3, 0x68, 0x5E, 0xC5, 0x2B, 0xB0, 0x86, 0x1D, 0xEA, 0x71, 0x47, 0xDC, 0x64, 0xFF, 0xC9, 0x52, 0xA5, 0x3E, 0x08, 0x93, 0x7D, 0xE6, 0xD0, 0x4B, 0xBC, 0x27, 0x11, 0x8A, 0x56, 0xCD, 0xFB, 0x60, 0x97, 0x0C, 0x3A, 0xA1, 0x4F, 0xD4, 0xE2, 0x79, 0x8E, 0x15, 0x23, 0xB8, 0xC8, 0x53, 0x65, 0xFE, 0x09, 0x92, 0xA4, 0x3F, 0xD1, 0x4A, 0x7C, 0xE7, 0x10, 0x8B, 0xBD, 0x26, 0xFA, 0x61, 0x57, 0xCC, 0x3B, 0xA0, 0x96, 0x0D, 0xE3, 0x78, 0x4E, 0xD5, 0x22, 0xB9, 0x8F, 0x14, 0xAC, 0x37, 0x01, 0x9A, 0x6D, 0xF6, 0xC0, 0x5B, 0xB5, 0x2E, 0x18, 0x83, 0x74, 0xEF, 0xD9, 0x42, 0x9E, 0x05, 0x33, 0xA8, 0x5F, 0xC4, 0xF2, 0x69, 0x87, 0x1C, 0x2A, 0xB1, 0x46, 0xDD, 0xEB, 0x70, 0x0B, 0x90, 0xA6, 0x3D, 0xCA, 0x51, 0x67, 0xFC, 0x12, 0x89, 0xBF, 0x24, 0xD3, 0x48, 0x7E, 0xE5, 0x39, 0xA2, 0x94, 0x0F, 0xF8, 0x63, 0x55, 0xCE, 0x20, 0xBB, 0x8D, 0x16, 0xE1, 0x7A, 0x4C, 0xD7, 0x6F, 0xF4, 0xC2, 0x59, 0xAE, 0x35, 0x03, 0x98, 0x76, 0xED, 0xDB, 0x40, 0xB7, 0x2C, 0x1A, 0x81, 0x5D, 0xC6, 0xF0, 0x6B, 0x9C, 0x07, 0x31, 0xAA, 0x44, 0xDF, 0xE9, 0x72, 0x85, 0x1E, 0x28, 0xB3, 0xC3, 0x58, 0x6E, 0xF5, 0x02, 0x99, 0xAF, 0x34, 0xDA, 0x41, 0x77, 0xEC, 0x1B, 0x80, 0xB6, 0x2D, 0xF1, 0x6A, 0x5C, 0xC7, 0x30, 0xAB, 0x9D, 0x06, 0xE8, 0x73, 0x45, 0xDE, 0x29, 0xB2, 0x84, 0x1F, 0xA7, 0x3C, 0x0A, 0x91, 0x66, 0xFD, 0xCB, 0x50, 0xBE, 0x25, 0x13, 0x88, 0x7F, 0xE4, 0xD2, 0x49, 0x95, 0x0E, 0x38, 0xA3, 0x54, 0xCF, 0xF9, 0x62, 0x8C, 0x17, 0x21, 0xBA, 0x4D, 0xD6, 0xE0, 0x7B}, "CRC-8/LTE", 0x9B, false, false, 0x00, 0x00}},
-        {"CRC-8/MAXIM", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, (uint8_t []){0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41, 0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E, 0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC, 0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0, 0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62, 0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D, 0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF, 0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5, 0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07, 0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58, 0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A, 0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6, 0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24, 0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B, 0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9, 0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F, 0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD, 0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92, 0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50, 0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C, 0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE, 0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1, 0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73, 0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49, 0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B, 0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4, 0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16, 0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A, 0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8, 0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7, 0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35}, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}},
-        {"CRC-8/MAXIM-DOW", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, (uint8_t []){0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41, 0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E, 0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC, 0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0, 0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62, 0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D, 0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF, 0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5, 0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07, 0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58, 0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A, 0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6, 0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24, 0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B, 0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9, 0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F, 0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD, 0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92, 0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50, 0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C, 0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE, 0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1, 0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73, 0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49, 0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B, 0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4, 0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16, 0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A, 0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8, 0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7, 0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35}, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}},
-        {"CRC-8/MIFARE-MAD", {{}, 0, 0x99, 0xC7, (uint8_t []){0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB, 0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76, 0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C, 0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1, 0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8, 0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65, 0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F, 0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2, 0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D, 0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50, 0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A, 0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7, 0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E, 0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43, 0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09, 0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4}, "CRC-8/MIFARE-MAD", 0x1D, false, false, 0x00, 0x00}},
-        {"CRC-8/NRSC-5", {{}, 0, 0xF7, 0xFF, (uint8_t []){0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0xB9, 0x88, 0xDB, 0xEA, 0x7D, 0x4C, 0x1F, 0x2E, 0x43, 0x72, 0x21, 0x10, 0x87, 0xB6, 0xE5, 0xD4, 0xFA, 0xCB, 0x98, 0xA9, 0x3E, 0x0F, 0x5C, 0x6D, 0x86, 0xB7, 0xE4, 0xD5, 0x42, 0x73, 0x20, 0x11, 0x3F, 0x0E, 0x5D, 0x6C, 0xFB, 0xCA, 0x99, 0xA8, 0xC5, 0xF4, 0xA7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7C, 0x4D, 0x1E, 0x2F, 0xB8, 0x89, 0xDA, 0xEB, 0x3D, 0x0C, 0x5F, 0x6E, 0xF9, 0xC8, 0x9B, 0xAA, 0x84, 0xB5, 0xE6, 0xD7, 0x40, 0x71, 0x22, 0x13, 0x7E, 0x4F, 0x1C, 0x2D, 0xBA, 0x8B, 0xD8, 0xE9, 0xC7, 0xF6, 0xA5, 0x94, 0x03, 0x32, 0x61, 0x50, 0xBB, 0x8A, 0xD9, 0xE8, 0x7F, 0x4E, 0x1D, 0x2C, 0x02, 0x33, 0x60, 0x51, 0xC6, 0xF7, 0xA4, 0x95, 0xF8, 0xC9, 0x9A, 0xAB, 0x3C, 0x0D, 0x5E, 0x6F, 0x41, 0x70, 0x23, 0x12, 0x85, 0xB4, 0xE7, 0xD6, 0x7A, 0x4B, 0x18, 0x29, 0xBE, 0x8F, 0xDC, 0xED, 0xC3, 0xF2, 0xA1, 0x90, 0x07, 0x36, 0x65, 0x54, 0x39, 0x08, 0x5B, 0x6A, 0xFD, 0xCC, 0x9F, 0xAE, 0x80, 0xB1, 0xE2, 0xD3, 0x44, 0x75, 0x26, 0x17, 0xFC, 0xCD, 0x9E, 0xAF, 0x38, 0x09, 0x5A, 0x6B, 0x45, 0x74, 0x27, 0x16, 0x81, 0xB0, 0xE3, 0xD2, 0xBF, 0x8E, 0xDD, 0xEC, 0x7B, 0x4A, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xC2, 0xF3, 0xA0, 0x91, 0x47, 0x76, 0x25, 0x14, 0x83, 0xB2, 0xE1, 0xD0, 0xFE, 0xCF, 0x9C, 0xAD, 0x3A, 0x0B, 0x58, 0x69, 0x04, 0x35, 0x66, 0x57, 0xC0, 0xF1, 0xA2, 0x93, 0xBD, 0x8C, 0xDF, 0xEE, 0x79, 0x48, 0x1B, 0x2A, 0xC1, 0xF0, 0xA3, 0x92, 0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1A, 0x2B, 0xBC, 0x8D, 0xDE, 0xEF, 0x82, 0xB3, 0xE0, 0xD1, 0x46, 0x77, 0x24, 0x15, 0x3B, 0x0A, 0x59, 0x68, 0xFF, 0xCE, 0x9D, 0xAC}, "CRC-8/NRSC-5", 0x31, false, false, 0x00, 0x00}},
-        {"CRC-8/OPENSAFETY", {{}, 0, 0x3E, 0x00, (uint8_t []){0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD, 0x57, 0x78, 0x09, 0x26, 0xEB, 0xC4, 0xB5, 0x9A, 0xAE, 0x81, 0xF0, 0xDF, 0x12, 0x3D, 0x4C, 0x63, 0xF9, 0xD6, 0xA7, 0x88, 0x45, 0x6A, 0x1B, 0x34, 0x73, 0x5C, 0x2D, 0x02, 0xCF, 0xE0, 0x91, 0xBE, 0x24, 0x0B, 0x7A, 0x55, 0x98, 0xB7, 0xC6, 0xE9, 0xDD, 0xF2, 0x83, 0xAC, 0x61, 0x4E, 0x3F, 0x10, 0x8A, 0xA5, 0xD4, 0xFB, 0x36, 0x19, 0x68, 0x47, 0xE6, 0xC9, 0xB8, 0x97, 0x5A, 0x75, 0x04, 0x2B, 0xB1, 0x9E, 0xEF, 0xC0, 0x0D, 0x22, 0x53, 0x7C, 0x48, 0x67, 0x16, 0x39, 0xF4, 0xDB, 0xAA, 0x85, 0x1F, 0x30, 0x41, 0x6E, 0xA3, 0x8C, 0xFD, 0xD2, 0x95, 0xBA, 0xCB, 0xE4, 0x29, 0x06, 0x77, 0x58, 0xC2, 0xED, 0x9C, 0xB3, 0x7E, 0x51, 0x20, 0x0F, 0x3B, 0x14, 0x65, 0x4A, 0x87, 0xA8, 0xD9, 0xF6, 0x6C, 0x43, 0x32, 0x1D, 0xD0, 0xFF, 0x8E, 0xA1, 0xE3, 0xCC, 0xBD, 0x92, 0x5F, 0x70, 0x01, 0x2E, 0xB4, 0x9B, 0xEA, 0xC5, 0x08, 0x27, 0x56, 0x79, 0x4D, 0x62, 0x13, 0x3C, 0xF1, 0xDE, 0xAF, 0x80, 0x1A, 0x35, 0x44, 0x6B, 0xA6, 0x89, 0xF8, 0xD7, 0x90, 0xBF, 0xCE, 0xE1, 0x2C, 0x03, 0x72, 0x5D, 0xC7, 0xE8, 0x99, 0xB6, 0x7B, 0x54, 0x25, 0x0A, 0x3E, 0x11, 0x60, 0x4F, 0x82, 0xAD, 0xDC, 0xF3, 0x69, 0x46, 0x37, 0x18, 0xD5, 0xFA, 0x8B, 0xA4, 0x05, 0x2A, 0x5B, 0x74, 0xB9, 0x96, 0xE7, 0xC8, 0x52, 0x7D, 0x0C, 0x23, 0xEE, 0xC1, 0xB0, 0x9F, 0xAB, 0x84, 0xF5, 0xDA, 0x17, 0x38, 0x49, 0x66, 0xFC, 0xD3, 0xA2, 0x8D, 0x40, 0x6F, 0x1E, 0x31, 0x76, 0x59, 0x28, 0x07, 0xCA, 0xE5, 0x94, 0xBB, 0x21, 0x0E, 0x7F, 0x50, 0x9D, 0xB2, 0xC3, 0xEC, 0xD8, 0xF7, 0x86, 0xA9, 0x64, 0x4B, 0x3A, 0x15, 0x8F, 0xA0, 0xD1, 0xFE, 0x33, 0x1C, 0x6D, 0x42}, "CRC-8/OPENSAFETY", 0x2F, false, false, 0x00, 0x00}},
-        {"CRC-8/ROHC", {{}, 0, 0xD0, 0xFF, (uint8_t []){0x00, 0x91, 0xE3, 0x72, 0x07, 0x96, 0xE4, 0x75, 0x0E, 0x9F, 0xED, 0x7C, 0x09, 0x98, 0xEA, 0x7B, 0x1C, 0x8D, 0xFF, 0x6E, 0x1B, 0x8A, 0xF8, 0x69, 0x12, 0x83, 0xF1, 0x60, 0x15, 0x84, 0xF6, 0x67, 0x38, 0xA9, 0xDB, 0x4A, 0x3F, 0xAE, 0xDC, 0x4D, 0x36, 0xA7, 0xD5, 0x44, 0x31, 0xA0, 0xD2, 0x43, 0x24, 0xB5, 0xC7, 0x56, 0x23, 0xB2, 0xC0, 0x51, 0x2A, 0xBB, 0xC9, 0x58, 0x2D, 0xBC, 0xCE, 0x5F, 0x70, 0xE1, 0x93, 0x02, 0x77, 0xE6, 0x94, 0x05, 0x7E, 0xEF, 0x9D, 0x0C, 0x79, 0xE8, 0x9A, 0x0B, 0x6C, 0xFD, 0x8F, 0x1E, 0x6B, 0xFA, 0x88, 0x19, 0x62, 0xF3, 0x81, 0x10, 0x65, 0xF4, 0x86, 0x17, 0x48, 0xD9, 0xAB, 0x3A, 0x4F, 0xDE, 0xAC, 0x3D, 0x46, 0xD7, 0xA5, 0x34, 0x41, 0xD0, 0xA2, 0x33, 0x54, 0xC5, 0xB7, 0x26, 0x53, 0xC2, 0xB0, 0x21, 0x5A, 0xCB, 0xB9, 0x28, 0x5D, 0xCC, 0xBE, 0x2F, 0xE0, 0x71, 0x03, 0x92, 0xE7, 0x76, 0x04, 0x95, 0xEE, 0x7F, 0x0D, 0x9C, 0xE9, 0x78, 0x0A, 0x9B, 0xFC, 0x6D, 0x1F, 0x8E, 0xFB, 0x6A, 0x18, 0x89, 0xF2, 0x63, 0x11, 0x80, 0xF5, 0x64, 0x16, 0x87, 0xD8, 0x49, 0x3B, 0xAA, 0xDF, 0x4E, 0x3C, 0xAD, 0xD6, 0x47, 0x35, 0xA4, 0xD1, 0x40, 0x32, 0xA3, 0xC4, 0x55, 0x27, 0xB6, 0xC3, 0x52, 0x20, 0xB1, 0xCA, 0x5B, 0x29, 0xB8, 0xCD, 0x5C, 0x2E, 0xBF, 0x90, 0x01, 0x73, 0xE2, 0x97, 0x06, 0x74, 0xE5, 0x9E, 0x0F, 0x7D, 0xEC, 0x99, 0x08, 0x7A, 0xEB, 0x8C, 0x1D, 0x6F, 0xFE, 0x8B, 0x1A, 0x68, 0xF9, 0x82, 0x13, 0x61, 0xF0, 0x85, 0x14, 0x66, 0xF7, 0xA8, 0x39, 0x4B, 0xDA, 0xAF, 0x3E, 0x4C, 0xDD, 0xA6, 0x37, 0x45, 0xD4, 0xA1, 0x30, 0x42, 0xD3, 0xB4, 0x25, 0x57, 0xC6, 0xB3, 0x22, 0x50, 0xC1, 0xBA, 0x2B, 0x59, 0xC8, 0xBD, 0x2C, 0x5E, 0xCF}, "CRC-8/ROHC", 0x07, true, true, 0x00, 0x00}},
-        {"CRC-8/SAE-J1850", {{}, 0, 0x4B, 0xFF, (uint8_t []){0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB, 0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76, 0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C, 0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1, 0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8, 0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65, 0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F, 0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2, 0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D, 0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50, 0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A, 0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7, 0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E, 0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43, 0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09, 0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4}, "CRC-8/SAE-J1850", 0x1D, false, false, 0xC4, 0xFF}},
-        {"CRC-8/SMBUS", {{"CRC-8"}, 1, 0xF4, 0x00, (uint8_t []){0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD, 0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A, 0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4, 0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34, 0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83, 0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3}, "CRC-8/SMBUS", 0x07, false, false, 0x00, 0x00}},
-        {"CRC-8/TECH-3250", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, (uint8_t []){0x00, 0x64, 0xC8, 0xAC, 0xE1, 0x85, 0x29, 0x4D, 0xB3, 0xD7, 0x7B, 0x1F, 0x52, 0x36, 0x9A, 0xFE, 0x17, 0x73, 0xDF, 0xBB, 0xF6, 0x92, 0x3E, 0x5A, 0xA4, 0xC0, 0x6C, 0x08, 0x45, 0x21, 0x8D, 0xE9, 0x2E, 0x4A, 0xE6, 0x82, 0xCF, 0xAB, 0x07, 0x63, 0x9D, 0xF9, 0x55, 0x31, 0x7C, 0x18, 0xB4, 0xD0, 0x39, 0x5D, 0xF1, 0x95, 0xD8, 0xBC, 0x10, 0x74, 0x8A, 0xEE, 0x42, 0x26, 0x6B, 0x0F, 0xA3, 0xC7, 0x5C, 0x38, 0x94, 0xF0, 0xBD, 0xD9, 0x75, 0x11, 0xEF, 0x8B, 0x27, 0x43, 0x0E, 0x6A, 0xC6, 0xA2, 0x4B, 0x2F, 0x83, 0xE7, 0xAA, 0xCE, 0x62, 0x06, 0xF8, 0x9C, 0x30, 0x54, 0x19, 0x7D, 0xD1, 0xB5, 0x72, 0x16, 0xBA, 0xDE, 0x93, 0xF7, 0x5B, 0x3F, 0xC1, 0xA5, 0x09, 0x6D, 0x20, 0x44, 0xE8, 0x8C, 0x65, 0x01, 0xAD, 0xC9, 0x84, 0xE0, 0x4C, 0x28, 0xD6, 0xB2, 0x1E, 0x7A, 0x37, 0x53, 0xFF, 0x9B, 0xB8, 0xDC, 0x70, 0x14, 0x59, 0x3D, 0x91, 0xF5, 0x0B, 0x6F, 0xC3, 0xA7, 0xEA, 0x8E, 0x22, 0x46, 0xAF, 0xCB, 0x67, 0x03, 0x4E, 0x2A, 0x86, 0xE2, 0x1C, 0x78, 0xD4, 0xB0, 0xFD, 0x99, 0x35, 0x51, 0x96, 0xF2, 0x5E, 0x3A, 0x77, 0x13, 0xBF, 0xDB, 0x25, 0x41, 0xED, 0x89, 0xC4, 0xA0, 0x0C, 0x68, 0x81, 0xE5, 0x49, 0x2D, 0x60, 0x04, 0xA8, 0xCC, 0x32, 0x56, 0xFA, 0x9E, 0xD3, 0xB7, 0x1B, 0x7F, 0xE4, 0x80, 0x2C, 0x48, 0x05, 0x61, 0xCD, 0xA9, 0x57, 0x33, 0x9F, 0xFB, 0xB6, 0xD2, 0x7E, 0x1A, 0xF3, 0x97, 0x3B, 0x5F, 0x12, 0x76, 0xDA, 0xBE, 0x40, 0x24, 0x88, 0xEC, 0xA1, 0xC5, 0x69, 0x0D, 0xCA, 0xAE, 0x02, 0x66, 0x2B, 0x4F, 0xE3, 0x87, 0x79, 0x1D, 0xB1, 0xD5, 0x98, 0xFC, 0x50, 0x34, 0xDD, 0xB9, 0x15, 0x71, 0x3C, 0x58, 0xF4, 0x90, 0x6E, 0x0A, 0xA6, 0xC2, 0x8F, 0xEB, 0x47, 0x23}, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
-        {"CRC-8/WCDMA", {{}, 0, 0x25, 0x00, (uint8_t []){0x00, 0xD0, 0x13, 0xC3, 0x26, 0xF6, 0x35, 0xE5, 0x4C, 0x9C, 0x5F, 0x8F, 0x6A, 0xBA, 0x79, 0xA9, 0x98, 0x48, 0x8B, 0x5B, 0xBE, 0x6E, 0xAD, 0x7D, 0xD4, 0x04, 0xC7, 0x17, 0xF2, 0x22, 0xE1, 0x31, 0x83, 0x53, 0x90, 0x40, 0xA5, 0x75, 0xB6, 0x66, 0xCF, 0x1F, 0xDC, 0x0C, 0xE9, 0x39, 0xFA, 0x2A, 0x1B, 0xCB, 0x08, 0xD8, 0x3D, 0xED, 0x2E, 0xFE, 0x57, 0x87, 0x44, 0x94, 0x71, 0xA1, 0x62, 0xB2, 0xB5, 0x65, 0xA6, 0x76, 0x93, 0x43, 0x80, 0x50, 0xF9, 0x29, 0xEA, 0x3A, 0xDF, 0x0F, 0xCC, 0x1C, 0x2D, 0xFD, 0x3E, 0xEE, 0x0B, 0xDB, 0x18, 0xC8, 0x61, 0xB1, 0x72, 0xA2, 0x47, 0x97, 0x54, 0x84, 0x36, 0xE6, 0x25, 0xF5, 0x10, 0xC0, 0x03, 0xD3, 0x7A, 0xAA, 0x69, 0xB9, 0x5C, 0x8C, 0x4F, 0x9F, 0xAE, 0x7E, 0xBD, 0x6D, 0x88, 0x58, 0x9B, 0x4B, 0xE2, 0x32, 0xF1, 0x21, 0xC4, 0x14, 0xD7, 0x07, 0xD9, 0x09, 0xCA, 0x1A, 0xFF, 0x2F, 0xEC, 0x3C, 0x95, 0x45, 0x86, 0x56, 0xB3, 0x63, 0xA0, 0x70, 0x41, 0x91, 0x52, 0x82, 0x67, 0xB7, 0x74, 0xA4, 0x0D, 0xDD, 0x1E, 0xCE, 0x2B, 0xFB, 0x38, 0xE8, 0x5A, 0x8A, 0x49, 0x99, 0x7C, 0xAC, 0x6F, 0xBF, 0x16, 0xC6, 0x05, 0xD5, 0x30, 0xE0, 0x23, 0xF3, 0xC2, 0x12, 0xD1, 0x01, 0xE4, 0x34, 0xF7, 0x27, 0x8E, 0x5E, 0x9D, 0x4D, 0xA8, 0x78, 0xBB, 0x6B, 0x6C, 0xBC, 0x7F, 0xAF, 0x4A, 0x9A, 0x59, 0x89, 0x20, 0xF0, 0x33, 0xE3, 0x06, 0xD6, 0x15, 0xC5, 0xF4, 0x24, 0xE7, 0x37, 0xD2, 0x02, 0xC1, 0x11, 0xB8, 0x68, 0xAB, 0x7B, 0x9E, 0x4E, 0x8D, 0x5D, 0xEF, 0x3F, 0xFC, 0x2C, 0xC9, 0x19, 0xDA, 0x0A, 0xA3, 0x73, 0xB0, 0x60, 0x85, 0x55, 0x96, 0x46, 0x77, 0xA7, 0x64, 0xB4, 0x51, 0x81, 0x42, 0x92, 0x3B, 0xEB, 0x28, 0xF8, 0x1D, 0xCD, 0x0E, 0xDE}, "CRC-8/WCDMA", 0x9B, true, true, 0x00, 0x00}},
-        {"DOW-CRC", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, (uint8_t []){0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41, 0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E, 0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC, 0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0, 0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62, 0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D, 0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF, 0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5, 0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07, 0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58, 0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A, 0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6, 0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24, 0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B, 0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9, 0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F, 0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD, 0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92, 0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50, 0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C, 0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE, 0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1, 0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73, 0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49, 0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B, 0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4, 0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16, 0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A, 0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8, 0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7, 0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35}, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}}
+        {"CRC-8", {{"CRC-8"}, 1, 0xF4, 0x00, crc8_smbus_calculate, (uint8_t []){0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD, 0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A, 0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4, 0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34, 0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83, 0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3}, "CRC-8/SMBUS", 0x07, false, false, 0x00, 0x00}},
+        {"CRC-8/AES", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, crc8_tech_3250_calculate, (uint8_t []){0x00, 0x64, 0xC8, 0xAC, 0xE1, 0x85, 0x29, 0x4D, 0xB3, 0xD7, 0x7B, 0x1F, 0x52, 0x36, 0x9A, 0xFE, 0x17, 0x73, 0xDF, 0xBB, 0xF6, 0x92, 0x3E, 0x5A, 0xA4, 0xC0, 0x6C, 0x08, 0x45, 0x21, 0x8D, 0xE9, 0x2E, 0x4A, 0xE6, 0x82, 0xCF, 0xAB, 0x07, 0x63, 0x9D, 0xF9, 0x55, 0x31, 0x7C, 0x18, 0xB4, 0xD0, 0x39, 0x5D, 0xF1, 0x95, 0xD8, 0xBC, 0x10, 0x74, 0x8A, 0xEE, 0x42, 0x26, 0x6B, 0x0F, 0xA3, 0xC7, 0x5C, 0x38, 0x94, 0xF0, 0xBD, 0xD9, 0x75, 0x11, 0xEF, 0x8B, 0x27, 0x43, 0x0E, 0x6A, 0xC6, 0xA2, 0x4B, 0x2F, 0x83, 0xE7, 0xAA, 0xCE, 0x62, 0x06, 0xF8, 0x9C, 0x30, 0x54, 0x19, 0x7D, 0xD1, 0xB5, 0x72, 0x16, 0xBA, 0xDE, 0x93, 0xF7, 0x5B, 0x3F, 0xC1, 0xA5, 0x09, 0x6D, 0x20, 0x44, 0xE8, 0x8C, 0x65, 0x01, 0xAD, 0xC9, 0x84, 0xE0, 0x4C, 0x28, 0xD6, 0xB2, 0x1E, 0x7A, 0x37, 0x53, 0xFF, 0x9B, 0xB8, 0xDC, 0x70, 0x14, 0x59, 0x3D, 0x91, 0xF5, 0x0B, 0x6F, 0xC3, 0xA7, 0xEA, 0x8E, 0x22, 0x46, 0xAF, 0xCB, 0x67, 0x03, 0x4E, 0x2A, 0x86, 0xE2, 0x1C, 0x78, 0xD4, 0xB0, 0xFD, 0x99, 0x35, 0x51, 0x96, 0xF2, 0x5E, 0x3A, 0x77, 0x13, 0xBF, 0xDB, 0x25, 0x41, 0xED, 0x89, 0xC4, 0xA0, 0x0C, 0x68, 0x81, 0xE5, 0x49, 0x2D, 0x60, 0x04, 0xA8, 0xCC, 0x32, 0x56, 0xFA, 0x9E, 0xD3, 0xB7, 0x1B, 0x7F, 0xE4, 0x80, 0x2C, 0x48, 0x05, 0x61, 0xCD, 0xA9, 0x57, 0x33, 0x9F, 0xFB, 0xB6, 0xD2, 0x7E, 0x1A, 0xF3, 0x97, 0x3B, 0x5F, 0x12, 0x76, 0xDA, 0xBE, 0x40, 0x24, 0x88, 0xEC, 0xA1, 0xC5, 0x69, 0x0D, 0xCA, 0xAE, 0x02, 0x66, 0x2B, 0x4F, 0xE3, 0x87, 0x79, 0x1D, 0xB1, 0xD5, 0x98, 0xFC, 0x50, 0x34, 0xDD, 0xB9, 0x15, 0x71, 0x3C, 0x58, 0xF4, 0x90, 0x6E, 0x0A, 0xA6, 0xC2, 0x8F, 0xEB, 0x47, 0x23}, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
+        {"CRC-8/AUTOSAR", {{}, 0, 0xDF, 0xFF, crc8_autosar_calculate, (uint8_t []){0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD, 0x57, 0x78, 0x09, 0x26, 0xEB, 0xC4, 0xB5, 0x9A, 0xAE, 0x81, 0xF0, 0xDF, 0x12, 0x3D, 0x4C, 0x63, 0xF9, 0xD6, 0xA7, 0x88, 0x45, 0x6A, 0x1B, 0x34, 0x73, 0x5C, 0x2D, 0x02, 0xCF, 0xE0, 0x91, 0xBE, 0x24, 0x0B, 0x7A, 0x55, 0x98, 0xB7, 0xC6, 0xE9, 0xDD, 0xF2, 0x83, 0xAC, 0x61, 0x4E, 0x3F, 0x10, 0x8A, 0xA5, 0xD4, 0xFB, 0x36, 0x19, 0x68, 0x47, 0xE6, 0xC9, 0xB8, 0x97, 0x5A, 0x75, 0x04, 0x2B, 0xB1, 0x9E, 0xEF, 0xC0, 0x0D, 0x22, 0x53, 0x7C, 0x48, 0x67, 0x16, 0x39, 0xF4, 0xDB, 0xAA, 0x85, 0x1F, 0x30, 0x41, 0x6E, 0xA3, 0x8C, 0xFD, 0xD2, 0x95, 0xBA, 0xCB, 0xE4, 0x29, 0x06, 0x77, 0x58, 0xC2, 0xED, 0x9C, 0xB3, 0x7E, 0x51, 0x20, 0x0F, 0x3B, 0x14, 0x65, 0x4A, 0x87, 0xA8, 0xD9, 0xF6, 0x6C, 0x43, 0x32, 0x1D, 0xD0, 0xFF, 0x8E, 0xA1, 0xE3, 0xCC, 0xBD, 0x92, 0x5F, 0x70, 0x01, 0x2E, 0xB4, 0x9B, 0xEA, 0xC5, 0x08, 0x27, 0x56, 0x79, 0x4D, 0x62, 0x13, 0x3C, 0xF1, 0xDE, 0xAF, 0x80, 0x1A, 0x35, 0x44, 0x6B, 0xA6, 0x89, 0xF8, 0xD7, 0x90, 0xBF, 0xCE, 0xE1, 0x2C, 0x03, 0x72, 0x5D, 0xC7, 0xE8, 0x99, 0xB6, 0x7B, 0x54, 0x25, 0x0A, 0x3E, 0x11, 0x60, 0x4F, 0x82, 0xAD, 0xDC, 0xF3, 0x69, 0x46, 0x37, 0x18, 0xD5, 0xFA, 0x8B, 0xA4, 0x05, 0x2A, 0x5B, 0x74, 0xB9, 0x96, 0xE7, 0xC8, 0x52, 0x7D, 0x0C, 0x23, 0xEE, 0xC1, 0xB0, 0x9F, 0xAB, 0x84, 0xF5, 0xDA, 0x17, 0x38, 0x49, 0x66, 0xFC, 0xD3, 0xA2, 0x8D, 0x40, 0x6F, 0x1E, 0x31, 0x76, 0x59, 0x28, 0x07, 0xCA, 0xE5, 0x94, 0xBB, 0x21, 0x0E, 0x7F, 0x50, 0x9D, 0xB2, 0xC3, 0xEC, 0xD8, 0xF7, 0x86, 0xA9, 0x64, 0x4B, 0x3A, 0x15, 0x8F, 0xA0, 0xD1, 0xFE, 0x33, 0x1C, 0x6D, 0x42}, "CRC-8/AUTOSAR", 0x2F, false, false, 0x42, 0xFF}},
+        {"CRC-8/BLUETOOTH", {{}, 0, 0x26, 0x00, crc8_bluetooth_calculate, (uint8_t []){0x00, 0x6B, 0xD6, 0xBD, 0x67, 0x0C, 0xB1, 0xDA, 0xCE, 0xA5, 0x18, 0x73, 0xA9, 0xC2, 0x7F, 0x14, 0x57, 0x3C, 0x81, 0xEA, 0x30, 0x5B, 0xE6, 0x8D, 0x99, 0xF2, 0x4F, 0x24, 0xFE, 0x95, 0x28, 0x43, 0xAE, 0xC5, 0x78, 0x13, 0xC9, 0xA2, 0x1F, 0x74, 0x60, 0x0B, 0xB6, 0xDD, 0x07, 0x6C, 0xD1, 0xBA, 0xF9, 0x92, 0x2F, 0x44, 0x9E, 0xF5, 0x48, 0x23, 0x37, 0x5C, 0xE1, 0x8A, 0x50, 0x3B, 0x86, 0xED, 0x97, 0xFC, 0x41, 0x2A, 0xF0, 0x9B, 0x26, 0x4D, 0x59, 0x32, 0x8F, 0xE4, 0x3E, 0x55, 0xE8, 0x83, 0xC0, 0xAB, 0x16, 0x7D, 0xA7, 0xCC, 0x71, 0x1A, 0x0E, 0x65, 0xD8, 0xB3, 0x69, 0x02, 0xBF, 0xD4, 0x39, 0x52, 0xEF, 0x84, 0x5E, 0x35, 0x88, 0xE3, 0xF7, 0x9C, 0x21, 0x4A, 0x90, 0xFB, 0x46, 0x2D, 0x6E, 0x05, 0xB8, 0xD3, 0x09, 0x62, 0xDF, 0xB4, 0xA0, 0xCB, 0x76, 0x1D, 0xC7, 0xAC, 0x11, 0x7A, 0xE5, 0x8E, 0x33, 0x58, 0x82, 0xE9, 0x54, 0x3F, 0x2B, 0x40, 0xFD, 0x96, 0x4C, 0x27, 0x9A, 0xF1, 0xB2, 0xD9, 0x64, 0x0F, 0xD5, 0xBE, 0x03, 0x68, 0x7C, 0x17, 0xAA, 0xC1, 0x1B, 0x70, 0xCD, 0xA6, 0x4B, 0x20, 0x9D, 0xF6, 0x2C, 0x47, 0xFA, 0x91, 0x85, 0xEE, 0x53, 0x38, 0xE2, 0x89, 0x34, 0x5F, 0x1C, 0x77, 0xCA, 0xA1, 0x7B, 0x10, 0xAD, 0xC6, 0xD2, 0xB9, 0x04, 0x6F, 0xB5, 0xDE, 0x63, 0x08, 0x72, 0x19, 0xA4, 0xCF, 0x15, 0x7E, 0xC3, 0xA8, 0xBC, 0xD7, 0x6A, 0x01, 0xDB, 0xB0, 0x0D, 0x66, 0x25, 0x4E, 0xF3, 0x98, 0x42, 0x29, 0x94, 0xFF, 0xEB, 0x80, 0x3D, 0x56, 0x8C, 0xE7, 0x5A, 0x31, 0xDC, 0xB7, 0x0A, 0x61, 0xBB, 0xD0, 0x6D, 0x06, 0x12, 0x79, 0xC4, 0xAF, 0x75, 0x1E, 0xA3, 0xC8, 0x8B, 0xE0, 0x5D, 0x36, 0xEC, 0x87, 0x3A, 0x51, 0x45, 0x2E, 0x93, 0xF8, 0x22, 0x49, 0xF4, 0x9F}, "CRC-8/BLUETOOTH", 0xA7, true, true, 0x00, 0x00}},
+        {"CRC-8/CDMA2000", {{}, 0, 0xDA, 0xFF, crc8_cdma2000_calculate, (uint8_t []){0x00, 0x9B, 0xAD, 0x36, 0xC1, 0x5A, 0x6C, 0xF7, 0x19, 0x82, 0xB4, 0x2F, 0xD8, 0x43, 0x75, 0xEE, 0x32, 0xA9, 0x9F, 0x04, 0xF3, 0x68, 0x5E, 0xC5, 0x2B, 0xB0, 0x86, 0x1D, 0xEA, 0x71, 0x47, 0xDC, 0x64, 0xFF, 0xC9, 0x52, 0xA5, 0x3E, 0x08, 0x93, 0x7D, 0xE6, 0xD0, 0x4B, 0xBC, 0x27, 0x11, 0x8A, 0x56, 0xCD, 0xFB, 0x60, 0x97, 0x0C, 0x3A, 0xA1, 0x4F, 0xD4, 0xE2, 0x79, 0x8E, 0x15, 0x23, 0xB8, 0xC8, 0x53, 0x65, 0xFE, 0x09, 0x92, 0xA4, 0x3F, 0xD1, 0x4A, 0x7C, 0xE7, 0x10, 0x8B, 0xBD, 0x26, 0xFA, 0x61, 0x57, 0xCC, 0x3B, 0xA0, 0x96, 0x0D, 0xE3, 0x78, 0x4E, 0xD5, 0x22, 0xB9, 0x8F, 0x14, 0xAC, 0x37, 0x01, 0x9A, 0x6D, 0xF6, 0xC0, 0x5B, 0xB5, 0x2E, 0x18, 0x83, 0x74, 0xEF, 0xD9, 0x42, 0x9E, 0x05, 0x33, 0xA8, 0x5F, 0xC4, 0xF2, 0x69, 0x87, 0x1C, 0x2A, 0xB1, 0x46, 0xDD, 0xEB, 0x70, 0x0B, 0x90, 0xA6, 0x3D, 0xCA, 0x51, 0x67, 0xFC, 0x12, 0x89, 0xBF, 0x24, 0xD3, 0x48, 0x7E, 0xE5, 0x39, 0xA2, 0x94, 0x0F, 0xF8, 0x63, 0x55, 0xCE, 0x20, 0xBB, 0x8D, 0x16, 0xE1, 0x7A, 0x4C, 0xD7, 0x6F, 0xF4, 0xC2, 0x59, 0xAE, 0x35, 0x03, 0x98, 0x76, 0xED, 0xDB, 0x40, 0xB7, 0x2C, 0x1A, 0x81, 0x5D, 0xC6, 0xF0, 0x6B, 0x9C, 0x07, 0x31, 0xAA, 0x44, 0xDF, 0xE9, 0x72, 0x85, 0x1E, 0x28, 0xB3, 0xC3, 0x58, 0x6E, 0xF5, 0x02, 0x99, 0xAF, 0x34, 0xDA, 0x41, 0x77, 0xEC, 0x1B, 0x80, 0xB6, 0x2D, 0xF1, 0x6A, 0x5C, 0xC7, 0x30, 0xAB, 0x9D, 0x06, 0xE8, 0x73, 0x45, 0xDE, 0x29, 0xB2, 0x84, 0x1F, 0xA7, 0x3C, 0x0A, 0x91, 0x66, 0xFD, 0xCB, 0x50, 0xBE, 0x25, 0x13, 0x88, 0x7F, 0xE4, 0xD2, 0x49, 0x95, 0x0E, 0x38, 0xA3, 0x54, 0xCF, 0xF9, 0x62, 0x8C, 0x17, 0x21, 0xBA, 0x4D, 0xD6, 0xE0, 0x7B}, "CRC-8/CDMA2000", 0x9B, false, false, 0x00, 0x00}},
+        {"CRC-8/DARC", {{}, 0, 0x15, 0x00, crc8_darc_calculate, (uint8_t []){0x00, 0x72, 0xE4, 0x96, 0xF1, 0x83, 0x15, 0x67, 0xDB, 0xA9, 0x3F, 0x4D, 0x2A, 0x58, 0xCE, 0xBC, 0x8F, 0xFD, 0x6B, 0x19, 0x7E, 0x0C, 0x9A, 0xE8, 0x54, 0x26, 0xB0, 0xC2, 0xA5, 0xD7, 0x41, 0x33, 0x27, 0x55, 0xC3, 0xB1, 0xD6, 0xA4, 0x32, 0x40, 0xFC, 0x8E, 0x18, 0x6A, 0x0D, 0x7F, 0xE9, 0x9B, 0xA8, 0xDA, 0x4C, 0x3E, 0x59, 0x2B, 0xBD, 0xCF, 0x73, 0x01, 0x97, 0xE5, 0x82, 0xF0, 0x66, 0x14, 0x4E, 0x3C, 0xAA, 0xD8, 0xBF, 0xCD, 0x5B, 0x29, 0x95, 0xE7, 0x71, 0x03, 0x64, 0x16, 0x80, 0xF2, 0xC1, 0xB3, 0x25, 0x57, 0x30, 0x42, 0xD4, 0xA6, 0x1A, 0x68, 0xFE, 0x8C, 0xEB, 0x99, 0x0F, 0x7D, 0x69, 0x1B, 0x8D, 0xFF, 0x98, 0xEA, 0x7C, 0x0E, 0xB2, 0xC0, 0x56, 0x24, 0x43, 0x31, 0xA7, 0xD5, 0xE6, 0x94, 0x02, 0x70, 0x17, 0x65, 0xF3, 0x81, 0x3D, 0x4F, 0xD9, 0xAB, 0xCC, 0xBE, 0x28, 0x5A, 0x9C, 0xEE, 0x78, 0x0A, 0x6D, 0x1F, 0x89, 0xFB, 0x47, 0x35, 0xA3, 0xD1, 0xB6, 0xC4, 0x52, 0x20, 0x13, 0x61, 0xF7, 0x85, 0xE2, 0x90, 0x06, 0x74, 0xC8, 0xBA, 0x2C, 0x5E, 0x39, 0x4B, 0xDD, 0xAF, 0xBB, 0xC9, 0x5F, 0x2D, 0x4A, 0x38, 0xAE, 0xDC, 0x60, 0x12, 0x84, 0xF6, 0x91, 0xE3, 0x75, 0x07, 0x34, 0x46, 0xD0, 0xA2, 0xC5, 0xB7, 0x21, 0x53, 0xEF, 0x9D, 0x0B, 0x79, 0x1E, 0x6C, 0xFA, 0x88, 0xD2, 0xA0, 0x36, 0x44, 0x23, 0x51, 0xC7, 0xB5, 0x09, 0x7B, 0xED, 0x9F, 0xF8, 0x8A, 0x1C, 0x6E, 0x5D, 0x2F, 0xB9, 0xCB, 0xAC, 0xDE, 0x48, 0x3A, 0x86, 0xF4, 0x62, 0x10, 0x77, 0x05, 0x93, 0xE1, 0xF5, 0x87, 0x11, 0x63, 0x04, 0x76, 0xE0, 0x92, 0x2E, 0x5C, 0xCA, 0xB8, 0xDF, 0xAD, 0x3B, 0x49, 0x7A, 0x08, 0x9E, 0xEC, 0x8B, 0xF9, 0x6F, 0x1D, 0xA1, 0xD3, 0x45, 0x37, 0x50, 0x22, 0xB4, 0xC6}, "CRC-8/DARC", 0x39, true, true, 0x00, 0x00}},
+        {"CRC-8/DVB-S2", {{}, 0, 0xBC, 0x00, crc8_dvb_s2_calculate, (uint8_t []){0x00, 0xD5, 0x7F, 0xAA, 0xFE, 0x2B, 0x81, 0x54, 0x29, 0xFC, 0x56, 0x83, 0xD7, 0x02, 0xA8, 0x7D, 0x52, 0x87, 0x2D, 0xF8, 0xAC, 0x79, 0xD3, 0x06, 0x7B, 0xAE, 0x04, 0xD1, 0x85, 0x50, 0xFA, 0x2F, 0xA4, 0x71, 0xDB, 0x0E, 0x5A, 0x8F, 0x25, 0xF0, 0x8D, 0x58, 0xF2, 0x27, 0x73, 0xA6, 0x0C, 0xD9, 0xF6, 0x23, 0x89, 0x5C, 0x08, 0xDD, 0x77, 0xA2, 0xDF, 0x0A, 0xA0, 0x75, 0x21, 0xF4, 0x5E, 0x8B, 0x9D, 0x48, 0xE2, 0x37, 0x63, 0xB6, 0x1C, 0xC9, 0xB4, 0x61, 0xCB, 0x1E, 0x4A, 0x9F, 0x35, 0xE0, 0xCF, 0x1A, 0xB0, 0x65, 0x31, 0xE4, 0x4E, 0x9B, 0xE6, 0x33, 0x99, 0x4C, 0x18, 0xCD, 0x67, 0xB2, 0x39, 0xEC, 0x46, 0x93, 0xC7, 0x12, 0xB8, 0x6D, 0x10, 0xC5, 0x6F, 0xBA, 0xEE, 0x3B, 0x91, 0x44, 0x6B, 0xBE, 0x14, 0xC1, 0x95, 0x40, 0xEA, 0x3F, 0x42, 0x97, 0x3D, 0xE8, 0xBC, 0x69, 0xC3, 0x16, 0xEF, 0x3A, 0x90, 0x45, 0x11, 0xC4, 0x6E, 0xBB, 0xC6, 0x13, 0xB9, 0x6C, 0x38, 0xED, 0x47, 0x92, 0xBD, 0x68, 0xC2, 0x17, 0x43, 0x96, 0x3C, 0xE9, 0x94, 0x41, 0xEB, 0x3E, 0x6A, 0xBF, 0x15, 0xC0, 0x4B, 0x9E, 0x34, 0xE1, 0xB5, 0x60, 0xCA, 0x1F, 0x62, 0xB7, 0x1D, 0xC8, 0x9C, 0x49, 0xE3, 0x36, 0x19, 0xCC, 0x66, 0xB3, 0xE7, 0x32, 0x98, 0x4D, 0x30, 0xE5, 0x4F, 0x9A, 0xCE, 0x1B, 0xB1, 0x64, 0x72, 0xA7, 0x0D, 0xD8, 0x8C, 0x59, 0xF3, 0x26, 0x5B, 0x8E, 0x24, 0xF1, 0xA5, 0x70, 0xDA, 0x0F, 0x20, 0xF5, 0x5F, 0x8A, 0xDE, 0x0B, 0xA1, 0x74, 0x09, 0xDC, 0x76, 0xA3, 0xF7, 0x22, 0x88, 0x5D, 0xD6, 0x03, 0xA9, 0x7C, 0x28, 0xFD, 0x57, 0x82, 0xFF, 0x2A, 0x80, 0x55, 0x01, 0xD4, 0x7E, 0xAB, 0x84, 0x51, 0xFB, 0x2E, 0x7A, 0xAF, 0x05, 0xD0, 0xAD, 0x78, 0xD2, 0x07, 0x53, 0x86, 0x2C, 0xF9}, "CRC-8/DVB-S2", 0xD5, false, false, 0x00, 0x00}},
+        {"CRC-8/EBU", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, crc8_tech_3250_calculate, (uint8_t []){0x00, 0x64, 0xC8, 0xAC, 0xE1, 0x85, 0x29, 0x4D, 0xB3, 0xD7, 0x7B, 0x1F, 0x52, 0x36, 0x9A, 0xFE, 0x17, 0x73, 0xDF, 0xBB, 0xF6, 0x92, 0x3E, 0x5A, 0xA4, 0xC0, 0x6C, 0x08, 0x45, 0x21, 0x8D, 0xE9, 0x2E, 0x4A, 0xE6, 0x82, 0xCF, 0xAB, 0x07, 0x63, 0x9D, 0xF9, 0x55, 0x31, 0x7C, 0x18, 0xB4, 0xD0, 0x39, 0x5D, 0xF1, 0x95, 0xD8, 0xBC, 0x10, 0x74, 0x8A, 0xEE, 0x42, 0x26, 0x6B, 0x0F, 0xA3, 0xC7, 0x5C, 0x38, 0x94, 0xF0, 0xBD, 0xD9, 0x75, 0x11, 0xEF, 0x8B, 0x27, 0x43, 0x0E, 0x6A, 0xC6, 0xA2, 0x4B, 0x2F, 0x83, 0xE7, 0xAA, 0xCE, 0x62, 0x06, 0xF8, 0x9C, 0x30, 0x54, 0x19, 0x7D, 0xD1, 0xB5, 0x72, 0x16, 0xBA, 0xDE, 0x93, 0xF7, 0x5B, 0x3F, 0xC1, 0xA5, 0x09, 0x6D, 0x20, 0x44, 0xE8, 0x8C, 0x65, 0x01, 0xAD, 0xC9, 0x84, 0xE0, 0x4C, 0x28, 0xD6, 0xB2, 0x1E, 0x7A, 0x37, 0x53, 0xFF, 0x9B, 0xB8, 0xDC, 0x70, 0x14, 0x59, 0x3D, 0x91, 0xF5, 0x0B, 0x6F, 0xC3, 0xA7, 0xEA, 0x8E, 0x22, 0x46, 0xAF, 0xCB, 0x67, 0x03, 0x4E, 0x2A, 0x86, 0xE2, 0x1C, 0x78, 0xD4, 0xB0, 0xFD, 0x99, 0x35, 0x51, 0x96, 0xF2, 0x5E, 0x3A, 0x77, 0x13, 0xBF, 0xDB, 0x25, 0x41, 0xED, 0x89, 0xC4, 0xA0, 0x0C, 0x68, 0x81, 0xE5, 0x49, 0x2D, 0x60, 0x04, 0xA8, 0xCC, 0x32, 0x56, 0xFA, 0x9E, 0xD3, 0xB7, 0x1B, 0x7F, 0xE4, 0x80, 0x2C, 0x48, 0x05, 0x61, 0xCD, 0xA9, 0x57, 0x33, 0x9F, 0xFB, 0xB6, 0xD2, 0x7E, 0x1A, 0xF3, 0x97, 0x3B, 0x5F, 0x12, 0x76, 0xDA, 0xBE, 0x40, 0x24, 0x88, 0xEC, 0xA1, 0xC5, 0x69, 0x0D, 0xCA, 0xAE, 0x02, 0x66, 0x2B, 0x4F, 0xE3, 0x87, 0x79, 0x1D, 0xB1, 0xD5, 0x98, 0xFC, 0x50, 0x34, 0xDD, 0xB9, 0x15, 0x71, 0x3C, 0x58, 0xF4, 0x90, 0x6E, 0x0A, 0xA6, 0xC2, 0x8F, 0xEB, 0x47, 0x23}, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
+        {"CRC-8/GSM-A", {{}, 0, 0x37, 0x00, crc8_gsm_a_calculate, (uint8_t []){0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB, 0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76, 0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C, 0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1, 0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8, 0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65, 0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F, 0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2, 0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D, 0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50, 0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A, 0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7, 0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E, 0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43, 0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09, 0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4}, "CRC-8/GSM-A", 0x1D, false, false, 0x00, 0x00}},
+        {"CRC-8/GSM-B", {{}, 0, 0x94, 0x00, crc8_gsm_b_calculate, (uint8_t []){0x00, 0x49, 0x92, 0xDB, 0x6D, 0x24, 0xFF, 0xB6, 0xDA, 0x93, 0x48, 0x01, 0xB7, 0xFE, 0x25, 0x6C, 0xFD, 0xB4, 0x6F, 0x26, 0x90, 0xD9, 0x02, 0x4B, 0x27, 0x6E, 0xB5, 0xFC, 0x4A, 0x03, 0xD8, 0x91, 0xB3, 0xFA, 0x21, 0x68, 0xDE, 0x97, 0x4C, 0x05, 0x69, 0x20, 0xFB, 0xB2, 0x04, 0x4D, 0x96, 0xDF, 0x4E, 0x07, 0xDC, 0x95, 0x23, 0x6A, 0xB1, 0xF8, 0x94, 0xDD, 0x06, 0x4F, 0xF9, 0xB0, 0x6B, 0x22, 0x2F, 0x66, 0xBD, 0xF4, 0x42, 0x0B, 0xD0, 0x99, 0xF5, 0xBC, 0x67, 0x2E, 0x98, 0xD1, 0x0A, 0x43, 0xD2, 0x9B, 0x40, 0x09, 0xBF, 0xF6, 0x2D, 0x64, 0x08, 0x41, 0x9A, 0xD3, 0x65, 0x2C, 0xF7, 0xBE, 0x9C, 0xD5, 0x0E, 0x47, 0xF1, 0xB8, 0x63, 0x2A, 0x46, 0x0F, 0xD4, 0x9D, 0x2B, 0x62, 0xB9, 0xF0, 0x61, 0x28, 0xF3, 0xBA, 0x0C, 0x45, 0x9E, 0xD7, 0xBB, 0xF2, 0x29, 0x60, 0xD6, 0x9F, 0x44, 0x0D, 0x5E, 0x17, 0xCC, 0x85, 0x33, 0x7A, 0xA1, 0xE8, 0x84, 0xCD, 0x16, 0x5F, 0xE9, 0xA0, 0x7B, 0x32, 0xA3, 0xEA, 0x31, 0x78, 0xCE, 0x87, 0x5C, 0x15, 0x79, 0x30, 0xEB, 0xA2, 0x14, 0x5D, 0x86, 0xCF, 0xED, 0xA4, 0x7F, 0x36, 0x80, 0xC9, 0x12, 0x5B, 0x37, 0x7E, 0xA5, 0xEC, 0x5A, 0x13, 0xC8, 0x81, 0x10, 0x59, 0x82, 0xCB, 0x7D, 0x34, 0xEF, 0xA6, 0xCA, 0x83, 0x58, 0x11, 0xA7, 0xEE, 0x35, 0x7C, 0x71, 0x38, 0xE3, 0xAA, 0x1C, 0x55, 0x8E, 0xC7, 0xAB, 0xE2, 0x39, 0x70, 0xC6, 0x8F, 0x54, 0x1D, 0x8C, 0xC5, 0x1E, 0x57, 0xE1, 0xA8, 0x73, 0x3A, 0x56, 0x1F, 0xC4, 0x8D, 0x3B, 0x72, 0xA9, 0xE0, 0xC2, 0x8B, 0x50, 0x19, 0xAF, 0xE6, 0x3D, 0x74, 0x18, 0x51, 0x8A, 0xC3, 0x75, 0x3C, 0xE7, 0xAE, 0x3F, 0x76, 0xAD, 0xE4, 0x52, 0x1B, 0xC0, 0x89, 0xE5, 0xAC, 0x77, 0x3E, 0x88, 0xC1, 0x1A, 0x53}, "CRC-8/GSM-B", 0x49, false, false, 0x53, 0xFF}},
+        {"CRC-8/HITAG", {{}, 0, 0xB4, 0xFF, crc8_hitag_calculate, (uint8_t []){0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB, 0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76, 0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C, 0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1, 0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8, 0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65, 0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F, 0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2, 0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D, 0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50, 0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A, 0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7, 0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E, 0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43, 0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09, 0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4}, "CRC-8/HITAG", 0x1D, false, false, 0x00, 0x00}},
+        {"CRC-8/I-432-1", {{"CRC-8/ITU"}, 1, 0xA1, 0x00, crc8_i_432_1_calculate, (uint8_t []){0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD, 0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A, 0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4, 0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34, 0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83, 0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3}, "CRC-8/I-432-1", 0x07, false, false, 0xAC, 0x55}},
+        {"CRC-8/I-CODE", {{}, 0, 0x7E, 0xFD, crc8_i_code_calculate, (uint8_t []){0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB, 0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76, 0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C, 0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1, 0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8, 0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65, 0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F, 0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2, 0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D, 0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50, 0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A, 0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7, 0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E, 0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43, 0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09, 0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4}, "CRC-8/I-CODE", 0x1D, false, false, 0x00, 0x00}},
+        {"CRC-8/ITU", {{"CRC-8/ITU"}, 1, 0xA1, 0x00, crc8_i_432_1_calculate, (uint8_t []){0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD, 0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A, 0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4, 0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34, 0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83, 0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3}, "CRC-8/I-432-1", 0x07, false, false, 0xAC, 0x55}},
+        {"CRC-8/LTE", {{}, 0, 0xEA, 0x00, crc8_lte_calculate, (uint8_t []){0x00, 0x9B, 0xAD, 0x36, 0xC1, 0x5A, 0x6C, 0xF7, 0x19, 0x82, 0xB4, 0x2F, 0xD8, 0x43, 0x75, 0xEE, 0x32, 0xA9, 0x9F, 0x04, 0xF3, 0x68, 0x5E, 0xC5, 0x2B, 0xB0, 0x86, 0x1D, 0xEA, 0x71, 0x47, 0xDC, 0x64, 0xFF, 0xC9, 0x52, 0xA5, 0x3E, 0x08, 0x93, 0x7D, 0xE6, 0xD0, 0x4B, 0xBC, 0x27, 0x11, 0x8A, 0x56, 0xCD, 0xFB, 0x60, 0x97, 0x0C, 0x3A, 0xA1, 0x4F, 0xD4, 0xE2, 0x79, 0x8E, 0x15, 0x23, 0xB8, 0xC8, 0x53, 0x65, 0xFE, 0x09, 0x92, 0xA4, 0x3F, 0xD1, 0x4A, 0x7C, 0xE7, 0x10, 0x8B, 0xBD, 0x26, 0xFA, 0x61, 0x57, 0xCC, 0x3B, 0xA0, 0x96, 0x0D, 0xE3, 0x78, 0x4E, 0xD5, 0x22, 0xB9, 0x8F, 0x14, 0xAC, 0x37, 0x01, 0x9A, 0x6D, 0xF6, 0xC0, 0x5B, 0xB5, 0x2E, 0x18, 0x83, 0x74, 0xEF, 0xD9, 0x42, 0x9E, 0x05, 0x33, 0xA8, 0x5F, 0xC4, 0xF2, 0x69, 0x87, 0x1C, 0x2A, 0xB1, 0x46, 0xDD, 0xEB, 0x70, 0x0B, 0x90, 0xA6, 0x3D, 0xCA, 0x51, 0x67, 0xFC, 0x12, 0x89, 0xBF, 0x24, 0xD3, 0x48, 0x7E, 0xE5, 0x39, 0xA2, 0x94, 0x0F, 0xF8, 0x63, 0x55, 0xCE, 0x20, 0xBB, 0x8D, 0x16, 0xE1, 0x7A, 0x4C, 0xD7, 0x6F, 0xF4, 0xC2, 0x59, 0xAE, 0x35, 0x03, 0x98, 0x76, 0xED, 0xDB, 0x40, 0xB7, 0x2C, 0x1A, 0x81, 0x5D, 0xC6, 0xF0, 0x6B, 0x9C, 0x07, 0x31, 0xAA, 0x44, 0xDF, 0xE9, 0x72, 0x85, 0x1E, 0x28, 0xB3, 0xC3, 0x58, 0x6E, 0xF5, 0x02, 0x99, 0xAF, 0x34, 0xDA, 0x41, 0x77, 0xEC, 0x1B, 0x80, 0xB6, 0x2D, 0xF1, 0x6A, 0x5C, 0xC7, 0x30, 0xAB, 0x9D, 0x06, 0xE8, 0x73, 0x45, 0xDE, 0x29, 0xB2, 0x84, 0x1F, 0xA7, 0x3C, 0x0A, 0x91, 0x66, 0xFD, 0xCB, 0x50, 0xBE, 0x25, 0x13, 0x88, 0x7F, 0xE4, 0xD2, 0x49, 0x95, 0x0E, 0x38, 0xA3, 0x54, 0xCF, 0xF9, 0x62, 0x8C, 0x17, 0x21, 0xBA, 0x4D, 0xD6, 0xE0, 0x7B}, "CRC-8/LTE", 0x9B, false, false, 0x00, 0x00}},
+        {"CRC-8/MAXIM", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, crc8_maxim_dow_calculate, (uint8_t []){0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41, 0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E, 0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC, 0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0, 0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62, 0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D, 0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF, 0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5, 0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07, 0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58, 0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A, 0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6, 0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24, 0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B, 0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9, 0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F, 0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD, 0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92, 0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50, 0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C, 0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE, 0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1, 0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73, 0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49, 0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B, 0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4, 0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16, 0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A, 0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8, 0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7, 0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35}, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}},
+        {"CRC-8/MAXIM-DOW", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, crc8_maxim_dow_calculate, (uint8_t []){0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41, 0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E, 0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC, 0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0, 0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62, 0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D, 0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF, 0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5, 0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07, 0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58, 0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A, 0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6, 0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24, 0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B, 0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9, 0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F, 0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD, 0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92, 0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50, 0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C, 0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE, 0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1, 0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73, 0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49, 0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B, 0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4, 0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16, 0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A, 0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8, 0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7, 0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35}, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}},
+        {"CRC-8/MIFARE-MAD", {{}, 0, 0x99, 0xC7, crc8_mifare_mad_calculate, (uint8_t []){0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB, 0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76, 0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C, 0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1, 0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8, 0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65, 0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F, 0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2, 0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D, 0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50, 0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A, 0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7, 0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E, 0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43, 0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09, 0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4}, "CRC-8/MIFARE-MAD", 0x1D, false, false, 0x00, 0x00}},
+        {"CRC-8/NRSC-5", {{}, 0, 0xF7, 0xFF, crc8_nrsc_5_calculate, (uint8_t []){0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0xB9, 0x88, 0xDB, 0xEA, 0x7D, 0x4C, 0x1F, 0x2E, 0x43, 0x72, 0x21, 0x10, 0x87, 0xB6, 0xE5, 0xD4, 0xFA, 0xCB, 0x98, 0xA9, 0x3E, 0x0F, 0x5C, 0x6D, 0x86, 0xB7, 0xE4, 0xD5, 0x42, 0x73, 0x20, 0x11, 0x3F, 0x0E, 0x5D, 0x6C, 0xFB, 0xCA, 0x99, 0xA8, 0xC5, 0xF4, 0xA7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7C, 0x4D, 0x1E, 0x2F, 0xB8, 0x89, 0xDA, 0xEB, 0x3D, 0x0C, 0x5F, 0x6E, 0xF9, 0xC8, 0x9B, 0xAA, 0x84, 0xB5, 0xE6, 0xD7, 0x40, 0x71, 0x22, 0x13, 0x7E, 0x4F, 0x1C, 0x2D, 0xBA, 0x8B, 0xD8, 0xE9, 0xC7, 0xF6, 0xA5, 0x94, 0x03, 0x32, 0x61, 0x50, 0xBB, 0x8A, 0xD9, 0xE8, 0x7F, 0x4E, 0x1D, 0x2C, 0x02, 0x33, 0x60, 0x51, 0xC6, 0xF7, 0xA4, 0x95, 0xF8, 0xC9, 0x9A, 0xAB, 0x3C, 0x0D, 0x5E, 0x6F, 0x41, 0x70, 0x23, 0x12, 0x85, 0xB4, 0xE7, 0xD6, 0x7A, 0x4B, 0x18, 0x29, 0xBE, 0x8F, 0xDC, 0xED, 0xC3, 0xF2, 0xA1, 0x90, 0x07, 0x36, 0x65, 0x54, 0x39, 0x08, 0x5B, 0x6A, 0xFD, 0xCC, 0x9F, 0xAE, 0x80, 0xB1, 0xE2, 0xD3, 0x44, 0x75, 0x26, 0x17, 0xFC, 0xCD, 0x9E, 0xAF, 0x38, 0x09, 0x5A, 0x6B, 0x45, 0x74, 0x27, 0x16, 0x81, 0xB0, 0xE3, 0xD2, 0xBF, 0x8E, 0xDD, 0xEC, 0x7B, 0x4A, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xC2, 0xF3, 0xA0, 0x91, 0x47, 0x76, 0x25, 0x14, 0x83, 0xB2, 0xE1, 0xD0, 0xFE, 0xCF, 0x9C, 0xAD, 0x3A, 0x0B, 0x58, 0x69, 0x04, 0x35, 0x66, 0x57, 0xC0, 0xF1, 0xA2, 0x93, 0xBD, 0x8C, 0xDF, 0xEE, 0x79, 0x48, 0x1B, 0x2A, 0xC1, 0xF0, 0xA3, 0x92, 0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1A, 0x2B, 0xBC, 0x8D, 0xDE, 0xEF, 0x82, 0xB3, 0xE0, 0xD1, 0x46, 0x77, 0x24, 0x15, 0x3B, 0x0A, 0x59, 0x68, 0xFF, 0xCE, 0x9D, 0xAC}, "CRC-8/NRSC-5", 0x31, false, false, 0x00, 0x00}},
+        {"CRC-8/OPENSAFETY", {{}, 0, 0x3E, 0x00, crc8_opensafety_calculate, (uint8_t []){0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD, 0x57, 0x78, 0x09, 0x26, 0xEB, 0xC4, 0xB5, 0x9A, 0xAE, 0x81, 0xF0, 0xDF, 0x12, 0x3D, 0x4C, 0x63, 0xF9, 0xD6, 0xA7, 0x88, 0x45, 0x6A, 0x1B, 0x34, 0x73, 0x5C, 0x2D, 0x02, 0xCF, 0xE0, 0x91, 0xBE, 0x24, 0x0B, 0x7A, 0x55, 0x98, 0xB7, 0xC6, 0xE9, 0xDD, 0xF2, 0x83, 0xAC, 0x61, 0x4E, 0x3F, 0x10, 0x8A, 0xA5, 0xD4, 0xFB, 0x36, 0x19, 0x68, 0x47, 0xE6, 0xC9, 0xB8, 0x97, 0x5A, 0x75, 0x04, 0x2B, 0xB1, 0x9E, 0xEF, 0xC0, 0x0D, 0x22, 0x53, 0x7C, 0x48, 0x67, 0x16, 0x39, 0xF4, 0xDB, 0xAA, 0x85, 0x1F, 0x30, 0x41, 0x6E, 0xA3, 0x8C, 0xFD, 0xD2, 0x95, 0xBA, 0xCB, 0xE4, 0x29, 0x06, 0x77, 0x58, 0xC2, 0xED, 0x9C, 0xB3, 0x7E, 0x51, 0x20, 0x0F, 0x3B, 0x14, 0x65, 0x4A, 0x87, 0xA8, 0xD9, 0xF6, 0x6C, 0x43, 0x32, 0x1D, 0xD0, 0xFF, 0x8E, 0xA1, 0xE3, 0xCC, 0xBD, 0x92, 0x5F, 0x70, 0x01, 0x2E, 0xB4, 0x9B, 0xEA, 0xC5, 0x08, 0x27, 0x56, 0x79, 0x4D, 0x62, 0x13, 0x3C, 0xF1, 0xDE, 0xAF, 0x80, 0x1A, 0x35, 0x44, 0x6B, 0xA6, 0x89, 0xF8, 0xD7, 0x90, 0xBF, 0xCE, 0xE1, 0x2C, 0x03, 0x72, 0x5D, 0xC7, 0xE8, 0x99, 0xB6, 0x7B, 0x54, 0x25, 0x0A, 0x3E, 0x11, 0x60, 0x4F, 0x82, 0xAD, 0xDC, 0xF3, 0x69, 0x46, 0x37, 0x18, 0xD5, 0xFA, 0x8B, 0xA4, 0x05, 0x2A, 0x5B, 0x74, 0xB9, 0x96, 0xE7, 0xC8, 0x52, 0x7D, 0x0C, 0x23, 0xEE, 0xC1, 0xB0, 0x9F, 0xAB, 0x84, 0xF5, 0xDA, 0x17, 0x38, 0x49, 0x66, 0xFC, 0xD3, 0xA2, 0x8D, 0x40, 0x6F, 0x1E, 0x31, 0x76, 0x59, 0x28, 0x07, 0xCA, 0xE5, 0x94, 0xBB, 0x21, 0x0E, 0x7F, 0x50, 0x9D, 0xB2, 0xC3, 0xEC, 0xD8, 0xF7, 0x86, 0xA9, 0x64, 0x4B, 0x3A, 0x15, 0x8F, 0xA0, 0xD1, 0xFE, 0x33, 0x1C, 0x6D, 0x42}, "CRC-8/OPENSAFETY", 0x2F, false, false, 0x00, 0x00}},
+        {"CRC-8/ROHC", {{}, 0, 0xD0, 0xFF, crc8_rohc_calculate, (uint8_t []){0x00, 0x91, 0xE3, 0x72, 0x07, 0x96, 0xE4, 0x75, 0x0E, 0x9F, 0xED, 0x7C, 0x09, 0x98, 0xEA, 0x7B, 0x1C, 0x8D, 0xFF, 0x6E, 0x1B, 0x8A, 0xF8, 0x69, 0x12, 0x83, 0xF1, 0x60, 0x15, 0x84, 0xF6, 0x67, 0x38, 0xA9, 0xDB, 0x4A, 0x3F, 0xAE, 0xDC, 0x4D, 0x36, 0xA7, 0xD5, 0x44, 0x31, 0xA0, 0xD2, 0x43, 0x24, 0xB5, 0xC7, 0x56, 0x23, 0xB2, 0xC0, 0x51, 0x2A, 0xBB, 0xC9, 0x58, 0x2D, 0xBC, 0xCE, 0x5F, 0x70, 0xE1, 0x93, 0x02, 0x77, 0xE6, 0x94, 0x05, 0x7E, 0xEF, 0x9D, 0x0C, 0x79, 0xE8, 0x9A, 0x0B, 0x6C, 0xFD, 0x8F, 0x1E, 0x6B, 0xFA, 0x88, 0x19, 0x62, 0xF3, 0x81, 0x10, 0x65, 0xF4, 0x86, 0x17, 0x48, 0xD9, 0xAB, 0x3A, 0x4F, 0xDE, 0xAC, 0x3D, 0x46, 0xD7, 0xA5, 0x34, 0x41, 0xD0, 0xA2, 0x33, 0x54, 0xC5, 0xB7, 0x26, 0x53, 0xC2, 0xB0, 0x21, 0x5A, 0xCB, 0xB9, 0x28, 0x5D, 0xCC, 0xBE, 0x2F, 0xE0, 0x71, 0x03, 0x92, 0xE7, 0x76, 0x04, 0x95, 0xEE, 0x7F, 0x0D, 0x9C, 0xE9, 0x78, 0x0A, 0x9B, 0xFC, 0x6D, 0x1F, 0x8E, 0xFB, 0x6A, 0x18, 0x89, 0xF2, 0x63, 0x11, 0x80, 0xF5, 0x64, 0x16, 0x87, 0xD8, 0x49, 0x3B, 0xAA, 0xDF, 0x4E, 0x3C, 0xAD, 0xD6, 0x47, 0x35, 0xA4, 0xD1, 0x40, 0x32, 0xA3, 0xC4, 0x55, 0x27, 0xB6, 0xC3, 0x52, 0x20, 0xB1, 0xCA, 0x5B, 0x29, 0xB8, 0xCD, 0x5C, 0x2E, 0xBF, 0x90, 0x01, 0x73, 0xE2, 0x97, 0x06, 0x74, 0xE5, 0x9E, 0x0F, 0x7D, 0xEC, 0x99, 0x08, 0x7A, 0xEB, 0x8C, 0x1D, 0x6F, 0xFE, 0x8B, 0x1A, 0x68, 0xF9, 0x82, 0x13, 0x61, 0xF0, 0x85, 0x14, 0x66, 0xF7, 0xA8, 0x39, 0x4B, 0xDA, 0xAF, 0x3E, 0x4C, 0xDD, 0xA6, 0x37, 0x45, 0xD4, 0xA1, 0x30, 0x42, 0xD3, 0xB4, 0x25, 0x57, 0xC6, 0xB3, 0x22, 0x50, 0xC1, 0xBA, 0x2B, 0x59, 0xC8, 0xBD, 0x2C, 0x5E, 0xCF}, "CRC-8/ROHC", 0x07, true, true, 0x00, 0x00}},
+        {"CRC-8/SAE-J1850", {{}, 0, 0x4B, 0xFF, crc8_sae_j1850_calculate, (uint8_t []){0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB, 0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76, 0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C, 0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1, 0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8, 0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65, 0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F, 0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2, 0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D, 0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50, 0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A, 0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7, 0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E, 0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43, 0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09, 0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4}, "CRC-8/SAE-J1850", 0x1D, false, false, 0xC4, 0xFF}},
+        {"CRC-8/SMBUS", {{"CRC-8"}, 1, 0xF4, 0x00, crc8_smbus_calculate, (uint8_t []){0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD, 0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A, 0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4, 0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34, 0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83, 0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3}, "CRC-8/SMBUS", 0x07, false, false, 0x00, 0x00}},
+        {"CRC-8/TECH-3250", {{"CRC-8/AES", "CRC-8/EBU"}, 2, 0x97, 0xFF, crc8_tech_3250_calculate, (uint8_t []){0x00, 0x64, 0xC8, 0xAC, 0xE1, 0x85, 0x29, 0x4D, 0xB3, 0xD7, 0x7B, 0x1F, 0x52, 0x36, 0x9A, 0xFE, 0x17, 0x73, 0xDF, 0xBB, 0xF6, 0x92, 0x3E, 0x5A, 0xA4, 0xC0, 0x6C, 0x08, 0x45, 0x21, 0x8D, 0xE9, 0x2E, 0x4A, 0xE6, 0x82, 0xCF, 0xAB, 0x07, 0x63, 0x9D, 0xF9, 0x55, 0x31, 0x7C, 0x18, 0xB4, 0xD0, 0x39, 0x5D, 0xF1, 0x95, 0xD8, 0xBC, 0x10, 0x74, 0x8A, 0xEE, 0x42, 0x26, 0x6B, 0x0F, 0xA3, 0xC7, 0x5C, 0x38, 0x94, 0xF0, 0xBD, 0xD9, 0x75, 0x11, 0xEF, 0x8B, 0x27, 0x43, 0x0E, 0x6A, 0xC6, 0xA2, 0x4B, 0x2F, 0x83, 0xE7, 0xAA, 0xCE, 0x62, 0x06, 0xF8, 0x9C, 0x30, 0x54, 0x19, 0x7D, 0xD1, 0xB5, 0x72, 0x16, 0xBA, 0xDE, 0x93, 0xF7, 0x5B, 0x3F, 0xC1, 0xA5, 0x09, 0x6D, 0x20, 0x44, 0xE8, 0x8C, 0x65, 0x01, 0xAD, 0xC9, 0x84, 0xE0, 0x4C, 0x28, 0xD6, 0xB2, 0x1E, 0x7A, 0x37, 0x53, 0xFF, 0x9B, 0xB8, 0xDC, 0x70, 0x14, 0x59, 0x3D, 0x91, 0xF5, 0x0B, 0x6F, 0xC3, 0xA7, 0xEA, 0x8E, 0x22, 0x46, 0xAF, 0xCB, 0x67, 0x03, 0x4E, 0x2A, 0x86, 0xE2, 0x1C, 0x78, 0xD4, 0xB0, 0xFD, 0x99, 0x35, 0x51, 0x96, 0xF2, 0x5E, 0x3A, 0x77, 0x13, 0xBF, 0xDB, 0x25, 0x41, 0xED, 0x89, 0xC4, 0xA0, 0x0C, 0x68, 0x81, 0xE5, 0x49, 0x2D, 0x60, 0x04, 0xA8, 0xCC, 0x32, 0x56, 0xFA, 0x9E, 0xD3, 0xB7, 0x1B, 0x7F, 0xE4, 0x80, 0x2C, 0x48, 0x05, 0x61, 0xCD, 0xA9, 0x57, 0x33, 0x9F, 0xFB, 0xB6, 0xD2, 0x7E, 0x1A, 0xF3, 0x97, 0x3B, 0x5F, 0x12, 0x76, 0xDA, 0xBE, 0x40, 0x24, 0x88, 0xEC, 0xA1, 0xC5, 0x69, 0x0D, 0xCA, 0xAE, 0x02, 0x66, 0x2B, 0x4F, 0xE3, 0x87, 0x79, 0x1D, 0xB1, 0xD5, 0x98, 0xFC, 0x50, 0x34, 0xDD, 0xB9, 0x15, 0x71, 0x3C, 0x58, 0xF4, 0x90, 0x6E, 0x0A, 0xA6, 0xC2, 0x8F, 0xEB, 0x47, 0x23}, "CRC-8/TECH-3250", 0x1D, true, true, 0x00, 0x00}},
+        {"CRC-8/WCDMA", {{}, 0, 0x25, 0x00, crc8_wcdma_calculate, (uint8_t []){0x00, 0xD0, 0x13, 0xC3, 0x26, 0xF6, 0x35, 0xE5, 0x4C, 0x9C, 0x5F, 0x8F, 0x6A, 0xBA, 0x79, 0xA9, 0x98, 0x48, 0x8B, 0x5B, 0xBE, 0x6E, 0xAD, 0x7D, 0xD4, 0x04, 0xC7, 0x17, 0xF2, 0x22, 0xE1, 0x31, 0x83, 0x53, 0x90, 0x40, 0xA5, 0x75, 0xB6, 0x66, 0xCF, 0x1F, 0xDC, 0x0C, 0xE9, 0x39, 0xFA, 0x2A, 0x1B, 0xCB, 0x08, 0xD8, 0x3D, 0xED, 0x2E, 0xFE, 0x57, 0x87, 0x44, 0x94, 0x71, 0xA1, 0x62, 0xB2, 0xB5, 0x65, 0xA6, 0x76, 0x93, 0x43, 0x80, 0x50, 0xF9, 0x29, 0xEA, 0x3A, 0xDF, 0x0F, 0xCC, 0x1C, 0x2D, 0xFD, 0x3E, 0xEE, 0x0B, 0xDB, 0x18, 0xC8, 0x61, 0xB1, 0x72, 0xA2, 0x47, 0x97, 0x54, 0x84, 0x36, 0xE6, 0x25, 0xF5, 0x10, 0xC0, 0x03, 0xD3, 0x7A, 0xAA, 0x69, 0xB9, 0x5C, 0x8C, 0x4F, 0x9F, 0xAE, 0x7E, 0xBD, 0x6D, 0x88, 0x58, 0x9B, 0x4B, 0xE2, 0x32, 0xF1, 0x21, 0xC4, 0x14, 0xD7, 0x07, 0xD9, 0x09, 0xCA, 0x1A, 0xFF, 0x2F, 0xEC, 0x3C, 0x95, 0x45, 0x86, 0x56, 0xB3, 0x63, 0xA0, 0x70, 0x41, 0x91, 0x52, 0x82, 0x67, 0xB7, 0x74, 0xA4, 0x0D, 0xDD, 0x1E, 0xCE, 0x2B, 0xFB, 0x38, 0xE8, 0x5A, 0x8A, 0x49, 0x99, 0x7C, 0xAC, 0x6F, 0xBF, 0x16, 0xC6, 0x05, 0xD5, 0x30, 0xE0, 0x23, 0xF3, 0xC2, 0x12, 0xD1, 0x01, 0xE4, 0x34, 0xF7, 0x27, 0x8E, 0x5E, 0x9D, 0x4D, 0xA8, 0x78, 0xBB, 0x6B, 0x6C, 0xBC, 0x7F, 0xAF, 0x4A, 0x9A, 0x59, 0x89, 0x20, 0xF0, 0x33, 0xE3, 0x06, 0xD6, 0x15, 0xC5, 0xF4, 0x24, 0xE7, 0x37, 0xD2, 0x02, 0xC1, 0x11, 0xB8, 0x68, 0xAB, 0x7B, 0x9E, 0x4E, 0x8D, 0x5D, 0xEF, 0x3F, 0xFC, 0x2C, 0xC9, 0x19, 0xDA, 0x0A, 0xA3, 0x73, 0xB0, 0x60, 0x85, 0x55, 0x96, 0x46, 0x77, 0xA7, 0x64, 0xB4, 0x51, 0x81, 0x42, 0x92, 0x3B, 0xEB, 0x28, 0xF8, 0x1D, 0xCD, 0x0E, 0xDE}, "CRC-8/WCDMA", 0x9B, true, true, 0x00, 0x00}},
+        {"DOW-CRC", {{"CRC-8/MAXIM", "DOW-CRC"}, 2, 0xA1, 0x00, crc8_maxim_dow_calculate, (uint8_t []){0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41, 0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E, 0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC, 0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0, 0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62, 0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D, 0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF, 0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5, 0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07, 0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58, 0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A, 0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6, 0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24, 0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B, 0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9, 0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F, 0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD, 0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92, 0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50, 0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C, 0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE, 0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1, 0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73, 0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49, 0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B, 0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4, 0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16, 0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A, 0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8, 0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7, 0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35}, "CRC-8/MAXIM-DOW", 0x31, true, true, 0x00, 0x00}}
     };
     const size_t TestDataCount = sizeof(TestData) / sizeof(TestData[0]);
 
     /* Variable */
     crc8_configuration_t actualConfiguration;
-    void *memory;
 
     /*** Initialize ***/
     for(size_t i = 0; i < TestDataCount; i++)
     {
-        /* Set Up */
-        memory = malloc(CRC8_LOOKUP_TABLE_MEMORY_SIZE);
-
-        /* Mock */
-    	memory_malloc_ExpectAndReturn(CRC8_LOOKUP_TABLE_MEMORY_SIZE, memory);
-
         /* Initialize */
         crc8_init(TestData[i].Name, &actualConfiguration, true); // true (Lookup Table)
 
@@ -533,6 +948,7 @@ void test_init_6(void)
         	TEST_ASSERT_EQUAL_STRING(TestData[i].expectedConfiguration.Alias[j], actualConfiguration.Alias[j]);
         TEST_ASSERT_EQUAL_HEX8(TestData[i].expectedConfiguration.check, actualConfiguration.check);
         TEST_ASSERT_EQUAL_HEX8(TestData[i].expectedConfiguration.initial, actualConfiguration.initial);
+        TEST_ASSERT_EQUAL_PTR(TestData[i].expectedConfiguration.kernel, actualConfiguration.kernel);
         TEST_ASSERT_NOT_NULL(actualConfiguration.lookupTable);
         TEST_ASSERT_EQUAL_HEX8_ARRAY(TestData[i].expectedConfiguration.lookupTable, actualConfiguration.lookupTable, CRC8_LOOKUP_TABLE_COUNT);
         TEST_ASSERT_EQUAL_STRING(TestData[i].expectedConfiguration.Name, actualConfiguration.Name);
@@ -541,12 +957,127 @@ void test_init_6(void)
         TEST_ASSERT_EQUAL_INT(TestData[i].expectedConfiguration.reflectOut, actualConfiguration.reflectOut);
         TEST_ASSERT_EQUAL_HEX8(TestData[i].expectedConfiguration.residue, actualConfiguration.residue);
         TEST_ASSERT_EQUAL_HEX8(TestData[i].expectedConfiguration.xorOut, actualConfiguration.xorOut);
+    }
+}
+
+void test_init_7(void)
+{
+    /*** Initialize (Tier Override) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+
+    /* Tier Override (Loop) */
+    crc_tierSet(CRC_TIER_LOOP);
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+    TEST_ASSERT_NULL(configuration.lookupTable);
+    TEST_ASSERT_NULL(configuration.kernel);
+    TEST_ASSERT_EQUAL_HEX8(configuration.check, crc8_calculate(&configuration, test_CheckData, sizeof(test_CheckData)));
+
+    /* Tier Override (Lookup Table) */
+    crc_tierSet(CRC_TIER_LOOKUP_TABLE);
+    crc8_init("CRC-8/SMBUS", &configuration, false); // false (Loop)
+    TEST_ASSERT_NOT_NULL(configuration.lookupTable);
+    TEST_ASSERT_NOT_NULL(configuration.kernel);
+    TEST_ASSERT_EQUAL_HEX8(configuration.check, crc8_calculate(&configuration, test_CheckData, sizeof(test_CheckData)));
+}
+
+/*** Patch ***/
+void test_patch_1(void)
+{
+    /*** Patch (NULL Pointer, Out Of Range) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    const uint8_t NewData[2] = {0x12, 0x34};
+    const uint8_t OldData[2] = {0x56, 0x78};
+
+    /* Set Up */
+    crc8_init("CRC-8/AUTOSAR", &configuration, true);
+
+    /* Patch (Old CRC Returned Unchanged) */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc8_patch(NULL, 0x5A, 0, OldData, NewData, sizeof(NewData), 10));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc8_patch(&configuration, 0x5A, 0, NULL, NewData, sizeof(NewData), 10));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc8_patch(&configuration, 0x5A, 0, OldData, NULL, sizeof(NewData), 10));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc8_patch(&configuration, 0x5A, 9, OldData, NewData, sizeof(NewData), 10));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc8_patch(&configuration, 0x5A, 11, OldData, NewData, 0, 10));
+}
+
+void test_patch_2(void)
+{
+    /*** Patch (Matches Recalculating The Whole Frame) ***/
+    /* Type Definition */
+    typedef struct testData_s
+    {
+        const char *Name;
+        bool engine;
+    } testData_t;
+
+    /* Variable */
+    crc8_configuration_t configuration;
+    uint8_t frame[3000];
+    uint8_t oldData[100];
+    uint8_t oldCrc;
+    const size_t Offset[] = {0, 1, 17, 2900, 2999};
+    const size_t PatchLength[] = {1, 4, 100, 100, 1};
+    const testData_t TestData[] =
+    {
+        {"CRC-8/AUTOSAR", false},
+        {"CRC-8/AUTOSAR", true},
+        {"CRC-8/BLUETOOTH", false},
+        {"CRC-8/BLUETOOTH", true},
+        {"CRC-8/SMBUS", false},
+        {"CRC-8/SMBUS", true},
+    };
 
-        /* Clean Up */
-        free(memory);
+    /* Patch */
+    for(size_t i = 0; i < (sizeof(TestData) / sizeof(testData_t)); i++)
+    {
+        crc8_init(TestData[i].Name, &configuration, TestData[i].engine);
+        random_buffer(frame, sizeof(frame));
+        for(size_t j = 0; j < (sizeof(Offset) / sizeof(Offset[0])); j++)
+        {
+            oldCrc = crc8_calculate(&configuration, frame, sizeof(frame));
+            memcpy(oldData, frame + Offset[j], PatchLength[j]);
+            random_buffer(frame + Offset[j], PatchLength[j]);
+            TEST_ASSERT_EQUAL_HEX8(crc8_calculate(&configuration, frame, sizeof(frame)), crc8_patch(&configuration, oldCrc, Offset[j], oldData, frame + Offset[j], PatchLength[j], sizeof(frame)));
+        }
     }
 }
 
+/*** Snapshot ***/
+void test_snapshot_1(void)
+{
+    /*** Snapshot (NULL Pointer) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    crc8_context_t snapshot;
+
+    /* Set Up */
+    crc8_init("CRC-8/AUTOSAR", &configuration, true);
+    memset(&snapshot, 0, sizeof(snapshot));
+
+    /* Snapshot */
+    crc8_snapshot(NULL, test_CheckData, sizeof(test_CheckData), &snapshot);
+    crc8_snapshot(&configuration, NULL, sizeof(test_CheckData), &snapshot);
+    crc8_snapshot(&configuration, test_CheckData, sizeof(test_CheckData), NULL);
+    TEST_ASSERT_NULL(snapshot.Configuration);
+}
+
+void test_snapshot_2(void)
+{
+    /*** Snapshot (Empty Prefix) ***/
+    /* Variable */
+    crc8_configuration_t configuration;
+    crc8_context_t snapshot;
+
+    /* Set Up */
+    crc8_init("CRC-8/AUTOSAR", &configuration, true);
+
+    /* Snapshot */
+    crc8_snapshot(&configuration, NULL, 0, &snapshot);
+    TEST_ASSERT_EQUAL_HEX8(configuration.initial, crc8_fork(&snapshot, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX8(configuration.check, crc8_fork(&snapshot, test_CheckData, sizeof(test_CheckData)));
+}
+
 /*** Verify ***/
 void test_verify_1(void)
 {
@@ -603,17 +1134,10 @@ void test_verify_4(void)
     /* Variable */
     crc8_configuration_t configuration;
     uint8_t buffer[128 + sizeof(uint8_t)];
-    void *memory;
 
     /* Calculate */
     for(size_t i = 0; i < CrcNameCount; i++)
     {
-        /* Set Up */
-        memory = malloc(CRC8_LOOKUP_TABLE_MEMORY_SIZE);
-
-        /* Mock */
-        memory_malloc_ExpectAndReturn(CRC8_LOOKUP_TABLE_MEMORY_SIZE, memory);
-
         /* Set Up */
         crc8_init(CrcName[i], &configuration, true); // true (Lookup Table)
         random_buffer(buffer, sizeof(buffer) - sizeof(uint8_t));
@@ -621,8 +1145,60 @@ void test_verify_4(void)
 
         /* Verify */
         TEST_ASSERT_TRUE(crc8_verify(&configuration, buffer, sizeof(buffer)));
-
-        /* Clean Up */
-        free(memory);
     }
 }
+
+/*** Verify List ***/
+void test_verifyList_1(void)
+{
+    /*** Verify List ***/
+    /* Variable */
+    uint8_t buffer[64 + sizeof(uint8_t)];
+    crc8_configuration_t configuration;
+    list_list_t list = {NULL, NULL, NULL, NULL, 2};
+    list_node_t node[2];
+    struct iovec segment[2];
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+    random_buffer(buffer, sizeof(buffer) - sizeof(uint8_t));
+    crc8_calculateAndAppend(&configuration, buffer, sizeof(buffer), sizeof(buffer) - sizeof(uint8_t));
+    segment[0] = (struct iovec){buffer, 30};
+    segment[1] = (struct iovec){buffer + 30, sizeof(buffer) - 30};
+    node[0] = (list_node_t){&segment[0], &node[1], NULL};
+    node[1] = (list_node_t){&segment[1], NULL, &node[0]};
+    list.head = &node[0];
+    list.tail = &node[1];
+
+    /* Verify */
+    TEST_ASSERT_FALSE(crc8_verifyList(NULL, &list));
+    TEST_ASSERT_FALSE(crc8_verifyList(&configuration, NULL));
+    TEST_ASSERT_TRUE(crc8_verifyList(&configuration, &list));
+    buffer[40] ^= 0x01; // Corrupt
+    TEST_ASSERT_FALSE(crc8_verifyList(&configuration, &list));
+}
+
+/*** Verify Vector ***/
+void test_verifyV_1(void)
+{
+    /*** Verify Vector ***/
+    /* Variable */
+    uint8_t buffer[64 + sizeof(uint8_t)];
+    crc8_configuration_t configuration;
+    struct iovec segment[3];
+
+    /* Set Up */
+    crc8_init("CRC-8/SMBUS", &configuration, true); // true (Lookup Table)
+    random_buffer(buffer, sizeof(buffer) - sizeof(uint8_t));
+    crc8_calculateAndAppend(&configuration, buffer, sizeof(buffer), sizeof(buffer) - sizeof(uint8_t));
+    segment[0] = (struct iovec){buffer, 10};
+    segment[1] = (struct iovec){buffer + 10, 50};
+    segment[2] = (struct iovec){buffer + 60, sizeof(buffer) - 60};
+
+    /* Verify */
+    TEST_ASSERT_FALSE(crc8_verifyV(NULL, segment, 3));
+    TEST_ASSERT_FALSE(crc8_verifyV(&configuration, NULL, 3));
+    TEST_ASSERT_TRUE(crc8_verifyV(&configuration, segment, 3));
+    buffer[sizeof(buffer) - 1] ^= 0x80; // Corrupt CRC
+    TEST_ASSERT_FALSE(crc8_verifyV(&configuration, segment, 3));
+}
@@ -0,0 +1,264 @@
+/****************************************************************************************************
+ * Include
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include "crc16.h"
+#include "crc32.h"
+#include "hdlc.h"
+#include "list.h"
+#include "misc.h"
+#include "mock_memory.h"
+#include "random.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+
+/****************************************************************************************************
+ * Define
+ ****************************************************************************************************/
+
+#define TEST_FRAME_COUNT (8)
+#define TEST_FRAME_LENGTH_MAXIMUM (600)
+
+/****************************************************************************************************
+ * Variable
+ ****************************************************************************************************/
+
+/*** Helper ***/
+static size_t helper_frameCount;
+static uint8_t helper_frame[TEST_FRAME_COUNT][TEST_FRAME_LENGTH_MAXIMUM];
+static size_t helper_frameLength[TEST_FRAME_COUNT];
+
+/*** Test ***/
+static crc16_configuration_t test_Crc16;
+static crc32_configuration_t test_Crc32;
+
+/****************************************************************************************************
+ * Helper
+ ****************************************************************************************************/
+
+/*** Frame Callback (Store In Order) ***/
+static void helper_frameCallback(const uint8_t * const Frame, const size_t FrameLength, void * const argument)
+{
+    /*** Frame Callback (Store In Order) ***/
+    /* Store */
+    (void)argument;
+    if((helper_frameCount < TEST_FRAME_COUNT) && (FrameLength <= TEST_FRAME_LENGTH_MAXIMUM))
+    {
+        memcpy(helper_frame[helper_frameCount], Frame, FrameLength);
+        helper_frameLength[helper_frameCount] = FrameLength;
+    }
+    helper_frameCount++;
+}
+
+/****************************************************************************************************
+ * Set Up/Tear Down
+ ****************************************************************************************************/
+
+void setUp(void)
+{
+    /*** Set Up ***/
+    /* Set Up */
+    crc16_init("CRC-16/IBM-SDLC", &test_Crc16, CRC16_ENGINE_LOOKUP_TABLE);
+    crc32_init("CRC-32/ISO-HDLC", &test_Crc32, CRC32_ENGINE_LOOKUP_TABLE);
+    helper_frameCount = 0;
+}
+
+void tearDown(void)
+{
+}
+
+/****************************************************************************************************
+ * Test (Public)
+ ****************************************************************************************************/
+
+/*** Decode ***/
+void test_decode_1(void)
+{
+    /*** Decode (Bad Frames Counted, Good Frames Around Them Delivered) ***/
+    /* Variable */
+    uint8_t buffer[32];
+    hdlc_configuration_t configuration = {HDLC_ACCM_NONE, NULL, &test_Crc16, NULL, helper_frameCallback};
+    hdlc_decoder_t decoder;
+    uint8_t encoded[128];
+    size_t encodedLength;
+    const uint8_t Frame[] = {0x01, 0x02, 0x03};
+    uint8_t stream[512];
+    size_t streamLength;
+
+    /* Set Up (Noise, Good, Corrupt, Abort, Runt, Overflow, Good) */
+    TEST_ASSERT_TRUE(hdlc_decoderInit(&decoder, &configuration, buffer, sizeof(buffer)));
+    streamLength = 0;
+    memcpy(&stream[streamLength], "noise", 5);
+    streamLength += 5;
+    encodedLength = hdlc_encode(&configuration, encoded, sizeof(encoded), Frame, sizeof(Frame));
+    memcpy(&stream[streamLength], encoded, encodedLength);
+    streamLength += encodedLength;
+    memcpy(&stream[streamLength], encoded, encodedLength);
+    stream[streamLength + 2] ^= 0x01;
+    streamLength += encodedLength;
+    memcpy(&stream[streamLength], "\x7E\x41\x42\x7D\x7E", 5);
+    streamLength += 5;
+    memcpy(&stream[streamLength], "\x7E\x41\x7E", 3);
+    streamLength += 3;
+    stream[streamLength++] = HDLC_FLAG;
+    memset(&stream[streamLength], 0x55, 40);
+    streamLength += 40;
+    memcpy(&stream[streamLength], encoded, encodedLength);
+    streamLength += encodedLength;
+
+    /* Decode */
+    hdlc_decode(&decoder, stream, streamLength);
+    TEST_ASSERT_EQUAL_size_t(2, helper_frameCount);
+    TEST_ASSERT_EQUAL_size_t(sizeof(Frame), helper_frameLength[0]);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(Frame, helper_frame[0], sizeof(Frame));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(Frame, helper_frame[1], sizeof(Frame));
+    TEST_ASSERT_EQUAL_size_t(2, decoder.statistics.frames);
+    TEST_ASSERT_EQUAL_size_t(1, decoder.statistics.crcErrors);
+    TEST_ASSERT_EQUAL_size_t(1, decoder.statistics.aborted);
+    TEST_ASSERT_EQUAL_size_t(1, decoder.statistics.runts);
+    TEST_ASSERT_EQUAL_size_t(1, decoder.statistics.overflowed);
+}
+
+void test_decode_2(void)
+{
+    /*** Decode (Round Trip, FCS-16 And FCS-32, Any ACCM, Stream Split At Random Points) ***/
+    /* Type Definition */
+    typedef struct testData_s
+    {
+        uint32_t accm;
+        bool crc32;
+    } testData_t;
+
+    /* Variable */
+    uint8_t buffer[TEST_FRAME_LENGTH_MAXIMUM + 4];
+    size_t chunkLength;
+    hdlc_configuration_t configuration;
+    hdlc_decoder_t decoder;
+    static uint8_t frame[TEST_FRAME_COUNT][TEST_FRAME_LENGTH_MAXIMUM];
+    size_t frameLength[TEST_FRAME_COUNT];
+    size_t offset;
+    static uint8_t stream[TEST_FRAME_COUNT * (2 * (TEST_FRAME_LENGTH_MAXIMUM + 4) + 2)];
+    size_t streamLength;
+    const testData_t TestData[] =
+    {
+        {HDLC_ACCM_NONE, false},
+        {HDLC_ACCM_PPP, false},
+        {HDLC_ACCM_NONE, true},
+        {HDLC_ACCM_PPP, true},
+    };
+
+    /* Decode */
+    for(size_t i = 0; i < (sizeof(TestData) / sizeof(testData_t)); i++)
+    {
+        /* Set Up (Byte Values Skewed Toward Flag, Escape And Control Characters) */
+        memset(&configuration, 0, sizeof(configuration));
+        configuration.accm = TestData[i].accm;
+        configuration.Crc16 = TestData[i].crc32 ? NULL : &test_Crc16;
+        configuration.Crc32 = TestData[i].crc32 ? &test_Crc32 : NULL;
+        configuration.frameCallback = helper_frameCallback;
+        helper_frameCount = 0;
+        streamLength = 0;
+        for(size_t j = 0; j < TEST_FRAME_COUNT; j++)
+        {
+            frameLength[j] = random_U32WithinRange(1, TEST_FRAME_LENGTH_MAXIMUM);
+            random_buffer(frame[j], frameLength[j]);
+            for(size_t k = 0; k < frameLength[j]; k += 3)
+                frame[j][k] = (frame[j][k] & 1) ? HDLC_FLAG : (frame[j][k] & 0x7D);
+            streamLength += hdlc_encode(&configuration, &stream[streamLength], sizeof(stream) - streamLength, frame[j], frameLength[j]);
+        }
+
+        /* Encoded (Flags Only At Frame Edges, No Mapped Control Characters) */
+        for(size_t j = 0; j < streamLength; j++)
+        {
+            if(stream[j] == HDLC_FLAG)
+                TEST_ASSERT_TRUE((j == 0) || (j == (streamLength - 1)) || (stream[j - 1] == HDLC_FLAG) || (stream[j + 1] == HDLC_FLAG));
+            if(TestData[i].accm == HDLC_ACCM_PPP)
+                TEST_ASSERT_TRUE(stream[j] >= 0x20);
+        }
+
+        /* Decode */
+        TEST_ASSERT_TRUE(hdlc_decoderInit(&decoder, &configuration, buffer, sizeof(buffer)));
+        for(offset = 0; offset < streamLength; offset += chunkLength)
+        {
+            chunkLength = random_U32WithinRange(1, 97);
+            if(chunkLength > (streamLength - offset))
+                chunkLength = streamLength - offset;
+            hdlc_decode(&decoder, &stream[offset], chunkLength);
+        }
+        TEST_ASSERT_EQUAL_size_t(TEST_FRAME_COUNT, helper_frameCount);
+        TEST_ASSERT_EQUAL_size_t(0, decoder.statistics.crcErrors);
+        for(size_t j = 0; j < TEST_FRAME_COUNT; j++)
+        {
+            TEST_ASSERT_EQUAL_size_t(frameLength[j], helper_frameLength[j]);
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(frame[j], helper_frame[j], frameLength[j]);
+        }
+    }
+}
+
+/*** Decoder Initialize ***/
+void test_decoderInit_1(void)
+{
+    /*** Decoder Initialize (NULL Pointer, No FCS, Empty Buffer) ***/
+    /* Variable */
+    uint8_t buffer[16];
+    hdlc_configuration_t configuration = {HDLC_ACCM_NONE, NULL, NULL, NULL, NULL};
+    hdlc_decoder_t decoder;
+
+    /* Decoder Initialize */
+    TEST_ASSERT_FALSE(hdlc_decoderInit(&decoder, &configuration, buffer, sizeof(buffer)));
+    configuration.Crc16 = &test_Crc16;
+    TEST_ASSERT_FALSE(hdlc_decoderInit(NULL, &configuration, buffer, sizeof(buffer)));
+    TEST_ASSERT_FALSE(hdlc_decoderInit(&decoder, NULL, buffer, sizeof(buffer)));
+    TEST_ASSERT_FALSE(hdlc_decoderInit(&decoder, &configuration, NULL, sizeof(buffer)));
+    TEST_ASSERT_FALSE(hdlc_decoderInit(&decoder, &configuration, buffer, 0));
+    TEST_ASSERT_TRUE(hdlc_decoderInit(&decoder, &configuration, buffer, sizeof(buffer)));
+}
+
+/*** Encode ***/
+void test_encode_1(void)
+{
+    /*** Encode (NULL Pointer, Destination Too Small) ***/
+    /* Variable */
+    hdlc_configuration_t configuration = {HDLC_ACCM_NONE, NULL, &test_Crc16, NULL, NULL};
+    uint8_t encoded[16];
+    const uint8_t Frame[] = {0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D};
+
+    /* Encode */
+    TEST_ASSERT_EQUAL_size_t(0, hdlc_encode(NULL, encoded, sizeof(encoded), Frame, sizeof(Frame)));
+    TEST_ASSERT_EQUAL_size_t(0, hdlc_encode(&configuration, NULL, sizeof(encoded), Frame, sizeof(Frame)));
+    TEST_ASSERT_EQUAL_size_t(0, hdlc_encode(&configuration, encoded, sizeof(encoded), NULL, sizeof(Frame)));
+    TEST_ASSERT_EQUAL_size_t(0, hdlc_encode(&configuration, encoded, 14, Frame, sizeof(Frame))); // Stuffed Data Alone Fills 12
+}
+
+void test_encode_2(void)
+{
+    /*** Encode (Check String, FCS-16 Least Significant Byte First) ***/
+    /* Variable */
+    hdlc_configuration_t configuration = {HDLC_ACCM_NONE, NULL, &test_Crc16, NULL, NULL};
+    uint8_t encoded[32];
+    const uint8_t Expected[] = {0x7E, '1', '2', '3', '4', '5', '6', '7', '8', '9', 0x6E, 0x90, 0x7E};
+
+    /* Encode */
+    TEST_ASSERT_EQUAL_size_t(sizeof(Expected), hdlc_encode(&configuration, encoded, sizeof(encoded), (const uint8_t *)"123456789", 9));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(Expected, encoded, sizeof(Expected));
+}
+
+void test_encode_3(void)
+{
+    /*** Encode (Flag, Escape And Mapped Control Characters Stuffed, Including In The FCS) ***/
+    /* Variable */
+    hdlc_configuration_t configuration = {HDLC_ACCM_PPP, NULL, &test_Crc16, NULL, NULL};
+    uint8_t encoded[32];
+    const uint8_t Expected[] = {0x7E, 0x7D, 0x5E, 0x7D, 0x5D, 0x7D, 0x20, 0x41, 0x7E};
+    const uint8_t Frame[] = {0x7E, 0x7D, 0x00, 0x41};
+    size_t length;
+
+    /* Encode (FCS Bytes Are Whatever Calculate Gives, Checked By Decoding) */
+    length = hdlc_encode(&configuration, encoded, sizeof(encoded), Frame, sizeof(Frame));
+    TEST_ASSERT_TRUE(length >= (sizeof(Expected) + 2));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(Expected, encoded, sizeof(Expected) - 1);
+    TEST_ASSERT_EQUAL_HEX8(HDLC_FLAG, encoded[length - 1]);
+}
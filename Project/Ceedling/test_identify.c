@@ -0,0 +1,236 @@
+/****************************************************************************************************
+ * Include
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include "crc16.h"
+#include "crc32.h"
+#include "crc64.h"
+#include "crc8.h"
+#include "identify.h"
+#include "list.h"
+#include "misc.h"
+#include "mock_memory.h"
+#include "random.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+
+/****************************************************************************************************
+ * Define
+ ****************************************************************************************************/
+
+#define TEST_RESULT_CAPACITY (256)
+
+/****************************************************************************************************
+ * Variable
+ ****************************************************************************************************/
+
+/*** Test ***/
+static uint8_t test_Data[2 * IDENTIFY_BLOCK_SIZE + 100];
+static identify_result_t test_result[TEST_RESULT_CAPACITY];
+
+/****************************************************************************************************
+ * Helper
+ ****************************************************************************************************/
+
+/*** Memory Free Stub ***/
+static void helper_memoryFreeStub(void **memory, int cmock_num_calls)
+{
+    /*** Memory Free Stub ***/
+    /* Free */
+    free(*memory);
+
+    /* Clean Up */
+    *memory = NULL;
+}
+
+/*** Memory Malloc Stub ***/
+static void *helper_memoryMallocStub(const size_t Size, int cmock_num_calls)
+{
+    /*** Memory Malloc Stub ***/
+    /* Malloc */
+    return malloc(Size);
+}
+
+/*** Find (Result By Name) ***/
+static const identify_result_t *helper_find(const char * const Name, const size_t ResultCount)
+{
+    /*** Find (Result By Name) ***/
+    /* Variable */
+    const identify_result_t *result;
+
+    /* Find */
+    result = NULL;
+    for(size_t i = 0; (i < ResultCount) && (result == NULL); i++)
+    {
+        if(strcmp(Name, test_result[i].Name) == 0)
+            result = &test_result[i];
+    }
+
+    /* Exit */
+    return result;
+}
+
+/****************************************************************************************************
+ * Set Up/Tear Down
+ ****************************************************************************************************/
+
+void setUp(void)
+{
+    /*** Set Up ***/
+    /* Function */
+    memory_free_Stub(helper_memoryFreeStub);
+    memory_malloc_Stub(helper_memoryMallocStub);
+}
+
+void tearDown(void)
+{
+}
+
+/****************************************************************************************************
+ * Test (Public)
+ ****************************************************************************************************/
+
+/*** Run ***/
+void test_run_1(void)
+{
+    /*** Run (NULL Pointer) ***/
+    /* Variable */
+    size_t resultCount;
+
+    /* Run */
+    TEST_ASSERT_FALSE(identify_run(NULL, 1, IDENTIFY_MATCH_ANY, test_result, TEST_RESULT_CAPACITY, &resultCount));
+    TEST_ASSERT_FALSE(identify_run(test_Data, 1, IDENTIFY_MATCH_ANY, NULL, TEST_RESULT_CAPACITY, &resultCount));
+    TEST_ASSERT_FALSE(identify_run(test_Data, 1, IDENTIFY_MATCH_ANY, test_result, TEST_RESULT_CAPACITY, NULL));
+}
+
+void test_run_2(void)
+{
+    /*** Run (Every Catalog Entry Matches Calculate, Trailer Split On And Off Block Boundaries) ***/
+    /* Variable */
+    crc8_configuration_t configuration8;
+    crc16_configuration_t configuration16;
+    crc32_configuration_t configuration32;
+    crc64_configuration_t configuration64;
+    size_t index;
+    const size_t Length[] = {0, 1, 2, 9, 5000, IDENTIFY_BLOCK_SIZE + 4, IDENTIFY_BLOCK_SIZE + 8, sizeof(test_Data)};
+    size_t resultCount;
+
+    /* Run */
+    for(size_t i = 0; i < (sizeof(Length) / sizeof(Length[0])); i++)
+    {
+        /* Set Up */
+        random_buffer(test_Data, Length[i]);
+
+        /* Run (Results Follow Catalog Order, Narrowest Width First) */
+        TEST_ASSERT_TRUE(identify_run(test_Data, Length[i], IDENTIFY_MATCH_ALL, test_result, TEST_RESULT_CAPACITY, &resultCount));
+        TEST_ASSERT_EQUAL_size_t(crc8_ConfigurationCount + crc16_ConfigurationCount + crc32_ConfigurationCount + crc64_ConfigurationCount, resultCount);
+        index = 0;
+        for(size_t j = 0; j < crc8_ConfigurationCount; j++, index++)
+        {
+            crc8_init(crc8_Configuration[j].Name, &configuration8, false);
+            TEST_ASSERT_EQUAL_STRING(crc8_Configuration[j].Name, test_result[index].Name);
+            TEST_ASSERT_EQUAL_size_t(8, test_result[index].width);
+            TEST_ASSERT_EQUAL_HEX64(crc8_calculate(&configuration8, test_Data, Length[i]), test_result[index].crc);
+            if(Length[i] > 1)
+                TEST_ASSERT_EQUAL_HEX64(crc8_calculate(&configuration8, test_Data, Length[i] - 1), test_result[index].messageCrc);
+        }
+        for(size_t j = 0; j < crc16_ConfigurationCount; j++, index++)
+        {
+            crc16_init(crc16_Configuration[j].Name, &configuration16, CRC16_ENGINE_LOOP);
+            TEST_ASSERT_EQUAL_STRING(crc16_Configuration[j].Name, test_result[index].Name);
+            TEST_ASSERT_EQUAL_HEX64(crc16_calculate(&configuration16, test_Data, Length[i]), test_result[index].crc);
+            if(Length[i] > 2)
+                TEST_ASSERT_EQUAL_HEX64(crc16_calculate(&configuration16, test_Data, Length[i] - 2), test_result[index].messageCrc);
+        }
+        for(size_t j = 0; j < crc32_ConfigurationCount; j++, index++)
+        {
+            crc32_init(crc32_Configuration[j].Name, &configuration32, CRC32_ENGINE_LOOP);
+            TEST_ASSERT_EQUAL_STRING(crc32_Configuration[j].Name, test_result[index].Name);
+            TEST_ASSERT_EQUAL_HEX64(crc32_calculate(&configuration32, test_Data, Length[i]), test_result[index].crc);
+            if(Length[i] > 4)
+                TEST_ASSERT_EQUAL_HEX64(crc32_calculate(&configuration32, test_Data, Length[i] - 4), test_result[index].messageCrc);
+        }
+        for(size_t j = 0; j < crc64_ConfigurationCount; j++, index++)
+        {
+            crc64_init(crc64_Configuration[j].Name, &configuration64, CRC64_ENGINE_LOOP);
+            TEST_ASSERT_EQUAL_STRING(crc64_Configuration[j].Name, test_result[index].Name);
+            TEST_ASSERT_EQUAL_size_t(64, test_result[index].width);
+            TEST_ASSERT_EQUAL_HEX64(crc64_calculate(&configuration64, test_Data, Length[i]), test_result[index].crc);
+            if(Length[i] > 8)
+                TEST_ASSERT_EQUAL_HEX64(crc64_calculate(&configuration64, test_Data, Length[i] - 8), test_result[index].messageCrc);
+        }
+    }
+}
+
+void test_run_3(void)
+{
+    /*** Run (Identify An Appended CRC) ***/
+    /* Type Definition */
+    typedef struct testData_s
+    {
+        const char *Name;
+        size_t width;
+    } testData_t;
+
+    /* Variable */
+    crc16_configuration_t configuration16;
+    crc32_configuration_t configuration32;
+    crc64_configuration_t configuration64;
+    const identify_result_t *result;
+    size_t resultCount;
+    const testData_t TestData[] =
+    {
+        {"CRC-16/XMODEM", 16},
+        {"CRC-16/KERMIT", 16},
+        {"CRC-32/ISO-HDLC", 32},
+        {"CRC-32/MPEG-2", 32},
+        {"CRC-64/XZ", 64},
+    };
+
+    /* Run */
+    for(size_t i = 0; i < (sizeof(TestData) / sizeof(testData_t)); i++)
+    {
+        /* Set Up (Frame Of 3000 Bytes, CRC Appended By The Library Itself) */
+        random_buffer(test_Data, 3000);
+        switch(TestData[i].width)
+        {
+            case 16:
+                crc16_init(TestData[i].Name, &configuration16, CRC16_ENGINE_LOOKUP_TABLE);
+                crc16_calculateAndAppend(&configuration16, test_Data, 3000 + 2, 3000);
+                break;
+            case 32:
+                crc32_init(TestData[i].Name, &configuration32, CRC32_ENGINE_LOOKUP_TABLE);
+                crc32_calculateAndAppend(&configuration32, test_Data, 3000 + 4, 3000);
+                break;
+            default:
+                crc64_init(TestData[i].Name, &configuration64, CRC64_ENGINE_LOOKUP_TABLE);
+                crc64_calculateAndAppend(&configuration64, test_Data, 3000 + 8, 3000);
+                break;
+        }
+
+        /* Run */
+        TEST_ASSERT_TRUE(identify_run(test_Data, 3000 + (TestData[i].width / 8), IDENTIFY_MATCH_ANY, test_result, TEST_RESULT_CAPACITY, &resultCount));
+        TEST_ASSERT_NOT_NULL(result = helper_find(TestData[i].Name, resultCount));
+        TEST_ASSERT_TRUE((result->match & IDENTIFY_MATCH_RESIDUE) != 0);
+        TEST_ASSERT_TRUE((result->match & (IDENTIFY_MATCH_TRAILER_BIG_ENDIAN | IDENTIFY_MATCH_TRAILER_LITTLE_ENDIAN)) != 0);
+        TEST_ASSERT_TRUE(resultCount < 4); // Random Frame, Stray Matches Are Rare
+    }
+}
+
+void test_run_4(void)
+{
+    /*** Run (Result Capacity Smaller Than The Match Count) ***/
+    /* Variable */
+    size_t resultCount;
+
+    /* Run (Every Entry Reported, Only The First Two Stored) */
+    memset(test_result, 0, sizeof(test_result));
+    random_buffer(test_Data, 100);
+    TEST_ASSERT_TRUE(identify_run(test_Data, 100, IDENTIFY_MATCH_ALL, test_result, 2, &resultCount));
+    TEST_ASSERT_EQUAL_size_t(crc8_ConfigurationCount + crc16_ConfigurationCount + crc32_ConfigurationCount + crc64_ConfigurationCount, resultCount);
+    TEST_ASSERT_NOT_NULL(test_result[1].Name);
+    TEST_ASSERT_NULL(test_result[2].Name);
+}
@@ -0,0 +1,400 @@
+/****************************************************************************************************
+ * Include
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include "crc32.h"
+#include "list.h"
+#include "misc.h"
+#include "mock_memory.h"
+#include "mpegts.h"
+#include "random.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "unity.h"
+
+/****************************************************************************************************
+ * Define
+ ****************************************************************************************************/
+
+#define TEST_CYCLE_COUNT (50)
+#define TEST_PID_NIT (0x0010)
+#define TEST_PID_PES (0x0101)
+#define TEST_PID_PMT (0x0100)
+#define TEST_PID_SDT (0x0011)
+#define TEST_PID_TDT (0x0014)
+#define TEST_STREAM_SIZE (TEST_CYCLE_COUNT * 16 * MPEGTS_PACKET_SIZE)
+
+/****************************************************************************************************
+ * Variable
+ ****************************************************************************************************/
+
+/*** Helper ***/
+static uint8_t helper_continuity[MPEGTS_PID_COUNT];
+static size_t helper_sectionCount;
+static size_t helper_sectionFailed;
+
+/*** Test ***/
+static crc32_configuration_t test_Crc32;
+static uint8_t test_Stream[TEST_STREAM_SIZE];
+
+/****************************************************************************************************
+ * Helper
+ ****************************************************************************************************/
+
+/*** Memory Free Stub ***/
+static void helper_memoryFreeStub(void **memory, int cmock_num_calls)
+{
+    /*** Memory Free Stub ***/
+    /* Free */
+    free(*memory);
+
+    /* Clean Up */
+    *memory = NULL;
+}
+
+/*** Memory Malloc Stub ***/
+static void *helper_memoryMallocStub(const size_t Size, int cmock_num_calls)
+{
+    /*** Memory Malloc Stub ***/
+    /* Malloc */
+    return malloc(Size);
+}
+
+/*** Packetize (Section Split Across Packets, Pointer Field 0, Stuffed With 0xFF) ***/
+static size_t helper_packetize(uint8_t * const stream, const uint16_t Pid, const uint8_t * const Section, const size_t SectionLength)
+{
+    /*** Packetize (Section Split Across Packets, Pointer Field 0, Stuffed With 0xFF) ***/
+    /* Variable */
+    size_t offset;
+    size_t position;
+    size_t run;
+
+    /* Packetize */
+    position = 0;
+    for(offset = 0; offset < SectionLength; offset += run)
+    {
+        uint8_t *packet = &stream[position];
+        memset(packet, 0xFF, MPEGTS_PACKET_SIZE);
+        packet[0] = MPEGTS_SYNC_BYTE;
+        packet[1] = (uint8_t)(((offset == 0) ? 0x40 : 0x00) | (Pid >> 8));
+        packet[2] = (uint8_t)Pid;
+        packet[3] = 0x10 | helper_continuity[Pid];
+        helper_continuity[Pid] = (helper_continuity[Pid] + 1) & 0x0F;
+        if(offset == 0)
+        {
+            packet[4] = 0;
+            run = ((SectionLength - offset) < (MPEGTS_PACKET_SIZE - 5)) ? (SectionLength - offset) : (MPEGTS_PACKET_SIZE - 5);
+            memcpy(&packet[5], Section, run);
+        }
+        else
+        {
+            run = ((SectionLength - offset) < (MPEGTS_PACKET_SIZE - 4)) ? (SectionLength - offset) : (MPEGTS_PACKET_SIZE - 4);
+            memcpy(&packet[4], &Section[offset], run);
+        }
+        position += MPEGTS_PACKET_SIZE;
+    }
+
+    /* Exit */
+    return position;
+}
+
+/*** Section (Long Form With CRC Unless Short Form Is Asked For) ***/
+static size_t helper_section(uint8_t * const section, const uint8_t TableId, const size_t Length, const bool Crc)
+{
+    /*** Section (Long Form With CRC Unless Short Form Is Asked For) ***/
+    /* Build (Length Counts Everything, Header Included) */
+    random_buffer(section, Length);
+    section[0] = TableId;
+    section[1] = (uint8_t)((Crc ? 0xB0 : 0x70) | (((Length - 3) >> 8) & 0x0F));
+    section[2] = (uint8_t)(Length - 3);
+    if(Crc)
+        crc32_calculateAndAppend(&test_Crc32, section, Length, Length - sizeof(uint32_t));
+
+    /* Exit */
+    return Length;
+}
+
+/*** Section Callback (Count) ***/
+static void helper_sectionCallback(const uint16_t Pid, const uint8_t TableId, const size_t SectionLength, const bool Verified, void * const argument)
+{
+    /*** Section Callback (Count) ***/
+    /* Count */
+    (void)Pid;
+    (void)TableId;
+    (void)SectionLength;
+    (void)argument;
+    helper_sectionCount++;
+    if(!Verified)
+        helper_sectionFailed++;
+}
+
+/*** Stream (One PMT Before The PAT, Then Cycles Of PAT, PMT, NIT+SDT Back To Back, Long SDT, TDT, PES And Null) ***/
+static size_t helper_stream(uint8_t * const stream, const size_t CorruptCycle)
+{
+    /*** Stream ***/
+    /* Variable */
+    size_t position;
+    uint8_t section[1024];
+    uint8_t twoSections[64];
+    size_t length;
+
+    /* Set Up */
+    memset(helper_continuity, 0, sizeof(helper_continuity));
+    position = 0;
+
+    /* PMT Before Any PAT (Not Yet Watched) */
+    length = helper_section(section, 0x02, 40, true);
+    position += helper_packetize(&stream[position], TEST_PID_PMT, section, length);
+
+    /* Cycles */
+    for(size_t cycle = 0; cycle < TEST_CYCLE_COUNT; cycle++)
+    {
+        /* PAT (Program 1 On The PMT PID) */
+        const uint8_t Pat[] = {0x00, 0xB0, 0x0D, 0x00, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x01, 0xE0 | (TEST_PID_PMT >> 8), TEST_PID_PMT & 0xFF, 0, 0, 0, 0};
+        memcpy(section, Pat, sizeof(Pat));
+        crc32_calculateAndAppend(&test_Crc32, section, sizeof(Pat), sizeof(Pat) - sizeof(uint32_t));
+        position += helper_packetize(&stream[position], MPEGTS_PID_PAT, section, sizeof(Pat));
+
+        /* PMT */
+        length = helper_section(section, 0x02, 40, true);
+        position += helper_packetize(&stream[position], TEST_PID_PMT, section, length);
+
+        /* NIT And SDT Back To Back In One Packet On The NIT PID */
+        (void)helper_section(twoSections, 0x40, 30, true);
+        (void)helper_section(&twoSections[30], 0x42, 34, true);
+        position += helper_packetize(&stream[position], TEST_PID_NIT, twoSections, sizeof(twoSections));
+
+        /* SDT Spanning Packets, One Corrupted */
+        length = helper_section(section, 0x42, 600 + cycle, true);
+        if(cycle == CorruptCycle)
+            section[300] ^= 0x04;
+        position += helper_packetize(&stream[position], TEST_PID_SDT, section, length);
+
+        /* TDT (No CRC) */
+        length = helper_section(section, 0x70, 8, false);
+        position += helper_packetize(&stream[position], TEST_PID_TDT, section, length);
+
+        /* PES (Not PSI) */
+        section[0] = 0x00;
+        section[1] = 0x00;
+        section[2] = 0x01;
+        position += helper_packetize(&stream[position], TEST_PID_PES, section, 300);
+
+        /* Null */
+        position += helper_packetize(&stream[position], 0x1FFF, section, 100);
+    }
+
+    /* Exit */
+    return position;
+}
+
+/****************************************************************************************************
+ * Set Up/Tear Down
+ ****************************************************************************************************/
+
+void setUp(void)
+{
+    /*** Set Up ***/
+    /* Function */
+    memory_free_Stub(helper_memoryFreeStub);
+    memory_malloc_Stub(helper_memoryMallocStub);
+
+    /* Set Up */
+    crc32_init("CRC-32/MPEG-2", &test_Crc32, CRC32_ENGINE_LOOKUP_TABLE);
+    helper_sectionCount = 0;
+    helper_sectionFailed = 0;
+}
+
+void tearDown(void)
+{
+}
+
+/****************************************************************************************************
+ * Test (Public)
+ ****************************************************************************************************/
+
+/*** Initialize ***/
+void test_init_1(void)
+{
+    /*** Initialize (NULL Pointer) ***/
+    /* Variable */
+    mpegts_configuration_t configuration = {NULL, NULL, NULL};
+    mpegts_t mpegts;
+
+    /* Initialize */
+    TEST_ASSERT_FALSE(mpegts_init(NULL, &configuration));
+    TEST_ASSERT_FALSE(mpegts_init(&mpegts, NULL));
+    TEST_ASSERT_FALSE(mpegts_init(&mpegts, &configuration));
+    configuration.Crc32 = &test_Crc32;
+    TEST_ASSERT_TRUE(mpegts_init(&mpegts, &configuration));
+    TEST_ASSERT_TRUE(mpegts.pid[MPEGTS_PID_PAT].psi);
+    TEST_ASSERT_FALSE(mpegts.pid[TEST_PID_PMT].psi);
+    TEST_ASSERT_FALSE(mpegts_watch(&mpegts, MPEGTS_PID_COUNT));
+    TEST_ASSERT_TRUE(mpegts_watch(&mpegts, TEST_PID_PMT));
+    TEST_ASSERT_TRUE(mpegts.pid[TEST_PID_PMT].psi);
+    mpegts_deinit(&mpegts);
+    TEST_ASSERT_NULL(mpegts.pid);
+    TEST_ASSERT_FALSE(mpegts_watch(&mpegts, TEST_PID_PMT));
+}
+
+/*** Update ***/
+void test_update_1(void)
+{
+    /*** Update (Random Chunks, Per PID Counts) ***/
+    /* Variable */
+    size_t chunkLength;
+    mpegts_configuration_t configuration = {NULL, &test_Crc32, helper_sectionCallback};
+    mpegts_t mpegts;
+    size_t offset;
+    size_t streamLength;
+
+    /* Set Up */
+    streamLength = helper_stream(test_Stream, 17);
+    TEST_ASSERT_TRUE(mpegts_init(&mpegts, &configuration));
+
+    /* Update */
+    for(offset = 0; offset < streamLength; offset += chunkLength)
+    {
+        chunkLength = random_U32WithinRange(1, 1000);
+        if(chunkLength > (streamLength - offset))
+            chunkLength = streamLength - offset;
+        mpegts_update(&mpegts, &test_Stream[offset], chunkLength);
+    }
+
+    /* Verify (PMT Before The PAT Skipped, PES And Null Never Parsed) */
+    TEST_ASSERT_EQUAL_UINT64(streamLength / MPEGTS_PACKET_SIZE, mpegts.statistics.packets);
+    TEST_ASSERT_EQUAL_UINT64(streamLength, mpegts.statistics.processed);
+    TEST_ASSERT_EQUAL_size_t(TEST_CYCLE_COUNT, mpegts.pid[MPEGTS_PID_PAT].statistics.sections);
+    TEST_ASSERT_EQUAL_size_t(TEST_CYCLE_COUNT, mpegts.pid[TEST_PID_PMT].statistics.sections);
+    TEST_ASSERT_EQUAL_size_t(2 * TEST_CYCLE_COUNT, mpegts.pid[TEST_PID_NIT].statistics.sections);
+    TEST_ASSERT_EQUAL_size_t(TEST_CYCLE_COUNT, mpegts.pid[TEST_PID_SDT].statistics.sections);
+    TEST_ASSERT_EQUAL_size_t(1, mpegts.pid[TEST_PID_SDT].statistics.crcErrors);
+    TEST_ASSERT_EQUAL_size_t(TEST_CYCLE_COUNT, mpegts.pid[TEST_PID_TDT].statistics.unchecked);
+    TEST_ASSERT_EQUAL_size_t(0, mpegts.pid[TEST_PID_PES].statistics.sections);
+    TEST_ASSERT_EQUAL_size_t(5 * TEST_CYCLE_COUNT, mpegts.statistics.sections);
+    TEST_ASSERT_EQUAL_size_t(1, mpegts.statistics.crcErrors);
+    TEST_ASSERT_EQUAL_size_t(TEST_CYCLE_COUNT, mpegts.statistics.unchecked);
+    TEST_ASSERT_EQUAL_size_t(0, mpegts.statistics.syncErrors);
+    TEST_ASSERT_EQUAL_size_t(mpegts.statistics.sections, helper_sectionCount);
+    TEST_ASSERT_EQUAL_size_t(1, helper_sectionFailed);
+    mpegts_deinit(&mpegts);
+}
+
+void test_update_2(void)
+{
+    /*** Update (Sync Loss, Dropped Packet, Transport Error) ***/
+    /* Variable */
+    const uint8_t Garbage[] = {0x00, 0x12, 0x34, 0x56, 0x78};
+    mpegts_configuration_t configuration = {NULL, &test_Crc32, NULL};
+    mpegts_t mpegts;
+    uint8_t section[400];
+    size_t length;
+    size_t streamLength;
+
+    /* Set Up (SDT Over Three Packets With The Middle One Lost, Garbage, An Intact SDT, Then One Whose Last Packet Is Flagged) */
+    memset(helper_continuity, 0, sizeof(helper_continuity));
+    length = helper_section(section, 0x42, sizeof(section), true);
+    streamLength = helper_packetize(test_Stream, TEST_PID_SDT, section, length);
+    memmove(&test_Stream[MPEGTS_PACKET_SIZE], &test_Stream[2 * MPEGTS_PACKET_SIZE], MPEGTS_PACKET_SIZE);
+    streamLength -= MPEGTS_PACKET_SIZE;
+    memcpy(&test_Stream[streamLength], Garbage, sizeof(Garbage));
+    streamLength += sizeof(Garbage);
+    streamLength += helper_packetize(&test_Stream[streamLength], TEST_PID_SDT, section, length);
+    streamLength += helper_packetize(&test_Stream[streamLength], TEST_PID_SDT, section, length);
+    test_Stream[streamLength - MPEGTS_PACKET_SIZE + 1] |= 0x80;
+    TEST_ASSERT_TRUE(mpegts_init(&mpegts, &configuration));
+
+    /* Update */
+    mpegts_update(&mpegts, test_Stream, streamLength);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_size_t(1, mpegts.statistics.syncErrors);
+    TEST_ASSERT_EQUAL_size_t(1, mpegts.statistics.transportErrors);
+    TEST_ASSERT_EQUAL_size_t(1, mpegts.pid[TEST_PID_SDT].statistics.discontinuities);
+    TEST_ASSERT_EQUAL_size_t(1, mpegts.pid[TEST_PID_SDT].statistics.sections);
+    TEST_ASSERT_EQUAL_size_t(0, mpegts.pid[TEST_PID_SDT].statistics.crcErrors);
+    mpegts_deinit(&mpegts);
+}
+
+void test_update_3(void)
+{
+    /*** Update (PAT Spanning Two Packets, Its Program Map PIDs Still Watched) ***/
+    /* Variable */
+    mpegts_configuration_t configuration = {NULL, &test_Crc32, helper_sectionCallback};
+    mpegts_t mpegts;
+    uint8_t pat[8 + (60 * 4) + sizeof(uint32_t)];
+    uint8_t section[40];
+    size_t length;
+    size_t streamLength;
+
+    /* Set Up (60 Programs, The Last On The PMT PID, Then That PMT) */
+    memset(helper_continuity, 0, sizeof(helper_continuity));
+    memset(pat, 0, sizeof(pat));
+    pat[0] = MPEGTS_TABLE_ID_PAT;
+    pat[1] = (uint8_t)(0xB0 | ((sizeof(pat) - 3) >> 8));
+    pat[2] = (uint8_t)(sizeof(pat) - 3);
+    pat[4] = 0x01;
+    pat[5] = 0xC1;
+    for(size_t i = 0; i < 60; i++)
+    {
+        const uint16_t Pid = (i == 59) ? TEST_PID_PMT : (uint16_t)(0x0200 + i);
+        pat[8 + (4 * i) + 1] = (uint8_t)(i + 1);
+        pat[8 + (4 * i) + 2] = (uint8_t)(0xE0 | (Pid >> 8));
+        pat[8 + (4 * i) + 3] = (uint8_t)Pid;
+    }
+    crc32_calculateAndAppend(&test_Crc32, pat, sizeof(pat), sizeof(pat) - sizeof(uint32_t));
+    streamLength = helper_packetize(test_Stream, MPEGTS_PID_PAT, pat, sizeof(pat));
+    TEST_ASSERT_EQUAL_size_t(2 * MPEGTS_PACKET_SIZE, streamLength);
+    length = helper_section(section, 0x02, sizeof(section), true);
+    streamLength += helper_packetize(&test_Stream[streamLength], TEST_PID_PMT, section, length);
+    TEST_ASSERT_TRUE(mpegts_init(&mpegts, &configuration));
+
+    /* Update */
+    mpegts_update(&mpegts, test_Stream, streamLength);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_size_t(1, mpegts.pid[MPEGTS_PID_PAT].statistics.sections);
+    TEST_ASSERT_TRUE(mpegts.pid[0x0200].psi);
+    TEST_ASSERT_TRUE(mpegts.pid[TEST_PID_PMT].psi);
+    TEST_ASSERT_EQUAL_size_t(1, mpegts.pid[TEST_PID_PMT].statistics.sections);
+    TEST_ASSERT_EQUAL_size_t(0, mpegts.statistics.crcErrors);
+    TEST_ASSERT_EQUAL_size_t(2, helper_sectionCount);
+    mpegts_deinit(&mpegts);
+}
+
+/*** Validate File ***/
+void test_validateFile_1(void)
+{
+    /*** Validate File (Mapped Capture, Throughput Reported) ***/
+    /* Variable */
+    mpegts_configuration_t configuration = {NULL, &test_Crc32, NULL};
+    int fileDescriptor;
+    mpegts_t mpegts;
+    char path[] = "/tmp/test_mpegtsXXXXXX";
+    size_t streamLength;
+
+    /* Set Up */
+    streamLength = helper_stream(test_Stream, TEST_CYCLE_COUNT);
+    fileDescriptor = mkstemp(path);
+    TEST_ASSERT_TRUE(fileDescriptor >= 0);
+    TEST_ASSERT_EQUAL_size_t(streamLength, (size_t)write(fileDescriptor, test_Stream, streamLength));
+    close(fileDescriptor);
+    TEST_ASSERT_TRUE(mpegts_init(&mpegts, &configuration));
+
+    /* Validate */
+    TEST_ASSERT_FALSE(mpegts_validateFile(NULL, path, NULL, NULL));
+    TEST_ASSERT_FALSE(mpegts_validateFile(&mpegts, NULL, NULL, NULL));
+    TEST_ASSERT_FALSE(mpegts_validateFile(&mpegts, "/nonexistent/test_mpegts", NULL, NULL));
+    TEST_ASSERT_TRUE(mpegts_validateFile(&mpegts, path, NULL, NULL));
+    unlink(path);
+
+    /* Verify */
+    TEST_ASSERT_TRUE(mpegts.statistics.mapped);
+    TEST_ASSERT_EQUAL_UINT64(streamLength, mpegts.statistics.processed);
+    TEST_ASSERT_EQUAL_size_t(5 * TEST_CYCLE_COUNT, mpegts.statistics.sections);
+    TEST_ASSERT_EQUAL_size_t(0, mpegts.statistics.crcErrors);
+    mpegts_deinit(&mpegts);
+}
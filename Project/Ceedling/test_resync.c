@@ -0,0 +1,254 @@
+/****************************************************************************************************
+ * Include
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include "crc16.h"
+#include "crc32.h"
+#include "crc64.h"
+#include "crc8.h"
+#include "list.h"
+#include "misc.h"
+#include "mock_memory.h"
+#include "random.h"
+#include "resync.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+
+/****************************************************************************************************
+ * Define
+ ****************************************************************************************************/
+
+#define TEST_CAPTURE_LENGTH (700)
+#define TEST_MATCH_CAPACITY (4096)
+
+/****************************************************************************************************
+ * Variable
+ ****************************************************************************************************/
+
+/*** Helper ***/
+static size_t helper_matchCount;
+static uint8_t helper_match[TEST_CAPTURE_LENGTH][TEST_CAPTURE_LENGTH + 1]; // [Offset][Length]
+
+/*** Test ***/
+static uint8_t test_Capture[TEST_CAPTURE_LENGTH];
+
+/****************************************************************************************************
+ * Helper
+ ****************************************************************************************************/
+
+/*** Frame Callback (Mark Offset And Length) ***/
+static void helper_frameCallback(const uint64_t Offset, const size_t Length, void * const argument)
+{
+    /*** Frame Callback (Mark Offset And Length) ***/
+    /* Mark */
+    (void)argument;
+    TEST_ASSERT_TRUE((Offset + Length) <= TEST_CAPTURE_LENGTH);
+    helper_match[Offset][Length]++;
+    helper_matchCount++;
+}
+
+/*** Memory Free Stub ***/
+static void helper_memoryFreeStub(void **memory, int cmock_num_calls)
+{
+    /*** Memory Free Stub ***/
+    /* Free */
+    free(*memory);
+
+    /* Clean Up */
+    *memory = NULL;
+}
+
+/*** Memory Malloc Stub ***/
+static void *helper_memoryMallocStub(const size_t Size, int cmock_num_calls)
+{
+    /*** Memory Malloc Stub ***/
+    /* Malloc */
+    return malloc(Size);
+}
+
+/*** Verify (Any Width By Name) ***/
+static bool helper_verify(const char * const Name, const uint8_t * const Buffer, const size_t BufferLength)
+{
+    /*** Verify (Any Width By Name) ***/
+    /* Variable */
+    crc8_configuration_t configuration8;
+    crc16_configuration_t configuration16;
+    crc32_configuration_t configuration32;
+    crc64_configuration_t configuration64;
+    bool verified;
+
+    /* Verify */
+    switch(crc_lookup(Name)->width)
+    {
+        case 8:
+            crc8_init(Name, &configuration8, true);
+            verified = crc8_verify(&configuration8, Buffer, BufferLength);
+            break;
+        case 16:
+            crc16_init(Name, &configuration16, CRC16_ENGINE_LOOP);
+            verified = crc16_verify(&configuration16, Buffer, BufferLength);
+            break;
+        case 32:
+            crc32_init(Name, &configuration32, CRC32_ENGINE_LOOP);
+            verified = crc32_verify(&configuration32, Buffer, BufferLength);
+            break;
+        default:
+            crc64_init(Name, &configuration64, CRC64_ENGINE_LOOP);
+            verified = crc64_verify(&configuration64, Buffer, BufferLength);
+            break;
+    }
+
+    /* Exit */
+    return verified;
+}
+
+/****************************************************************************************************
+ * Set Up/Tear Down
+ ****************************************************************************************************/
+
+void setUp(void)
+{
+    /*** Set Up ***/
+    /* Function */
+    memory_free_Stub(helper_memoryFreeStub);
+    memory_malloc_Stub(helper_memoryMallocStub);
+
+    /* Set Up */
+    helper_matchCount = 0;
+    memset(helper_match, 0, sizeof(helper_match));
+}
+
+void tearDown(void)
+{
+}
+
+/****************************************************************************************************
+ * Test (Public)
+ ****************************************************************************************************/
+
+/*** Initialize ***/
+void test_init_1(void)
+{
+    /*** Initialize (NULL Pointer, Unknown Name, Bad Lengths) ***/
+    /* Variable */
+    resync_t resync;
+
+    /* Initialize */
+    TEST_ASSERT_FALSE(resync_init(NULL, "CRC-16/MODBUS", 4, 256, helper_frameCallback, NULL));
+    TEST_ASSERT_FALSE(resync_init(&resync, NULL, 4, 256, helper_frameCallback, NULL));
+    TEST_ASSERT_FALSE(resync_init(&resync, "CRC-16/UNKNOWN", 4, 256, helper_frameCallback, NULL));
+    TEST_ASSERT_FALSE(resync_init(&resync, "CRC-16/MODBUS", 2, 256, helper_frameCallback, NULL)); // CRC Alone
+    TEST_ASSERT_FALSE(resync_init(&resync, "CRC-16/MODBUS", 8, 4, helper_frameCallback, NULL));
+    TEST_ASSERT_FALSE(resync_init(&resync, "CRC-16/MODBUS", 4, 256, NULL, NULL));
+    TEST_ASSERT_TRUE(resync_init(&resync, "CRC-16/MODBUS", 4, 256, helper_frameCallback, NULL));
+    resync_deinit(&resync);
+    TEST_ASSERT_NULL(resync.state);
+}
+
+/*** Update ***/
+void test_update_1(void)
+{
+    /*** Update (Same Matches As Verify At Every Offset And Length) ***/
+    /* Type Definition */
+    typedef struct testData_s
+    {
+        const char *Name;
+        size_t minimumLength;
+        size_t maximumLength;
+    } testData_t;
+
+    /* Variable */
+    size_t chunkLength;
+    size_t expected;
+    size_t offset;
+    resync_t resync;
+    const testData_t TestData[] =
+    {
+        {"CRC-8/SMBUS", 2, 40},
+        {"CRC-8/MAXIM-DOW", 3, 64},
+        {"CRC-16/MODBUS", 4, 256},
+        {"CRC-16/XMODEM", 3, 100},
+        {"CRC-32/ISO-HDLC", 5, 300},
+        {"CRC-32/MPEG-2", 5, 64},
+        {"CRC-64/XZ", 9, 128},
+        {"CRC-64/ECMA-182", 9, 128},
+    };
+
+    /* Update */
+    for(size_t i = 0; i < (sizeof(TestData) / sizeof(testData_t)); i++)
+    {
+        /* Set Up (Noise With Three Frames Appended By The Library Itself) */
+        helper_matchCount = 0;
+        memset(helper_match, 0, sizeof(helper_match));
+        random_buffer(test_Capture, sizeof(test_Capture));
+        for(size_t j = 0; j < 3; j++)
+        {
+            offset = 100 + (200 * j);
+            switch(crc_lookup(TestData[i].Name)->width)
+            {
+                case 8:
+                {
+                    crc8_configuration_t configuration;
+                    crc8_init(TestData[i].Name, &configuration, true);
+                    crc8_calculateAndAppend(&configuration, &test_Capture[offset], 1 + TestData[i].minimumLength + j, TestData[i].minimumLength + j);
+                    break;
+                }
+                case 16:
+                {
+                    crc16_configuration_t configuration;
+                    crc16_init(TestData[i].Name, &configuration, CRC16_ENGINE_LOOP);
+                    crc16_calculateAndAppend(&configuration, &test_Capture[offset], 2 + TestData[i].minimumLength + j, TestData[i].minimumLength + j);
+                    break;
+                }
+                case 32:
+                {
+                    crc32_configuration_t configuration;
+                    crc32_init(TestData[i].Name, &configuration, CRC32_ENGINE_LOOP);
+                    crc32_calculateAndAppend(&configuration, &test_Capture[offset], 4 + TestData[i].minimumLength + j, TestData[i].minimumLength + j);
+                    break;
+                }
+                default:
+                {
+                    crc64_configuration_t configuration;
+                    crc64_init(TestData[i].Name, &configuration, CRC64_ENGINE_LOOP);
+                    crc64_calculateAndAppend(&configuration, &test_Capture[offset], 8 + TestData[i].minimumLength + j, TestData[i].minimumLength + j);
+                    break;
+                }
+            }
+        }
+
+        /* Update (Random Chunks) */
+        TEST_ASSERT_TRUE(resync_init(&resync, TestData[i].Name, TestData[i].minimumLength, TestData[i].maximumLength, helper_frameCallback, NULL));
+        for(offset = 0; offset < sizeof(test_Capture); offset += chunkLength)
+        {
+            chunkLength = random_U32WithinRange(1, 50);
+            if(chunkLength > (sizeof(test_Capture) - offset))
+                chunkLength = sizeof(test_Capture) - offset;
+            resync_update(&resync, &test_Capture[offset], chunkLength);
+        }
+        resync_deinit(&resync);
+
+        /* Verify (Brute Force Over Every Offset And Length, Quadratic, The Cost The Scanner Avoids) */
+        expected = 0;
+        for(offset = 0; offset < sizeof(test_Capture); offset++)
+        {
+            for(size_t length = TestData[i].minimumLength; (length <= TestData[i].maximumLength) && ((offset + length) <= sizeof(test_Capture)); length++)
+            {
+                if(helper_verify(TestData[i].Name, &test_Capture[offset], length))
+                {
+                    TEST_ASSERT_EQUAL_UINT8(1, helper_match[offset][length]);
+                    expected++;
+                }
+                else
+                {
+                    TEST_ASSERT_EQUAL_UINT8(0, helper_match[offset][length]);
+                }
+            }
+        }
+        TEST_ASSERT_EQUAL_size_t(expected, helper_matchCount);
+        TEST_ASSERT_TRUE(expected >= 3);
+    }
+}
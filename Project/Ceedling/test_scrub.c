@@ -0,0 +1,212 @@
+/****************************************************************************************************
+ * Include
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include "crc64.h"
+#include "misc.h"
+#include "mock_memory.h"
+#include "random.h"
+#include "scrub.h"
+#include <errno.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "unity.h"
+
+/****************************************************************************************************
+ * Define
+ ****************************************************************************************************/
+
+#define TEST_FILE_COUNT (6)
+
+/****************************************************************************************************
+ * Variable
+ ****************************************************************************************************/
+
+/*** Helper ***/
+static uint64_t helper_crc[TEST_FILE_COUNT];
+static int helper_error[TEST_FILE_COUNT];
+static uint64_t helper_length[TEST_FILE_COUNT];
+static char helper_path[TEST_FILE_COUNT][32];
+static const char *helper_Path[TEST_FILE_COUNT];
+static size_t helper_resultCount;
+
+/****************************************************************************************************
+ * Helper
+ ****************************************************************************************************/
+
+/*** Memory Free Stub ***/
+static void helper_memoryFreeStub(void **memory, int cmock_num_calls)
+{
+    /*** Memory Free Stub ***/
+    /* Free */
+    free(*memory);
+
+    /* Clean Up */
+    *memory = NULL;
+}
+
+/*** Memory Malloc Stub ***/
+static void *helper_memoryMallocStub(const size_t Size, int cmock_num_calls)
+{
+    /*** Memory Malloc Stub ***/
+    /* Malloc */
+    return malloc(Size);
+}
+
+/*** Result Callback (Store By Path) ***/
+static void helper_resultCallback(const char * const Path, const uint64_t Crc, const uint64_t Length, const int Error, void * const argument)
+{
+    /*** Result Callback (Store By Path) ***/
+    /* Variable */
+    size_t i;
+
+    /* Store */
+    (void)argument;
+    for(i = 0; i < TEST_FILE_COUNT; i++)
+    {
+        if(Path == helper_Path[i])
+        {
+            helper_crc[i] = Crc;
+            helper_error[i] = Error;
+            helper_length[i] = Length;
+        }
+    }
+    helper_resultCount++;
+}
+
+/*** Scrub (Files Of Mixed Sizes, One Missing, One Directory) ***/
+static void helper_scrub(const scrub_backend_t Backend, const size_t QueueDepth, const size_t WorkerCount)
+{
+    /*** Scrub (Files Of Mixed Sizes, One Missing, One Directory) ***/
+    /* Variable */
+    crc64_configuration_t crcConfiguration;
+    static uint8_t data[TEST_FILE_COUNT][50000];
+    int fileDescriptor;
+    size_t i;
+    const size_t Length[TEST_FILE_COUNT] = {0, 1, 4096, 50000, 0, 0};
+    scrub_configuration_t scrubConfiguration;
+    scrub_statistics_t statistics;
+
+    /* Set Up */
+    crc64_init("CRC-64/XZ", &crcConfiguration, CRC64_ENGINE_LOOKUP_TABLE);
+    for(i = 0; i < 4; i++)
+    {
+        random_buffer(data[i], Length[i]);
+        (void)strcpy(helper_path[i], "/tmp/test_scrubXXXXXX");
+        fileDescriptor = mkstemp(helper_path[i]);
+        TEST_ASSERT_TRUE(fileDescriptor >= 0);
+        TEST_ASSERT_EQUAL_size_t(Length[i], (size_t)write(fileDescriptor, data[i], Length[i]));
+        close(fileDescriptor);
+        helper_Path[i] = helper_path[i];
+    }
+    helper_Path[4] = "/nonexistent/test_scrub";
+    helper_Path[5] = "/tmp";
+    helper_resultCount = 0;
+    memset(&scrubConfiguration, 0, sizeof(scrubConfiguration));
+    scrubConfiguration.backend = Backend;
+    scrubConfiguration.blockSize = 4096; // Several Blocks Per File
+    scrubConfiguration.Configuration = &crcConfiguration;
+    scrubConfiguration.queueDepth = QueueDepth;
+    scrubConfiguration.resultCallback = helper_resultCallback;
+    scrubConfiguration.workerCount = WorkerCount;
+
+    /* Scrub */
+    TEST_ASSERT_TRUE(scrub_run(&scrubConfiguration, helper_Path, TEST_FILE_COUNT, &statistics));
+    for(i = 0; i < 4; i++)
+        unlink(helper_path[i]);
+
+    /* Verify */
+    TEST_ASSERT_EQUAL_size_t(TEST_FILE_COUNT, helper_resultCount);
+    for(i = 0; i < 4; i++)
+    {
+        TEST_ASSERT_EQUAL_INT(0, helper_error[i]);
+        TEST_ASSERT_EQUAL_UINT64(Length[i], helper_length[i]);
+        TEST_ASSERT_EQUAL_HEX64(crc64_calculate(&crcConfiguration, data[i], Length[i]), helper_crc[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(ENOENT, helper_error[4]);
+    TEST_ASSERT_EQUAL_INT(EINVAL, helper_error[5]);
+    TEST_ASSERT_EQUAL_size_t(TEST_FILE_COUNT, statistics.files);
+    TEST_ASSERT_EQUAL_size_t(2, statistics.failed);
+    TEST_ASSERT_EQUAL_UINT64(1 + 4096 + 50000, statistics.bytes);
+    if(Backend != SCRUB_BACKEND_AUTOMATIC)
+        TEST_ASSERT_EQUAL_INT(Backend, statistics.backend);
+}
+
+/****************************************************************************************************
+ * Set Up/Tear Down
+ ****************************************************************************************************/
+
+void setUp(void)
+{
+    /*** Set Up ***/
+    /* Function */
+    memory_free_Stub(helper_memoryFreeStub);
+    memory_malloc_Stub(helper_memoryMallocStub);
+}
+
+void tearDown(void)
+{
+}
+
+/****************************************************************************************************
+ * Test (Public)
+ ****************************************************************************************************/
+
+/*** Run ***/
+void test_run_1(void)
+{
+    /*** Run (NULL Pointer) ***/
+    /* Variable */
+    scrub_configuration_t configuration;
+
+    /* Set Up */
+    memset(&configuration, 0, sizeof(configuration));
+
+    /* Run */
+    TEST_ASSERT_FALSE(scrub_run(NULL, helper_Path, 1, NULL));
+    TEST_ASSERT_FALSE(scrub_run(&configuration, helper_Path, 1, NULL)); // No CRC Configuration
+}
+
+void test_run_2(void)
+{
+    /*** Run (No Files) ***/
+    /* Variable */
+    crc64_configuration_t crcConfiguration;
+    scrub_configuration_t scrubConfiguration;
+    scrub_statistics_t statistics;
+
+    /* Set Up */
+    crc64_init("CRC-64/XZ", &crcConfiguration, CRC64_ENGINE_LOOKUP_TABLE);
+    memset(&scrubConfiguration, 0, sizeof(scrubConfiguration));
+    scrubConfiguration.Configuration = &crcConfiguration;
+
+    /* Run */
+    TEST_ASSERT_TRUE(scrub_run(&scrubConfiguration, NULL, 0, &statistics));
+    TEST_ASSERT_EQUAL_size_t(0, statistics.files);
+    TEST_ASSERT_EQUAL_UINT64(0, statistics.bytes);
+}
+
+void test_run_3(void)
+{
+    /*** Run (pread) ***/
+    /* Scrub */
+    helper_scrub(SCRUB_BACKEND_PREAD, 4, 2);
+}
+
+void test_run_4(void)
+{
+    /*** Run (Automatic, io_uring Where The Kernel Allows It) ***/
+    /* Scrub */
+    helper_scrub(SCRUB_BACKEND_AUTOMATIC, 4, 2);
+}
+
+void test_run_5(void)
+{
+    /*** Run (Queue Depth 1, Single Worker) ***/
+    /* Scrub */
+    helper_scrub(SCRUB_BACKEND_AUTOMATIC, 1, 1);
+}
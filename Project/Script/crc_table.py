@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+####################################################################################################
+# CRC Lookup Table Generator
+#
+# Reads the crc8/crc16/crc32/crc64 catalogs and writes one read-only byte-at-a-time lookup table per
+# catalog entry to Eclectic/CRC/crcN_table.h, in catalog order, the list of specialized kernels to
+# Eclectic/CRC/crcN_kernel.h, plus a perfect hash over every name and alias of every width to
+# Eclectic/CRC/crc_name_table.h. Run from anywhere after editing a
+# catalog: python3 Project/Script/crc_table.py
+####################################################################################################
+
+####################################################################################################
+# Imports
+####################################################################################################
+
+import os
+import re
+
+####################################################################################################
+# Constants
+####################################################################################################
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")
+BUCKET_COUNT = 64
+ENTRY = re.compile(r'NULL, "([^"]+)", (0x[0-9A-F]+), (true|false), (true|false), 0x[0-9A-F]+, (0x[0-9A-F]+)\}')
+KERNEL = re.compile(r'(0x[0-9A-F]+), NULL, NULL, "([^"]+)", 0x[0-9A-F]+, (true|false), (true|false), 0x[0-9A-F]+, (0x[0-9A-F]+)\}')
+NAME = re.compile(r'\{\{([^}]*)\}, [0-9]+, .*?NULL, "([^"]+)"')
+TABLE_COUNT = 256
+WIDTH = (8, 16, 32, 64)
+
+####################################################################################################
+# Functions
+####################################################################################################
+
+def hash(name, seed):
+    # Same As crc_nameHash() (32-Bit FNV-1a, Seeded)
+    value = 0x811C9DC5 ^ seed
+    for character in name.encode("ascii"):
+        value = ((value ^ character) * 0x01000193) & 0xFFFFFFFF
+    return value
+
+def reflect(value, width):
+    return int(format(value, "0{}b".format(width))[::-1], 2)
+
+def entry(index, width, polynomial, reflectIn, reflectOut, xorOut):
+    # Same As crcN_calculatePartial(configuration, 0, index, First, Last) ^ xorOut In Loop Mode
+    mask = (1 << width) - 1
+    crc = (reflect(index, 8) if reflectIn else index) << (width - 8)
+    for _ in range(8):
+        crc = ((crc << 1) ^ polynomial) & mask if (crc >> (width - 1)) & 1 else (crc << 1) & mask
+    crc ^= xorOut
+    if reflectOut:
+        crc = reflect(crc, width)
+    return crc ^ xorOut
+
+def generate(width):
+    with open(os.path.join(ROOT, "Eclectic", "CRC", "crc{}.c".format(width)), encoding="utf-8") as source:
+        catalog = ENTRY.findall(source.read())
+    digits = width // 4
+    perLine = {8: 16, 16: 16, 32: 8, 64: 4}[width]
+    lines = [
+        "/****************************************************************************************************",
+        " * Pragmas",
+        " ****************************************************************************************************/",
+        "",
+        "#pragma once",
+        "",
+        "/****************************************************************************************************",
+        " * Includes",
+        " ****************************************************************************************************/",
+        "",
+        "#include \"Eclectic/CRC/crc{}.h\"".format(width),
+        "#include <stdint.h>",
+        "",
+        "/****************************************************************************************************",
+        " * Constants (Generated By Project/Script/crc_table.py, Do Not Edit)",
+        " ****************************************************************************************************/",
+        "",
+        "static const uint{0}_t crc{0}_LookupTable[][CRC{0}_LOOKUP_TABLE_COUNT] =".format(width),
+        "    {",
+    ]
+    for number, (name, polynomial, reflectIn, reflectOut, xorOut) in enumerate(catalog):
+        table = [entry(i, width, int(polynomial, 16), reflectIn == "true", reflectOut == "true", int(xorOut, 16)) for i in range(256)]
+        lines.append("        /* {} */".format(name))
+        lines.append("        {")
+        for start in range(0, 256, perLine):
+            row = ", ".join("0x{:0{}X}".format(value, digits) for value in table[start:start + perLine])
+            lines.append("            {}{}".format(row, "," if (start + perLine) < 256 else ""))
+        lines.append("        }}{}".format("," if number < (len(catalog) - 1) else "};"))
+    with open(os.path.join(ROOT, "Eclectic", "CRC", "crc{}_table.h".format(width)), "w", encoding="utf-8", newline="\r\n") as header:
+        header.write("\n".join(lines) + "\n")
+
+def generateKernel(width):
+    # One KERNEL(Identifier, Index, Initial, Table Initial, Reflect In, XOR Out) Per Catalog Entry, Table Initial Is Initial In The Lookup Table Domain
+    with open(os.path.join(ROOT, "Eclectic", "CRC", "crc{}.c".format(width)), encoding="utf-8") as source:
+        catalog = KERNEL.findall(source.read())
+    digits = width // 4
+    lines = [
+        "/****************************************************************************************************",
+        " * Pragmas",
+        " ****************************************************************************************************/",
+        "",
+        "#pragma once",
+        "",
+        "/****************************************************************************************************",
+        " * Defines (Generated By Project/Script/crc_table.py, Do Not Edit)",
+        " ****************************************************************************************************/",
+        "",
+        "#define CRC{}_KERNEL_LIST(KERNEL) \\".format(width),
+    ]
+    for index, (initial, name, reflectIn, _, xorOut) in enumerate(catalog):
+        identifier = re.sub(r"[^a-z0-9]", "_", name.split("/", 1)[1].lower())
+        tableInitial = reflect(int(initial, 16), width) if reflectIn == "true" else int(initial, 16)
+        lines.append("    KERNEL({}, {}, {}, 0x{:0{}X}, {}, {}){}".format(identifier, index, initial, tableInitial, digits, reflectIn, xorOut, " \\" if index < (len(catalog) - 1) else ""))
+    with open(os.path.join(ROOT, "Eclectic", "CRC", "crc{}_kernel.h".format(width)), "w", encoding="utf-8", newline="\r\n") as header:
+        header.write("\n".join(lines) + "\n")
+
+def generateName():
+    # Hash And Displace: Largest Buckets First, Each Gets The First Seed That Lands All Its Keys In Free Slots
+    keys = []
+    for width in WIDTH:
+        with open(os.path.join(ROOT, "Eclectic", "CRC", "crc{}.c".format(width)), encoding="utf-8") as source:
+            for index, (aliases, name) in enumerate(NAME.findall(source.read())):
+                keys += [(key, index, width) for key in [name] + re.findall(r'"([^"]+)"', aliases)]
+    if len(set(key for key, _, _ in keys)) != len(keys):
+        raise SystemExit("duplicate algorithm name or alias")
+    buckets = [[] for _ in range(BUCKET_COUNT)]
+    for key in keys:
+        buckets[hash(key[0], 0) % BUCKET_COUNT].append(key)
+    displacement = [0] * BUCKET_COUNT
+    table = [None] * TABLE_COUNT
+    for bucket in sorted(range(BUCKET_COUNT), key=lambda bucket: -len(buckets[bucket])):
+        for seed in range(1, 0x10000):
+            slots = [hash(key[0], seed) % TABLE_COUNT for key in buckets[bucket]]
+            if (len(set(slots)) == len(slots)) and all(table[slot] is None for slot in slots):
+                break
+        else:
+            raise SystemExit("no perfect hash, increase TABLE_COUNT")
+        displacement[bucket] = seed if buckets[bucket] else 0
+        for slot, key in zip(slots, buckets[bucket]):
+            table[slot] = key
+    lines = [
+        "/****************************************************************************************************",
+        " * Pragmas",
+        " ****************************************************************************************************/",
+        "",
+        "#pragma once",
+        "",
+        "/****************************************************************************************************",
+        " * Defines",
+        " ****************************************************************************************************/",
+        "",
+        "#define CRC_NAME_BUCKET_COUNT ({})".format(BUCKET_COUNT),
+        "#define CRC_NAME_TABLE_COUNT ({})".format(TABLE_COUNT),
+        "",
+        "/****************************************************************************************************",
+        " * Includes",
+        " ****************************************************************************************************/",
+        "",
+        "#include \"Eclectic/CRC/crc.h\"",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "",
+        "/****************************************************************************************************",
+        " * Constants (Generated By Project/Script/crc_table.py, Do Not Edit)",
+        " ****************************************************************************************************/",
+        "",
+        "static const uint16_t crc_NameDisplacement[CRC_NAME_BUCKET_COUNT] =",
+        "    {",
+    ]
+    for start in range(0, BUCKET_COUNT, 16):
+        row = ", ".join("0x{:04X}".format(value) for value in displacement[start:start + 16])
+        lines.append("        {}{}".format(row, "," if (start + 16) < BUCKET_COUNT else "};"))
+    lines += [
+        "",
+        "static const crc_name_t crc_NameTable[CRC_NAME_TABLE_COUNT] =",
+        "    {",
+    ]
+    for slot, key in enumerate(table):
+        entry = "{{{}, \"{}\", {}}}".format(key[1], key[0], key[2]) if key else "{0, NULL, 0}"
+        lines.append("        {}{}".format(entry, "," if slot < (TABLE_COUNT - 1) else "};"))
+    with open(os.path.join(ROOT, "Eclectic", "CRC", "crc_name_table.h"), "w", encoding="utf-8", newline="\r\n") as header:
+        header.write("\n".join(lines) + "\n")
+
+####################################################################################################
+# Main
+####################################################################################################
+
+if __name__ == "__main__":
+    for width in WIDTH:
+        generate(width)
+        generateKernel(width)
+    generateName()